@@ -1,6 +1,7 @@
 #include "ads1115.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
+#include <algorithm>
 
 namespace esphome {
 namespace ads1115 {
@@ -83,7 +84,7 @@ void ADS1115Component::dump_config() {
     ESP_LOGCONFIG(TAG, "    Resolution: %u", sensor->get_resolution());
   }
 }
-float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
+uint16_t ADS1115Component::get_config_(ADS1115Sensor *sensor) const {
   uint16_t config = this->prev_config_;
   // Multiplexer
   //        0bxBBBxxxxxxxxxxxx
@@ -99,6 +100,10 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
     // Start conversion
     config |= 0b1000000000000000;
   }
+  return config;
+}
+float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
+  uint16_t config = this->get_config_(sensor);
 
   if (!this->continuous_mode_ || this->prev_config_ != config) {
     if (!this->write_byte_16(ADS1115_REGISTER_CONFIG, config)) {
@@ -131,7 +136,76 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
     this->status_set_warning();
     return NAN;
   }
+  return this->convert_(sensor, raw_conversion);
+}
+void ADS1115Component::queue_measurement(ADS1115Sensor *sensor) {
+  if (sensor == this->measuring_ || std::find(this->queue_.begin(), this->queue_.end(), sensor) != this->queue_.end())
+    return;
+  this->queue_.push_back(sensor);
+  this->start_next_measurement_();
+}
+void ADS1115Component::start_next_measurement_() {
+  if (this->measuring_ != nullptr || this->queue_.empty())
+    return;
+  this->measuring_ = this->queue_.front();
+  this->queue_.erase(this->queue_.begin());
+  this->measurement_start_ = millis();
+
+  uint16_t config = this->get_config_(this->measuring_);
+  this->transaction_.clear();
+  if (!this->continuous_mode_ || this->prev_config_ != config) {
+    uint8_t data[2] = {uint8_t(config >> 8), uint8_t(config)};
+    // about 1.2 ms with 860 samples per second, the bus serves other devices in the meantime
+    this->transaction_.write_register(ADS1115_REGISTER_CONFIG, data, 2).wait(2);
+    this->prev_config_ = config;
+  }
+  this->transaction_.read_register(ADS1115_REGISTER_CONFIG, this->read_buffer_, 2)
+      .read_register(ADS1115_REGISTER_CONVERSION, this->read_buffer_ + 2, 2)
+      .then([this](i2c::ErrorCode err) { this->on_measurement_(err); });
+  this->submit(&this->transaction_);
+}
+void ADS1115Component::on_measurement_(i2c::ErrorCode err) {
+  ADS1115Sensor *sensor = this->measuring_;
+  if (err != i2c::ERROR_OK) {
+    this->status_set_warning();
+    this->finish_measurement_();
+    return;
+  }
+  uint16_t config = encode_uint16(this->read_buffer_[0], this->read_buffer_[1]);
+  if (((config ^ this->get_config_(sensor)) & 0b0111111000000000) != 0) {
+    // a blocking measurement (e.g. sample()) changed the multiplexer or gain in the meantime, start over
+    this->queue_.insert(this->queue_.begin(), sensor);
+    this->finish_measurement_();
+    return;
+  }
+  if (!this->continuous_mode_ && (config >> 15) == 0) {
+    // conversion still running
+    if (millis() - this->measurement_start_ > 100) {
+      ESP_LOGW(TAG, "Reading ADS1115 timed out");
+      this->status_set_warning();
+      this->finish_measurement_();
+      return;
+    }
+    this->transaction_.clear();
+    this->transaction_.wait(1)
+        .read_register(ADS1115_REGISTER_CONFIG, this->read_buffer_, 2)
+        .read_register(ADS1115_REGISTER_CONVERSION, this->read_buffer_ + 2, 2);
+    this->submit(&this->transaction_);
+    return;
+  }
 
+  float v = this->convert_(sensor, encode_uint16(this->read_buffer_[2], this->read_buffer_[3]));
+  if (!std::isnan(v)) {
+    ESP_LOGD(TAG, "'%s': Got Voltage=%fV", sensor->get_name().c_str(), v);
+    sensor->publish_state(v);
+  }
+  this->finish_measurement_();
+}
+void ADS1115Component::finish_measurement_() {
+  this->measuring_ = nullptr;
+  this->start_next_measurement_();
+}
+float ADS1115Component::convert_(ADS1115Sensor *sensor, uint16_t raw_conversion) {
   if (sensor->get_resolution() == ADS1015_12_BITS) {
     bool negative = (raw_conversion >> 15) == 1;
 
@@ -180,13 +254,7 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
 }
 
 float ADS1115Sensor::sample() { return this->parent_->request_measurement(this); }
-void ADS1115Sensor::update() {
-  float v = this->parent_->request_measurement(this);
-  if (!std::isnan(v)) {
-    ESP_LOGD(TAG, "'%s': Got Voltage=%fV", this->get_name().c_str(), v);
-    this->publish_state(v);
-  }
-}
+void ADS1115Sensor::update() { this->parent_->queue_measurement(this); }
 
 }  // namespace ads1115
 }  // namespace esphome
@@ -49,11 +49,24 @@ class ADS1115Component : public Component, public i2c::I2CDevice {
 
   /// Helper method to request a measurement from a sensor.
   float request_measurement(ADS1115Sensor *sensor);
+  /// Measure without blocking, the sensor publishes the result once the conversion finished.
+  void queue_measurement(ADS1115Sensor *sensor);
 
  protected:
+  uint16_t get_config_(ADS1115Sensor *sensor) const;
+  float convert_(ADS1115Sensor *sensor, uint16_t raw_conversion);
+  void start_next_measurement_();
+  void on_measurement_(i2c::ErrorCode err);
+  void finish_measurement_();
+
   std::vector<ADS1115Sensor *> sensors_;
   uint16_t prev_config_{0};
   bool continuous_mode_;
+  std::vector<ADS1115Sensor *> queue_;
+  ADS1115Sensor *measuring_{nullptr};
+  uint32_t measurement_start_{0};
+  i2c::I2CTransaction transaction_;
+  uint8_t read_buffer_[4];
 };
 
 /// Internal holder class that is in instance of Sensor so that the hub can create individual sensors.
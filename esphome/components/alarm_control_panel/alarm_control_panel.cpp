@@ -3,6 +3,7 @@
 #include "alarm_control_panel.h"
 
 #include "esphome/core/application.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
@@ -33,6 +34,7 @@ void AlarmControlPanel::publish_state(AlarmControlPanelState state) {
     ESP_LOGD(TAG, "Set state to: %s, previous: %s", LOG_STR_ARG(alarm_control_panel_state_to_string(state)),
              LOG_STR_ARG(alarm_control_panel_state_to_string(prev_state)));
     this->current_state_ = state;
+    global_entity_change_bus.mark_changed(ENTITY_TYPE_ALARM_CONTROL_PANEL, this->get_entity_index());
     this->state_callback_.call();
     if (state == ACP_STATE_TRIGGERED) {
       this->triggered_callback_.call();
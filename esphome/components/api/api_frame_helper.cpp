@@ -158,6 +158,8 @@ APIError APINoiseFrameHelper::loop() {
       return err;
     }
   }
+  // the loop wakes up once the socket takes the rest of the buffered data
+  socket_->set_write_interest(!tx_buf_.empty());
   return APIError::OK;
 }
 
@@ -181,6 +183,9 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
     return APIError::BAD_ARG;
   }
 
+  if (!socket_->ready())
+    return APIError::WOULD_BLOCK;
+
   // read header
   if (rx_header_buf_len_ < 3) {
     // no header information yet
@@ -779,6 +784,8 @@ APIError APIPlaintextFrameHelper::loop() {
       return err;
     }
   }
+  // the loop wakes up once the socket takes the rest of the buffered data
+  socket_->set_write_interest(!tx_buf_.empty());
   return APIError::OK;
 }
 
@@ -797,6 +804,9 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
     return APIError::BAD_ARG;
   }
 
+  if (!socket_->ready())
+    return APIError::WOULD_BLOCK;
+
   // read header
   while (!rx_header_parsed_) {
     uint8_t data;
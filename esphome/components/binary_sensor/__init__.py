@@ -1,7 +1,7 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.cpp_generator import MockObjClass
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import get_adaptive_poller, setup_entity
 from esphome import automation, core
 from esphome.automation import Condition, maybe_simple_id
 from esphome.components import mqtt
@@ -478,9 +478,18 @@ def binary_sensor_schema(
     return BINARY_SENSOR_SCHEMA.extend(schema)
 
 
+async def _setup_adaptive_polling(var, poller_id):
+    poller = await cg.get_variable(poller_id)
+    cg.add(var.set_adaptive_polling(poller))
+
+
 async def setup_binary_sensor_core_(var, config):
     await setup_entity(var, config)
 
+    poller_id = get_adaptive_poller(config)
+    if poller_id is not None:
+        CORE.add_job(_setup_adaptive_polling, var, poller_id)
+
     if (device_class := config.get(CONF_DEVICE_CLASS)) is not None:
         cg.add(var.set_device_class(device_class))
     if publish_initial_state := config.get(CONF_PUBLISH_INITIAL_STATE):
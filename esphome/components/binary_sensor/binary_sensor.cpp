@@ -1,4 +1,5 @@
 #include "binary_sensor.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -12,7 +13,10 @@ void BinarySensor::add_on_state_callback(std::function<void(bool)> &&callback) {
 }
 
 void BinarySensor::publish_state(bool state) {
-  if (!this->publish_dedup_.next(state))
+  const bool changed = this->publish_dedup_.next(state);
+  if (this->poller_ != nullptr)
+    this->poller_->report_reading(changed);
+  if (!changed)
     return;
   if (this->filter_list_ == nullptr) {
     this->send_state_internal(state, false);
@@ -35,9 +39,13 @@ void BinarySensor::send_state_internal(bool state, bool is_initial) {
   } else {
     ESP_LOGD(TAG, "'%s': Sending state %s", this->get_name().c_str(), ONOFF(state));
   }
+  // a press shorter than a loop iteration must still reach the controllers, deliver the previous state first
+  if (state != this->state)
+    global_entity_change_bus.flush(ENTITY_TYPE_BINARY_SENSOR, this->get_entity_index());
   this->has_state_ = true;
   this->state = state;
   if (!is_initial || this->publish_initial_state_) {
+    global_entity_change_bus.mark_changed(ENTITY_TYPE_BINARY_SENSOR, this->get_entity_index());
     this->state_callback_.call(state);
   }
 }
@@ -65,6 +65,9 @@ class BinarySensor : public EntityBase, public EntityBase_DeviceClass {
 
   void set_publish_initial_state(bool publish_initial_state) { this->publish_initial_state_ = publish_initial_state; }
 
+  /// Report published states to `poller` for adaptive polling, every change of the state counts as changed.
+  void set_adaptive_polling(PollingComponent *poller) { this->poller_ = poller; }
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   void send_state_internal(bool state, bool is_initial);
@@ -77,6 +80,7 @@ class BinarySensor : public EntityBase, public EntityBase_DeviceClass {
  protected:
   CallbackManager<void(bool)> state_callback_{};
   Filter *filter_list_{nullptr};
+  PollingComponent *poller_{nullptr};  ///< Component notified of published states for adaptive polling.
   bool has_state_{false};
   bool publish_initial_state_{false};
   Deduplicator<bool> publish_dedup_;
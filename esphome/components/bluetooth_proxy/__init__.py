@@ -1,7 +1,7 @@
 from esphome.components import esp32_ble_tracker, esp32_ble_client
 import esphome.config_validation as cv
 import esphome.codegen as cg
-from esphome.const import CONF_ACTIVE, CONF_ID
+from esphome.const import CONF_ACTIVE, CONF_ID, CONF_SIZE
 from esphome.components.esp32 import add_idf_sdkconfig_option
 
 AUTO_LOAD = ["esp32_ble_client", "esp32_ble_tracker"]
@@ -10,6 +10,8 @@ CODEOWNERS = ["@jesserockz"]
 
 CONF_CACHE_SERVICES = "cache_services"
 CONF_CONNECTIONS = "connections"
+CONF_ADVERTISEMENT_CACHE = "advertisement_cache"
+CONF_WINDOW = "window"
 MAX_CONNECTIONS = 3
 
 bluetooth_proxy_ns = cg.esphome_ns.namespace("bluetooth_proxy")
@@ -56,6 +58,14 @@ CONFIG_SCHEMA = cv.All(
                 cv.ensure_list(CONNECTION_SCHEMA),
                 cv.Length(min=1, max=MAX_CONNECTIONS),
             ),
+            cv.Optional(CONF_ADVERTISEMENT_CACHE): cv.Schema(
+                {
+                    cv.Optional(
+                        CONF_WINDOW, default="1s"
+                    ): cv.positive_not_null_time_period,
+                    cv.Optional(CONF_SIZE, default=128): cv.int_range(min=4, max=1024),
+                }
+            ),
         }
     )
     .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
@@ -69,6 +79,13 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_active(config[CONF_ACTIVE]))
+    if cache_config := config.get(CONF_ADVERTISEMENT_CACHE):
+        cg.add(
+            var.set_advertisement_cache(
+                cache_config[CONF_SIZE],
+                cache_config[CONF_WINDOW].total_milliseconds,
+            )
+        )
     await esp32_ble_tracker.register_ble_device(var, config)
 
     for connection_conf in config.get(CONF_CONNECTIONS, []):
@@ -0,0 +1,76 @@
+#include "advertisement_cache.h"
+
+namespace esphome {
+namespace bluetooth_proxy {
+
+static const size_t MAX_PROBES = 4;
+
+static uint32_t payload_hash(const uint8_t *data, size_t len) {
+  // FNV-1a
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+bool AdvertisementCache::should_forward(uint64_t address, const uint8_t *data, size_t len, uint32_t now) {
+  if (this->size_ == 0 || address == 0) {
+    this->stats_.forwarded++;
+    return true;
+  }
+  if (this->entries_ == nullptr)
+    this->entries_.reset(new Entry[this->size_]());  // NOLINT(cppcoreguidelines-owning-memory)
+
+  uint32_t hash = payload_hash(data, len);
+  // the lower bytes are device specific, the vendor prefix in the upper ones is folded in
+  size_t start = static_cast<size_t>((address ^ (address >> 24)) % this->size_);
+  Entry *entry = nullptr;
+  for (size_t i = 0; i < MAX_PROBES && i < this->size_; i++) {
+    Entry &candidate = this->entries_[(start + i) % this->size_];
+    if (candidate.address == address) {
+      entry = &candidate;
+      break;
+    }
+    // prefer a free slot, otherwise the least recently forwarded one
+    if (entry == nullptr) {
+      entry = &candidate;
+    } else if (entry->address != 0 && (candidate.address == 0 || candidate.age(now) > entry->age(now))) {
+      entry = &candidate;
+    }
+  }
+
+  if (entry->address == address) {
+    for (uint8_t i = 0; i < 2; i++) {
+      if (entry->hash[i] == hash && now - entry->last_forward[i] < this->window_) {
+        this->stats_.suppressed++;
+        return false;
+      }
+    }
+  } else {
+    if (entry->address != 0 && entry->age(now) < this->window_)
+      this->stats_.evicted++;
+    entry->address = address;
+    // both payloads are unknown, but the ages have to be valid
+    entry->hash[0] = entry->hash[1] = ~hash;
+    entry->last_forward[0] = entry->last_forward[1] = now - this->window_;
+  }
+
+  // replace the matching or the older payload
+  uint8_t slot;
+  if (entry->hash[0] == hash) {
+    slot = 0;
+  } else if (entry->hash[1] == hash) {
+    slot = 1;
+  } else {
+    slot = now - entry->last_forward[0] > now - entry->last_forward[1] ? 0 : 1;
+  }
+  entry->hash[slot] = hash;
+  entry->last_forward[slot] = now;
+  this->stats_.forwarded++;
+  return true;
+}
+
+}  // namespace bluetooth_proxy
+}  // namespace esphome
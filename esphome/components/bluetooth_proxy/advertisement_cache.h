@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace bluetooth_proxy {
+
+struct AdvertisementCacheStats {
+  uint32_t forwarded;
+  uint32_t suppressed;
+  uint32_t evicted;  ///< entries replaced by other addresses while still inside the window
+};
+
+/** Suppresses advertisements that repeat the last forwarded payload of an address.
+ *
+ * The cache remembers the hashes of the last two forwarded payloads of up to `size` addresses in a fixed table, two
+ * because active scans alternate between the advertisement and the scan response. An advertisement is forwarded if
+ * its payload changed or the window passed since that payload was last forwarded, so unchanged adverts still reach
+ * Home Assistant once per window. Addresses are placed by their hash and probe a few neighbouring slots, when all are
+ * taken the least recently forwarded one is replaced.
+ */
+class AdvertisementCache {
+ public:
+  AdvertisementCache(size_t size, uint32_t window) : size_(size), window_(window) {}
+
+  /// Returns whether the advertisement has to be forwarded and remembers it if so.
+  bool should_forward(uint64_t address, const uint8_t *data, size_t len, uint32_t now);
+
+  uint32_t get_window() const { return this->window_; }
+  size_t get_size() const { return this->size_; }
+  const AdvertisementCacheStats &get_stats() const { return this->stats_; }
+
+ protected:
+  struct Entry {
+    uint64_t address;  ///< 0 for a free slot
+    uint32_t hash[2];
+    uint32_t last_forward[2];
+
+    uint32_t age(uint32_t now) const { return std::min(now - this->last_forward[0], now - this->last_forward[1]); }
+  };
+
+  std::unique_ptr<Entry[]> entries_;
+  size_t size_;
+  uint32_t window_;
+  AdvertisementCacheStats stats_{};
+};
+
+}  // namespace bluetooth_proxy
+}  // namespace esphome
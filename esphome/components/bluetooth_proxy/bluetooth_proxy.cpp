@@ -1,5 +1,6 @@
 #include "bluetooth_proxy.h"
 
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 
@@ -40,14 +41,19 @@ bool BluetoothProxy::parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_p
     return false;
 
   api::BluetoothLERawAdvertisementsResponse resp;
+  uint32_t now = millis();
   for (size_t i = 0; i < count; i++) {
     auto &result = advertisements[i];
+    uint64_t address = esp32_ble::ble_addr_to_uint64(result.bda);
+    uint8_t length = result.adv_data_len + result.scan_rsp_len;
+    if (!this->advertisement_cache_.should_forward(address, result.ble_adv, length, now))
+      continue;
+
     api::BluetoothLERawAdvertisement adv;
-    adv.address = esp32_ble::ble_addr_to_uint64(result.bda);
+    adv.address = address;
     adv.rssi = result.rssi;
     adv.address_type = result.ble_addr_type;
 
-    uint8_t length = result.adv_data_len + result.scan_rsp_len;
     adv.data.reserve(length);
     for (uint16_t i = 0; i < length; i++) {
       adv.data.push_back(result.ble_adv[i]);
@@ -55,7 +61,9 @@ bool BluetoothProxy::parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_p
 
     resp.advertisements.push_back(std::move(adv));
   }
-  ESP_LOGV(TAG, "Proxying %d packets", count);
+  if (resp.advertisements.empty())
+    return true;
+  ESP_LOGV(TAG, "Proxying %d of %d packets", (int) resp.advertisements.size(), (int) count);
   this->api_connection_->send_bluetooth_le_raw_advertisements_response(resp);
   return true;
 }
@@ -84,9 +92,31 @@ void BluetoothProxy::send_api_packet_(const esp32_ble_tracker::ESPBTDevice &devi
   this->api_connection_->send_bluetooth_le_advertisement(resp);
 }
 
+void BluetoothProxy::setup() {
+  if (this->advertisement_cache_.get_window() == 0)
+    return;
+  this->set_interval("advertisement_stats", 60000, [this]() {
+    const AdvertisementCacheStats &stats = this->advertisement_cache_.get_stats();
+    uint32_t forwarded = stats.forwarded - this->last_stats_.forwarded;
+    uint32_t suppressed = stats.suppressed - this->last_stats_.suppressed;
+    uint32_t evicted = stats.evicted - this->last_stats_.evicted;
+    this->last_stats_ = stats;
+    if (forwarded + suppressed == 0)
+      return;
+    ESP_LOGD(TAG, "Advertisements in the last minute: %" PRIu32 " forwarded, %" PRIu32 " suppressed (%.0f%%)",
+             forwarded, suppressed, 100.0f * suppressed / (forwarded + suppressed));
+    if (evicted > 0)
+      ESP_LOGD(TAG, "  %" PRIu32 " addresses were evicted from the cache, consider increasing its size", evicted);
+  });
+}
+
 void BluetoothProxy::dump_config() {
   ESP_LOGCONFIG(TAG, "Bluetooth Proxy:");
   ESP_LOGCONFIG(TAG, "  Active: %s", YESNO(this->active_));
+  if (this->advertisement_cache_.get_window() != 0) {
+    ESP_LOGCONFIG(TAG, "  Advertisement cache: %u addresses, %" PRIu32 "ms window",
+                  (unsigned) this->advertisement_cache_.get_size(), this->advertisement_cache_.get_window());
+  }
 }
 
 int BluetoothProxy::get_bluetooth_connections_free() {
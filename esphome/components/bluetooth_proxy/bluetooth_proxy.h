@@ -13,6 +13,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 
+#include "advertisement_cache.h"
 #include "bluetooth_connection.h"
 
 namespace esphome {
@@ -49,6 +50,7 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   BluetoothProxy();
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   bool parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_param *advertisements, size_t count) override;
+  void setup() override;
   void dump_config() override;
   void loop() override;
   esp32_ble_tracker::AdvertisementParserType get_advertisement_parser_type() override;
@@ -91,6 +93,8 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   }
 
   void set_active(bool active) { this->active_ = active; }
+  /// Suppress raw advertisements repeating the last forwarded payload of an address within `window` ms.
+  void set_advertisement_cache(size_t size, uint32_t window) { this->advertisement_cache_ = {size, window}; }
   bool has_active() { return this->active_; }
 
   uint32_t get_legacy_version() const {
@@ -124,6 +128,8 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   std::vector<BluetoothConnection *> connections_{};
   api::APIConnection *api_connection_{nullptr};
   bool raw_advertisements_{false};
+  AdvertisementCache advertisement_cache_{0, 0};
+  AdvertisementCacheStats last_stats_{};
 };
 
 extern BluetoothProxy *global_bluetooth_proxy;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
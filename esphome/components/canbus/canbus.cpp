@@ -1,6 +1,8 @@
 #include "canbus.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace canbus {
 
@@ -22,17 +24,16 @@ void Canbus::dump_config() {
   }
 }
 
-void Canbus::send_data(uint32_t can_id, bool use_extended_id, bool remote_transmission_request,
-                       const std::vector<uint8_t> &data) {
+void Canbus::send_data(uint32_t can_id, bool use_extended_id, bool remote_transmission_request, const uint8_t *data,
+                       size_t size) {
   struct CanFrame can_message;
 
-  uint8_t size = static_cast<uint8_t>(data.size());
   if (use_extended_id) {
     ESP_LOGD(TAG, "send extended id=0x%08" PRIx32 " rtr=%s size=%d", can_id, TRUEFALSE(remote_transmission_request),
-             size);
+             (int) size);
   } else {
     ESP_LOGD(TAG, "send standard id=0x%03" PRIx32 " rtr=%s size=%d", can_id, TRUEFALSE(remote_transmission_request),
-             size);
+             (int) size);
   }
   if (size > CAN_MAX_DATA_LENGTH)
     size = CAN_MAX_DATA_LENGTH;
@@ -41,55 +42,130 @@ void Canbus::send_data(uint32_t can_id, bool use_extended_id, bool remote_transm
   can_message.use_extended_id = use_extended_id;
   can_message.remote_transmission_request = remote_transmission_request;
 
-  for (int i = 0; i < size; i++) {
+  for (size_t i = 0; i < size; i++) {
     can_message.data[i] = data[i];
-    ESP_LOGVV(TAG, "  data[%d]=%02x", i, can_message.data[i]);
+    ESP_LOGVV(TAG, "  data[%d]=%02x", (int) i, can_message.data[i]);
   }
 
   this->send_message(&can_message);
 }
 
+static uint32_t trigger_key(uint32_t can_id, bool use_extended_id) {
+  return use_extended_id ? can_id | 0x80000000 : can_id;
+}
+
 void Canbus::add_trigger(CanbusTrigger *trigger) {
   if (trigger->use_extended_id_) {
     ESP_LOGVV(TAG, "add trigger for extended canid=0x%08" PRIx32, trigger->can_id_);
   } else {
     ESP_LOGVV(TAG, "add trigger for std canid=0x%03" PRIx32, trigger->can_id_);
   }
-  this->triggers_.push_back(trigger);
+  trigger->order_ = this->exact_triggers_.size() + this->masked_triggers_.size();
+  uint32_t id_mask = trigger->use_extended_id_ ? 0x1FFFFFFF : 0x7FF;
+  if ((trigger->can_id_mask_ & id_mask) == id_mask) {
+    // exact match, insert after the triggers with the same id to keep them in order
+    uint32_t key = trigger_key(trigger->can_id_, trigger->use_extended_id_);
+    auto it = std::upper_bound(this->exact_triggers_.begin(), this->exact_triggers_.end(), key,
+                               [](uint32_t key, const std::pair<uint32_t, CanbusTrigger *> &entry) {
+                                 return key < entry.first;
+                               });
+    this->exact_triggers_.insert(it, {key, trigger});
+  } else {
+    this->masked_triggers_.push_back(trigger);
+  }
+  this->filters_changed_ = true;
 };
 
 void Canbus::loop() {
+  if (this->filters_changed_) {
+    this->filters_changed_ = false;
+    std::vector<CanFilter> filters;
+    filters.reserve(this->exact_triggers_.size() + this->masked_triggers_.size());
+    for (auto &entry : this->exact_triggers_)
+      filters.push_back({entry.second->can_id_, entry.second->can_id_mask_, entry.second->use_extended_id_});
+    for (auto *trigger : this->masked_triggers_)
+      filters.push_back({trigger->can_id_, trigger->can_id_mask_, trigger->use_extended_id_});
+    this->set_filters(filters);
+  }
+
   struct CanFrame can_message;
   // read all messages until queue is empty
   int message_counter = 0;
   while (this->read_message(&can_message) == canbus::ERROR_OK) {
     message_counter++;
     if (can_message.use_extended_id) {
-      ESP_LOGD(TAG, "received can message (#%d) extended can_id=0x%" PRIx32 " size=%d", message_counter,
+      ESP_LOGV(TAG, "received can message (#%d) extended can_id=0x%" PRIx32 " size=%d", message_counter,
                can_message.can_id, can_message.can_data_length_code);
     } else {
-      ESP_LOGD(TAG, "received can message (#%d) std can_id=0x%" PRIx32 " size=%d", message_counter, can_message.can_id,
+      ESP_LOGV(TAG, "received can message (#%d) std can_id=0x%" PRIx32 " size=%d", message_counter, can_message.can_id,
                can_message.can_data_length_code);
     }
+    this->dispatch_(can_message);
+  }
+}
+
+void Canbus::dispatch_(const CanFrame &frame) {
+  // the trigger arguments are only built once a trigger matches
+  std::vector<uint8_t> data;
+  bool has_data = false;
+  auto fire = [&](CanbusTrigger *trigger) {
+    if (trigger->remote_transmission_request_.has_value() &&
+        trigger->remote_transmission_request_.value() != frame.remote_transmission_request)
+      return;
+    if (!has_data) {
+      uint8_t size = std::min(frame.can_data_length_code, CAN_MAX_DATA_LENGTH);
+      data.reserve(size);
+      data.assign(frame.data, frame.data + size);
+      has_data = true;
+      for (uint8_t i = 0; i < size; i++)
+        ESP_LOGVV(TAG, "  can_message.data[%d]=%02x", i, data[i]);
+    }
+    trigger->trigger(data, frame.can_id, frame.remote_transmission_request);
+  };
 
-    std::vector<uint8_t> data;
+  uint32_t key = trigger_key(frame.can_id, frame.use_extended_id);
+  auto exact = std::lower_bound(
+      this->exact_triggers_.begin(), this->exact_triggers_.end(), key,
+      [](const std::pair<uint32_t, CanbusTrigger *> &entry, uint32_t key) { return entry.first < key; });
+  auto masked_matches = [&frame](CanbusTrigger *trigger) {
+    return trigger->can_id_ == (frame.can_id & trigger->can_id_mask_) &&
+           trigger->use_extended_id_ == frame.use_extended_id;
+  };
+  auto masked = std::find_if(this->masked_triggers_.begin(), this->masked_triggers_.end(), masked_matches);
 
-    // show data received
-    for (int i = 0; i < can_message.can_data_length_code; i++) {
-      ESP_LOGV(TAG, "  can_message.data[%d]=%02x", i, can_message.data[i]);
-      data.push_back(can_message.data[i]);
+  // both lists are in the order the triggers were added, merge them to fire the triggers in that order
+  while (true) {
+    bool has_exact = exact != this->exact_triggers_.end() && exact->first == key;
+    bool has_masked = masked != this->masked_triggers_.end();
+    if (has_exact && (!has_masked || exact->second->order_ < (*masked)->order_)) {
+      fire(exact->second);
+      ++exact;
+    } else if (has_masked) {
+      fire(*masked);
+      masked = std::find_if(masked + 1, this->masked_triggers_.end(), masked_matches);
+    } else {
+      break;
     }
+  }
+}
 
-    // fire all triggers
-    for (auto *trigger : this->triggers_) {
-      if ((trigger->can_id_ == (can_message.can_id & trigger->can_id_mask_)) &&
-          (trigger->use_extended_id_ == can_message.use_extended_id) &&
-          (!trigger->remote_transmission_request_.has_value() ||
-           trigger->remote_transmission_request_.value() == can_message.remote_transmission_request)) {
-        trigger->trigger(data, can_message.can_id, can_message.remote_transmission_request);
-      }
+optional<CanFilter> merge_filters(const std::vector<CanFilter> &filters, bool use_extended_id) {
+  uint32_t id_mask = use_extended_id ? 0x1FFFFFFF : 0x7FF;
+  optional<CanFilter> merged;
+  for (const auto &filter : filters) {
+    if (filter.use_extended_id != use_extended_id)
+      continue;
+    uint32_t mask = filter.mask & id_mask;
+    uint32_t id = filter.id & mask;
+    if (!merged.has_value()) {
+      merged = CanFilter{id, mask, use_extended_id};
+      continue;
     }
+    // only keep the bits all filters care about and agree on
+    merged->mask &= mask & ~(merged->id ^ id);
+    merged->id &= merged->mask;
   }
+  return merged;
 }
 
 }  // namespace canbus
@@ -62,6 +62,16 @@ struct CanFrame {
   uint8_t data[CAN_MAX_DATA_LENGTH] __attribute__((aligned(8)));
 };
 
+/// Acceptance filter: frames of the given id type with `(can_id & mask) == id` pass.
+struct CanFilter {
+  uint32_t id;
+  uint32_t mask;
+  bool use_extended_id;
+};
+
+/// Smallest single filter passing every frame any of `filters` of the given id type passes, if there is one.
+optional<CanFilter> merge_filters(const std::vector<CanFilter> &filters, bool use_extended_id);
+
 class Canbus : public Component {
  public:
   Canbus(){};
@@ -70,8 +80,12 @@ class Canbus : public Component {
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
   void loop() override;
 
+  void send_data(uint32_t can_id, bool use_extended_id, bool remote_transmission_request, const uint8_t *data,
+                 size_t size);
   void send_data(uint32_t can_id, bool use_extended_id, bool remote_transmission_request,
-                 const std::vector<uint8_t> &data);
+                 const std::vector<uint8_t> &data) {
+    this->send_data(can_id, use_extended_id, remote_transmission_request, data.data(), data.size());
+  }
   void send_data(uint32_t can_id, bool use_extended_id, const std::vector<uint8_t> &data) {
     // for backwards compatibility only
     this->send_data(can_id, use_extended_id, false, data);
@@ -84,14 +98,25 @@ class Canbus : public Component {
 
  protected:
   template<typename... Ts> friend class CanbusSendAction;
-  std::vector<CanbusTrigger *> triggers_{};
+  /// triggers without a mask, sorted by id (with bit 31 set for extended ids) for a binary search
+  std::vector<std::pair<uint32_t, CanbusTrigger *>> exact_triggers_{};
+  /// triggers with a mask, tested one by one, in the order they were added
+  std::vector<CanbusTrigger *> masked_triggers_{};
   uint32_t can_id_;
   bool use_extended_id_;
   CanSpeed bit_rate_;
-
-  virtual bool setup_internal();
-  virtual Error send_message(struct CanFrame *frame);
-  virtual Error read_message(struct CanFrame *frame);
+  bool filters_changed_{false};
+
+  virtual bool setup_internal() = 0;
+  virtual Error send_message(struct CanFrame *frame) = 0;
+  virtual Error read_message(struct CanFrame *frame) = 0;
+  /** Called with the filters of all triggers whenever they changed.
+   *
+   * Controllers with acceptance filters can restrict the frames they receive to the ones that pass any of them, the
+   * default receives all frames. It is not called before the first trigger was added.
+   */
+  virtual void set_filters(const std::vector<CanFilter> &filters) {}
+  void dispatch_(const CanFrame &frame);
 };
 
 template<typename... Ts> class CanbusSendAction : public Action<Ts...>, public Parented<Canbus> {
@@ -154,6 +179,7 @@ class CanbusTrigger : public Trigger<std::vector<uint8_t>, uint32_t, bool>, publ
   uint32_t can_id_mask_;
   bool use_extended_id_;
   optional<bool> remote_transmission_request_{};
+  uint16_t order_{0};  ///< the triggers of a frame fire in the order they were added
 };
 
 }  // namespace canbus
@@ -77,6 +77,11 @@ float CD74HC4067Sensor::sample() {
   return this->source_->sample();
 }
 
+size_t CD74HC4067Sensor::sample_block(float *buffer, size_t count) {
+  this->parent_->activate_pin(this->pin_);
+  return this->source_->sample_block(buffer, count);
+}
+
 void CD74HC4067Sensor::dump_config() {
   LOG_SENSOR(TAG, "CD74HC4067 Sensor", this);
   ESP_LOGCONFIG(TAG, "  Pin: %u", this->pin_);
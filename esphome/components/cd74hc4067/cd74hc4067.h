@@ -53,6 +53,7 @@ class CD74HC4067Sensor : public sensor::Sensor, public PollingComponent, public
   void set_source(voltage_sampler::VoltageSampler *source) { this->source_ = source; }
 
   float sample() override;
+  size_t sample_block(float *buffer, size_t count) override;
 
  protected:
   CD74HC4067Component *parent_;
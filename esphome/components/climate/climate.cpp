@@ -1,4 +1,5 @@
 #include "climate.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/macros.h"
 
 namespace esphome {
@@ -393,7 +394,7 @@ void Climate::save_state_() {
   this->rtc_.save(&state);
 }
 void Climate::publish_state() {
-  ESP_LOGD(TAG, "'%s' - Sending state:", this->name_.c_str());
+  ESP_LOGD(TAG, "'%s' - Sending state:", this->get_name().c_str());
   auto traits = this->get_traits();
 
   ESP_LOGD(TAG, "  Mode: %s", LOG_STR_ARG(climate_mode_to_string(this->mode)));
@@ -432,6 +433,7 @@ void Climate::publish_state() {
   }
 
   // Send state to frontend
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_CLIMATE, this->get_entity_index());
   this->state_callback_.call(*this);
   // Save state
   this->save_state_();
@@ -1,4 +1,5 @@
 #include "cover.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -167,7 +168,7 @@ void Cover::publish_state(bool save) {
   this->position = clamp(this->position, 0.0f, 1.0f);
   this->tilt = clamp(this->tilt, 0.0f, 1.0f);
 
-  ESP_LOGD(TAG, "'%s' - Publishing:", this->name_.c_str());
+  ESP_LOGD(TAG, "'%s' - Publishing:", this->get_name().c_str());
   auto traits = this->get_traits();
   if (traits.get_supports_position()) {
     ESP_LOGD(TAG, "  Position: %.0f%%", this->position * 100.0f);
@@ -185,6 +186,7 @@ void Cover::publish_state(bool save) {
   }
   ESP_LOGD(TAG, "  Current Operation: %s", cover_operation_to_str(this->current_operation));
 
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_COVER, this->get_entity_index());
   this->state_callback_.call();
 
   if (save) {
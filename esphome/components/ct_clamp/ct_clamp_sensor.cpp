@@ -1,5 +1,7 @@
 #include "ct_clamp_sensor.h"
 
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include <cmath>
 
@@ -8,6 +10,13 @@ namespace ct_clamp {
 
 static const char *const TAG = "ct_clamp";
 
+/// Maximum number of readings taken with a single sample_block() call.
+static const size_t MAX_BLOCK_SIZE = 64;
+/// Time in µs a block of readings may take, so a loop() iteration doesn't hold up the other components.
+static const uint32_t MAX_BLOCK_TIME = 1000;
+/// Time in ms after which both 50 Hz and 60 Hz currents repeat.
+static const uint32_t MAINS_CYCLE = 50;
+
 void CTClampSensor::dump_config() {
   LOG_SENSOR("", "CT Clamp Sensor", this);
   ESP_LOGCONFIG(TAG, "  Sample Duration: %.2fs", this->sample_duration_ / 1e3f);
@@ -15,15 +24,11 @@ void CTClampSensor::dump_config() {
 }
 
 void CTClampSensor::update() {
-  // Update only starts the sampling phase, in loop() the actual sampling is happening.
-
-  // Request a high loop() execution interval during sampling phase.
-  this->high_freq_.start();
+  // Update only starts the sampling phase, the readings are taken in blocks from the scheduler.
 
   // Set timeout for ending sampling phase
   this->set_timeout("read", this->sample_duration_, [this]() {
-    this->is_sampling_ = false;
-    this->high_freq_.stop();
+    this->cancel_timeout("sample");
 
     if (this->num_samples_ == 0) {
       // Shouldn't happen, but let's not crash if it does.
@@ -37,32 +42,57 @@ void CTClampSensor::update() {
     float rms_ac = 0;
     if (rms_ac_squared > 0)
       rms_ac = std::sqrt(rms_ac_squared);
-    ESP_LOGD(TAG, "'%s' - Raw AC Value: %.3fA after %d different samples (%d SPS)", this->name_.c_str(), rms_ac,
+    ESP_LOGD(TAG, "'%s' - Raw AC Value: %.3fA after %d different samples (%d SPS)", this->get_name().c_str(), rms_ac,
              this->num_samples_, 1000 * this->num_samples_ / this->sample_duration_);
     this->publish_state(rms_ac);
   });
 
   // Set sampling values
-  this->last_value_ = 0.0;
   this->num_samples_ = 0;
   this->sample_sum_ = 0.0f;
   this->sample_squared_sum_ = 0.0f;
-  this->is_sampling_ = true;
+  this->read_cycle_ms_ = 0;
+  this->schedule_block_();
 }
 
-void CTClampSensor::loop() {
-  if (!this->is_sampling_)
-    return;
+void CTClampSensor::schedule_block_() {
+  // Blocks of a fraction of the mains period, taken at a fixed pace, would keep reading the same part of it. The next
+  // block starts in the first millisecond of the mains cycle that hasn't been read yet, so the readings spread evenly.
+  const uint32_t now = millis();
+  uint32_t delay = App.get_loop_interval() / 2;
+  while ((this->read_cycle_ms_ & (1ULL << ((now + delay) % MAINS_CYCLE))) != 0)
+    delay++;
+  this->set_timeout("sample", delay, [this]() {
+    this->sample_block_();
+    this->schedule_block_();
+  });
+}
 
-  // Perform a single sample
-  float value = this->source_->sample();
-  if (std::isnan(value))
-    return;
+void CTClampSensor::sample_block_() {
+  float buffer[MAX_BLOCK_SIZE];
+  const uint32_t start_ms = millis();
+  const uint32_t start = micros();
+  const size_t count = this->source_->sample_block(buffer, this->block_size_);
+  for (size_t i = 0; i < count; i++)
+    this->add_sample_(buffer[i]);
+  const uint32_t block_time = micros() - start;
+
+  for (uint32_t ms = start_ms, end_ms = millis(); ms != end_ms + 1; ms++)
+    this->read_cycle_ms_ |= 1ULL << (ms % MAINS_CYCLE);
+  if (this->read_cycle_ms_ == (1ULL << MAINS_CYCLE) - 1)
+    this->read_cycle_ms_ = 0;
 
-  // Assuming a sine wave, avoid requesting values faster than the ADC can provide them
-  if (this->last_value_ == value)
+  // grow blocks for fast sources, slow sources (e.g. I2C ADCs) end up with a single reading per block
+  if (block_time < MAX_BLOCK_TIME / 2 && this->block_size_ < MAX_BLOCK_SIZE) {
+    this->block_size_ *= 2;
+  } else if (block_time > MAX_BLOCK_TIME && this->block_size_ > 1) {
+    this->block_size_ /= 2;
+  }
+}
+
+void CTClampSensor::add_sample_(float value) {
+  if (std::isnan(value))
     return;
-  this->last_value_ = value;
 
   this->num_samples_++;
   this->sample_sum_ += value;
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "esphome/core/component.h"
-#include "esphome/core/hal.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/voltage_sampler/voltage_sampler.h"
 
@@ -11,7 +10,6 @@ namespace ct_clamp {
 class CTClampSensor : public sensor::Sensor, public PollingComponent {
  public:
   void update() override;
-  void loop() override;
   void dump_config() override;
   float get_setup_priority() const override {
     // After the base sensor has been initialized
@@ -22,8 +20,12 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
   void set_source(voltage_sampler::VoltageSampler *source) { source_ = source; }
 
  protected:
-  /// High Frequency loop() requester used during sampling phase.
-  HighFrequencyLoopRequester high_freq_;
+  /// Schedule the next block of readings of the sampling phase.
+  void schedule_block_();
+  /// Take one block of readings and adapt the block size to the speed of the source.
+  void sample_block_();
+  /// Add a single reading to the sums.
+  void add_sample_(float value);
 
   /// Duration in ms of the sampling phase.
   uint32_t sample_duration_;
@@ -43,11 +45,13 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
    * https://en.wikipedia.org/wiki/Root_mean_square
    */
 
-  float last_value_ = 0.0f;
   float sample_sum_ = 0.0f;
   float sample_squared_sum_ = 0.0f;
   uint32_t num_samples_ = 0;
-  bool is_sampling_ = false;
+  /// Readings requested per sample_block() call, adapted to the speed of the source.
+  size_t block_size_ = 1;
+  /// Bit n is set once a block has been read in millisecond n of the mains cycle.
+  uint64_t read_cycle_ms_ = 0;
 };
 
 }  // namespace ct_clamp
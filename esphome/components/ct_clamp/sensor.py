@@ -28,7 +28,7 @@ CONFIG_SCHEMA = (
         {
             cv.Required(CONF_SENSOR): cv.use_id(voltage_sampler.VoltageSampler),
             cv.Optional(
-                CONF_SAMPLE_DURATION, default="200ms"
+                CONF_SAMPLE_DURATION, default="1s"
             ): cv.positive_time_period_milliseconds,
         }
     )
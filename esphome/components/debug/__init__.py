@@ -7,15 +7,33 @@ from esphome.const import (
     CONF_FREE,
     CONF_ID,
     CONF_LOOP_TIME,
+    PLATFORM_ESP32,
+    PLATFORM_HOST,
 )
 
 CODEOWNERS = ["@OttoWinter"]
 DEPENDENCIES = ["logger"]
 
 CONF_DEBUG_ID = "debug_id"
+CONF_HEAP_TRACKING = "heap_tracking"
 debug_ns = cg.esphome_ns.namespace("debug")
 DebugComponent = debug_ns.class_("DebugComponent", cg.PollingComponent)
 
+# the platforms where operator new can be replaced without clashing with the core
+HEAP_TRACKING_PLATFORMS = [PLATFORM_ESP32, PLATFORM_HOST]
+
+
+def validate_heap_tracking(value):
+    value = cv.boolean(value)
+    if value:
+        cv.only_on(HEAP_TRACKING_PLATFORMS)(value)
+    return value
+
+
+def enable_heap_tracking():
+    """Attribute heap allocations to the running component, see heap_tracker.h."""
+    cg.add_define("USE_HEAP_TRACKING")
+
 
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
@@ -36,6 +54,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_LOOP_TIME): cv.invalid(
                 "The 'loop_time' option has been moved to the 'debug' sensor component"
             ),
+            cv.Optional(CONF_HEAP_TRACKING, default=False): validate_heap_tracking,
         }
     ).extend(cv.polling_component_schema("60s")),
 )
@@ -44,3 +63,5 @@ CONFIG_SCHEMA = cv.All(
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
+    if config[CONF_HEAP_TRACKING]:
+        enable_heap_tracking()
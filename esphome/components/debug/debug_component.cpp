@@ -3,6 +3,7 @@
 #include <algorithm>
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/heap_tracker.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/version.h"
 #include <cinttypes>
@@ -49,6 +50,9 @@ static uint32_t get_free_heap() {
   return rp2040.getFreeHeap();
 #elif defined(USE_LIBRETINY)
   return lt_heap_get_free();
+#elif defined(USE_HOST)
+  // the heap of a process has no fixed size, heap_tracking reports what the components use
+  return 0;
 #endif
 }
 
@@ -72,6 +76,9 @@ void DebugComponent::dump_config() {
   LOG_SENSOR("  ", "Heap fragmentation", this->fragmentation_sensor_);
 #endif  // defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
 #endif  // USE_SENSOR
+#ifdef USE_HEAP_TRACKING
+  ESP_LOGCONFIG(TAG, "  Heap tracking: enabled");
+#endif  // USE_HEAP_TRACKING
 
   ESP_LOGD(TAG, "ESPHome version %s", ESPHOME_VERSION);
   device_info += ESPHOME_VERSION;
@@ -439,8 +446,39 @@ void DebugComponent::update() {
     this->psram_sensor_->publish_state(heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
   }
 #endif  // USE_ESP32
+
+#ifdef USE_HEAP_TRACKING
+  for (auto &sensors : this->component_heap_sensors_) {
+    const HeapStats &stats = global_heap_tracker.get_stats(sensors.component);
+    if (sensors.live_bytes != nullptr)
+      sensors.live_bytes->publish_state(stats.live_bytes);
+    if (sensors.peak_bytes != nullptr)
+      sensors.peak_bytes->publish_state(stats.peak_bytes);
+    if (sensors.allocations != nullptr)
+      sensors.allocations->publish_state(stats.allocations);
+  }
+#endif  // USE_HEAP_TRACKING
 #endif  // USE_SENSOR
+
+#ifdef USE_HEAP_TRACKING
+  this->log_heap_usage_();
+#endif  // USE_HEAP_TRACKING
+}
+
+#ifdef USE_HEAP_TRACKING
+void DebugComponent::log_heap_usage_() {
+#ifdef ESPHOME_LOG_HAS_DEBUG
+  ESP_LOGD(TAG, "Heap usage by component:");
+  global_heap_tracker.for_each([](const char *source, const HeapStats &stats) {
+    // components that never allocated only make the list longer
+    if (stats.allocations == 0)
+      return;
+    ESP_LOGD(TAG, "  %s: %" PRIu32 " B in %" PRIu32 " allocations (peak %" PRIu32 " B, %" PRIu32 " allocations so far)",
+             source, stats.live_bytes, stats.live_allocations, stats.peak_bytes, stats.allocations);
+  });
+#endif
 }
+#endif  // USE_HEAP_TRACKING
 
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
@@ -5,6 +5,8 @@
 #include "esphome/core/macros.h"
 #include "esphome/core/helpers.h"
 
+#include <vector>
+
 #ifdef USE_SENSOR
 #include "esphome/components/sensor/sensor.h"
 #endif
@@ -36,8 +38,18 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_ESP32
   void set_psram_sensor(sensor::Sensor *psram_sensor) { this->psram_sensor_ = psram_sensor; }
 #endif  // USE_ESP32
+#ifdef USE_HEAP_TRACKING
+  void add_component_heap_sensors(Component *component, sensor::Sensor *live_bytes, sensor::Sensor *peak_bytes,
+                                  sensor::Sensor *allocations) {
+    this->component_heap_sensors_.push_back({component, live_bytes, peak_bytes, allocations});
+  }
+#endif  // USE_HEAP_TRACKING
 #endif  // USE_SENSOR
  protected:
+#ifdef USE_HEAP_TRACKING
+  void log_heap_usage_();
+#endif  // USE_HEAP_TRACKING
+
   uint32_t free_heap_{};
 
 #ifdef USE_SENSOR
@@ -53,6 +65,15 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_ESP32
   sensor::Sensor *psram_sensor_{nullptr};
 #endif  // USE_ESP32
+#ifdef USE_HEAP_TRACKING
+  struct ComponentHeapSensors {
+    Component *component;
+    sensor::Sensor *live_bytes;
+    sensor::Sensor *peak_bytes;
+    sensor::Sensor *allocations;
+  };
+  std::vector<ComponentHeapSensors> component_heap_sensors_;
+#endif  // USE_HEAP_TRACKING
 #endif  // USE_SENSOR
 
 #ifdef USE_TEXT_SENSOR
@@ -5,19 +5,57 @@ from esphome.const import (
     CONF_FREE,
     CONF_FRAGMENTATION,
     CONF_BLOCK,
+    CONF_COMPONENT_ID,
     CONF_LOOP_TIME,
     ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
     UNIT_MILLISECOND,
     UNIT_PERCENT,
     UNIT_BYTES,
     ICON_COUNTER,
     ICON_TIMER,
 )
-from . import CONF_DEBUG_ID, DebugComponent
+from . import (
+    CONF_DEBUG_ID,
+    HEAP_TRACKING_PLATFORMS,
+    DebugComponent,
+    enable_heap_tracking,
+)
 
 DEPENDENCIES = ["debug"]
 
 CONF_PSRAM = "psram"
+CONF_COMPONENT_HEAP = "component_heap"
+CONF_LIVE_BYTES = "live_bytes"
+CONF_PEAK_BYTES = "peak_bytes"
+CONF_ALLOCATIONS = "allocations"
+
+COMPONENT_HEAP_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_COMPONENT_ID): cv.use_id(cg.Component),
+        cv.Optional(CONF_LIVE_BYTES): sensor.sensor_schema(
+            unit_of_measurement=UNIT_BYTES,
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_PEAK_BYTES): sensor.sensor_schema(
+            unit_of_measurement=UNIT_BYTES,
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_ALLOCATIONS): sensor.sensor_schema(
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
 
 CONFIG_SCHEMA = {
     cv.GenerateID(CONF_DEBUG_ID): cv.use_id(DebugComponent),
@@ -59,6 +97,10 @@ CONFIG_SCHEMA = {
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
     ),
+    cv.Optional(CONF_COMPONENT_HEAP): cv.All(
+        cv.only_on(HEAP_TRACKING_PLATFORMS),
+        cv.ensure_list(COMPONENT_HEAP_SCHEMA),
+    ),
 }
 
 
@@ -84,3 +126,15 @@ async def to_code(config):
     if psram_conf := config.get(CONF_PSRAM):
         sens = await sensor.new_sensor(psram_conf)
         cg.add(debug_component.set_psram_sensor(sens))
+
+    if component_heap_conf := config.get(CONF_COMPONENT_HEAP):
+        enable_heap_tracking()
+        for conf in component_heap_conf:
+            component = await cg.get_variable(conf[CONF_COMPONENT_ID])
+            sensors = []
+            for key in (CONF_LIVE_BYTES, CONF_PEAK_BYTES, CONF_ALLOCATIONS):
+                if key in conf:
+                    sensors.append(await sensor.new_sensor(conf[key]))
+                else:
+                    sensors.append(cg.nullptr)
+            cg.add(debug_component.add_component_heap_sensors(component, *sensors))
@@ -31,17 +31,24 @@ void DHT::dump_config() {
 }
 
 void DHT::update() {
-  float temperature, humidity;
-  bool success;
-  if (this->model_ == DHT_MODEL_AUTO_DETECT) {
+  bool auto_detect = this->model_ == DHT_MODEL_AUTO_DETECT;
+  if (auto_detect)
     this->model_ = DHT_MODEL_DHT22;
-    success = this->read_sensor_(&temperature, &humidity, false);
-    if (!success) {
-      this->model_ = DHT_MODEL_DHT11;
-      return;
-    }
-  } else {
-    success = this->read_sensor_(&temperature, &humidity, true);
+  uint32_t wait = this->start_signal_();
+  if (wait == 0) {
+    this->read_and_publish_(auto_detect);
+    return;
+  }
+  // keep the line low for the start signal without blocking the loop
+  this->deferred_read_.read_after(wait, [this, auto_detect]() { this->read_and_publish_(auto_detect); });
+}
+
+void DHT::read_and_publish_(bool auto_detect) {
+  float temperature, humidity;
+  bool success = this->read_sensor_(&temperature, &humidity, !auto_detect);
+  if (auto_detect && !success) {
+    this->model_ = DHT_MODEL_DHT11;
+    return;
   }
 
   if (success) {
@@ -71,31 +78,33 @@ void DHT::set_dht_model(DHTModel model) {
   this->model_ = model;
   this->is_auto_detect_ = model == DHT_MODEL_AUTO_DETECT;
 }
-bool HOT IRAM_ATTR DHT::read_sensor_(float *temperature, float *humidity, bool report_errors) {
-  *humidity = NAN;
-  *temperature = NAN;
-
-  int error_code = 0;
-  int8_t i = 0;
-  uint8_t data[5] = {0, 0, 0, 0, 0};
-
+uint32_t DHT::start_signal_() {
   this->pin_->digital_write(false);
   this->pin_->pin_mode(gpio::FLAG_OUTPUT);
   this->pin_->digital_write(false);
 
   if (this->model_ == DHT_MODEL_DHT11) {
-    delayMicroseconds(18000);
+    return 18;
   } else if (this->model_ == DHT_MODEL_SI7021) {
+    // the high pulse has to follow right away
     delayMicroseconds(500);
     this->pin_->digital_write(true);
     delayMicroseconds(40);
+    return 0;
   } else if (this->model_ == DHT_MODEL_DHT22_TYPE2) {
-    delayMicroseconds(2000);
-  } else if (this->model_ == DHT_MODEL_AM2120 || this->model_ == DHT_MODEL_AM2302) {
-    delayMicroseconds(1000);
-  } else {
-    delayMicroseconds(800);
+    return 2;
   }
+  // 0.8 ms minimum, AM2120 and AM2302 need 1 ms
+  return 1;
+}
+bool HOT IRAM_ATTR DHT::read_sensor_(float *temperature, float *humidity, bool report_errors) {
+  *humidity = NAN;
+  *temperature = NAN;
+
+  int error_code = 0;
+  int8_t i = 0;
+  uint8_t data[5] = {0, 0, 0, 0, 0};
+
   this->pin_->pin_mode(gpio::FLAG_INPUT | gpio::FLAG_PULLUP);
 
   {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/deferred_read.h"
 #include "esphome/core/hal.h"
 #include "esphome/components/sensor/sensor.h"
 
@@ -52,13 +53,17 @@ class DHT : public PollingComponent {
   float get_setup_priority() const override;
 
  protected:
+  /// Pull the line low to request a reading, returns how long (in ms) it has to stay low before reading.
+  uint32_t start_signal_();
   bool read_sensor_(float *temperature, float *humidity, bool report_errors);
+  void read_and_publish_(bool auto_detect);
 
   InternalGPIOPin *pin_;
   DHTModel model_{DHT_MODEL_AUTO_DETECT};
   bool is_auto_detect_{false};
   sensor::Sensor *temperature_sensor_{nullptr};
   sensor::Sensor *humidity_sensor_{nullptr};
+  DeferredRead deferred_read_{this, "read"};
 };
 
 }  // namespace dht
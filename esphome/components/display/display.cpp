@@ -39,11 +39,20 @@ void HOT Display::line(int x1, int y1, int x2, int y2, Color color) {
 void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, ColorOrder order,
                              ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) {
   size_t line_stride = x_offset + w + x_pad;  // length of each source line in pixels
+  int clip_x = x_start, clip_y = y_start, clip_w = w, clip_h = h;
+  if (!this->clip_rect(clip_x, clip_y, clip_w, clip_h))
+    return;
+  // skip the source pixels that are clipped away
+  x_offset += clip_x - x_start;
+  y_offset += clip_y - y_start;
+
+  Color row[DISPLAY_ROW_CHUNK_SIZE];
   uint32_t color_value;
-  for (int y = 0; y != h; y++) {
+  for (int y = 0; y != clip_h; y++) {
     size_t source_idx = (y_offset + y) * line_stride + x_offset;
     size_t source_idx_mod;
-    for (int x = 0; x != w; x++, source_idx++) {
+    int chunk = 0;
+    for (int x = 0; x != clip_w; x++, source_idx++) {
       switch (bitness) {
         default:
           color_value = ptr[source_idx];
@@ -65,16 +74,25 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
           }
           break;
       }
-      this->draw_pixel_at(x + x_start, y + y_start, ColorUtil::to_color(color_value, order, bitness));
+      row[chunk++] = ColorUtil::to_color(color_value, order, bitness);
+      if (chunk == DISPLAY_ROW_CHUNK_SIZE || x == clip_w - 1) {
+        this->draw_row_at(clip_x + x + 1 - chunk, clip_y + y, chunk, row);
+        chunk = 0;
+      }
     }
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
+void HOT Display::fill_row_at(int x, int y, int w, Color color) {
+  for (int i = x; i < x + w; i++)
     this->draw_pixel_at(i, y, color);
 }
+void HOT Display::draw_row_at(int x, int y, int w, const Color *colors) {
+  for (int i = 0; i < w; i++)
+    this->draw_pixel_at(x + i, y, colors[i]);
+}
+
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_row_at(x, y, width, color); }
 void HOT Display::vertical_line(int x, int y, int height, Color color) {
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = y; i < y + height; i++)
@@ -492,6 +510,25 @@ bool Display::clip(int x, int y) {
     return false;
   return true;
 }
+bool Display::clip_rect(int &x, int &y, int &w, int &h) {
+  int x2 = std::min(x + w, this->get_width());
+  int y2 = std::min(y + h, this->get_height());
+  x = std::max(x, 0);
+  y = std::max(y, 0);
+
+  // match the per-pixel Rect::inside() test, which treats an unset rectangle as unclipped and includes x2/y2
+  const Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    x = std::max(x, (int) clipping.x);
+    y = std::max(y, (int) clipping.y);
+    x2 = std::min(x2, clipping.x2() + 1);
+    y2 = std::min(y2, clipping.y2() + 1);
+  }
+
+  w = x2 - x;
+  h = y2 - y;
+  return w > 0 && h > 0;
+}
 bool Display::clamp_x_(int x, int w, int &min_x, int &max_x) {
   min_x = std::max(x, 0);
   max_x = std::min(x + w, this->get_width());
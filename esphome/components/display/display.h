@@ -155,6 +155,9 @@ extern const Color COLOR_OFF;
 /// Turn the pixel ON.
 extern const Color COLOR_ON;
 
+/// Number of pixels decoded on the stack before they are handed to Display::draw_row_at().
+static const int DISPLAY_ROW_CHUNK_SIZE = 32;
+
 class BaseImage {
  public:
   virtual void draw(int x, int y, Display *display, Color color_on, Color color_off) = 0;
@@ -214,6 +217,28 @@ class Display : public PollingComponent {
     this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
   }
 
+  /** Fill a horizontal run of `w` pixels starting at [x,y] with a single color.
+   * This is the primitive used by lines, rectangles, glyphs and binary images. The naive implementation
+   * calls draw_pixel_at() for every pixel; buffered displays override it to clip and rotate only once per run.
+   */
+  virtual void fill_row_at(int x, int y, int w, Color color);
+
+  /** Draw a horizontal run of `w` pixels starting at [x,y], taking one color per pixel from `colors`.
+   * The naive implementation calls draw_pixel_at() for every pixel; buffered displays override it to clip
+   * and rotate only once per run.
+   */
+  virtual void draw_row_at(int x, int y, int w, const Color *colors);
+
+  /** Intersect the rectangle [x,y,w,h] with the screen and the active clipping region.
+   *
+   * @param x The x coordinate of the upper left corner, adjusted to the first visible column.
+   * @param y The y coordinate of the upper left corner, adjusted to the first visible row.
+   * @param w The width of the rectangle, adjusted to the visible width.
+   * @param h The height of the rectangle, adjusted to the visible height.
+   * @return false if no part of the rectangle is visible.
+   */
+  bool clip_rect(int &x, int &y, int &w, int &h);
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
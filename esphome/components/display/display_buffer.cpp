@@ -10,6 +10,68 @@ namespace display {
 
 static const char *const TAG = "display";
 
+static inline uint32_t rect_area(const Rect &rect) { return uint32_t(rect.w) * uint32_t(rect.h); }
+static inline Rect rect_union(const Rect &a, const Rect &b) {
+  int16_t x = std::min(a.x, b.x);
+  int16_t y = std::min(a.y, b.y);
+  return Rect(x, y, std::max(a.x2(), b.x2()) - x, std::max(a.y2(), b.y2()) - y);
+}
+
+void HOT DirtyRegionTracker::add(int x1, int y1, int x2, int y2) {
+  Rect rect(x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+  if (rect.w <= 0 || rect.h <= 0)
+    return;
+
+  // fast path for the common case of drawing inside an already dirty area
+  for (uint8_t i = 0; i < this->count_; i++) {
+    const Rect &region = this->regions_[i];
+    if (rect.x >= region.x && rect.y >= region.y && rect.x2() <= region.x2() && rect.y2() <= region.y2())
+      return;
+  }
+
+  // absorb every region that is cheaper to send together with the new one; repeat since the union grows
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < this->count_; i++) {
+      Rect joined = rect_union(rect, this->regions_[i]);
+      if (rect_area(joined) <= rect_area(rect) + rect_area(this->regions_[i]) + MERGE_SLACK) {
+        rect = joined;
+        this->regions_[i] = this->regions_[--this->count_];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  if (this->count_ < MAX_REGIONS) {
+    this->regions_[this->count_++] = rect;
+    return;
+  }
+
+  // no room left, grow the region that needs the fewest extra pixels to cover the new one
+  uint8_t best = 0;
+  uint32_t best_growth = UINT32_MAX;
+  for (uint8_t i = 0; i < this->count_; i++) {
+    uint32_t growth = rect_area(rect_union(rect, this->regions_[i])) - rect_area(this->regions_[i]);
+    if (growth < best_growth) {
+      best_growth = growth;
+      best = i;
+    }
+  }
+  Rect joined = rect_union(rect, this->regions_[best]);
+  this->regions_[best] = this->regions_[--this->count_];
+  // the grown region may now overlap others, so add it again
+  this->add(joined.x, joined.y, joined.x2() - 1, joined.y2() - 1);
+}
+
+uint32_t DirtyRegionTracker::area() const {
+  uint32_t area = 0;
+  for (uint8_t i = 0; i < this->count_; i++)
+    area += rect_area(this->regions_[i]);
+  return area;
+}
+
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
   this->buffer_ = allocator.allocate(buffer_length);
@@ -18,6 +80,26 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
     return;
   }
   this->clear();
+  // the display memory does not match the freshly cleared buffer yet
+  this->mark_all_dirty_();
+}
+
+void DisplayBuffer::flush_dirty_regions_() {
+  if (this->dirty_regions_.empty())
+    return;
+  size_t regions = this->dirty_regions_.size();
+
+  uint32_t bytes = 0;
+  for (size_t i = 0; i < regions; i++) {
+    bytes += this->flush_region_internal(this->dirty_regions_[i]);
+    App.feed_wdt();
+  }
+  this->dirty_regions_.clear();
+
+  this->last_flush_bytes_ = bytes;
+  this->total_flush_bytes_ += bytes;
+  this->flush_count_++;
+  ESP_LOGV(TAG, "Flushed %zu regions, %u bytes", regions, (unsigned) bytes);
 }
 
 int DisplayBuffer::get_width() {
@@ -68,5 +150,69 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+void HOT DisplayBuffer::fill_row_at(int x, int y, int w, Color color) {
+  int h = 1;
+  if (!this->clip_rect(x, y, w, h))
+    return;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->fill_absolute_row_internal(x, y, w, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->fill_absolute_row_internal(this->get_width_internal() - x - w, this->get_height_internal() - y - 1, w,
+                                       color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      // a row becomes a column of the internal buffer
+      for (int i = 0; i < w; i++)
+        this->draw_absolute_pixel_internal(this->get_width_internal() - y - 1, x + i, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      for (int i = 0; i < w; i++)
+        this->draw_absolute_pixel_internal(y, this->get_height_internal() - x - i - 1, color);
+      break;
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::draw_row_at(int x, int y, int w, const Color *colors) {
+  int clip_x = x, clip_y = y, h = 1;
+  if (!this->clip_rect(clip_x, clip_y, w, h))
+    return;
+  colors += clip_x - x;
+  x = clip_x;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->draw_absolute_row_internal(x, y, w, colors);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      for (int i = 0; i < w; i++)
+        this->draw_absolute_pixel_internal(this->get_width_internal() - x - i - 1, this->get_height_internal() - y - 1,
+                                           colors[i]);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      for (int i = 0; i < w; i++)
+        this->draw_absolute_pixel_internal(this->get_width_internal() - y - 1, x + i, colors[i]);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      for (int i = 0; i < w; i++)
+        this->draw_absolute_pixel_internal(y, this->get_height_internal() - x - i - 1, colors[i]);
+      break;
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::fill_absolute_row_internal(int x, int y, int w, Color color) {
+  for (int i = x; i < x + w; i++)
+    this->draw_absolute_pixel_internal(i, y, color);
+}
+
+void HOT DisplayBuffer::draw_absolute_row_internal(int x, int y, int w, const Color *colors) {
+  for (int i = 0; i < w; i++)
+    this->draw_absolute_pixel_internal(x + i, y, colors[i]);
+}
+
 }  // namespace display
 }  // namespace esphome
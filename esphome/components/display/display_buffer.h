@@ -12,6 +12,32 @@
 namespace esphome {
 namespace display {
 
+/** Tracks which parts of a display buffer changed since they were last sent to the display.
+ *
+ * Changes are kept as a short list of rectangles in unrotated buffer coordinates. A new rectangle is merged
+ * with every tracked rectangle where sending the union costs little more than sending both, and when the list is
+ * full it is merged into the rectangle that grows the least. The tracked area therefore always covers all changes.
+ */
+class DirtyRegionTracker {
+ public:
+  static const uint8_t MAX_REGIONS = 8;
+  /// Pixels that may be sent needlessly to save a separate transfer when merging two regions.
+  static const uint32_t MERGE_SLACK = 256;
+
+  /// Add the region spanning [x1,y1] to [x2,y2], both inclusive.
+  void add(int x1, int y1, int x2, int y2);
+  void clear() { this->count_ = 0; }
+  bool empty() const { return this->count_ == 0; }
+  size_t size() const { return this->count_; }
+  const Rect &operator[](size_t index) const { return this->regions_[index]; }
+  /// Total number of pixels covered by the tracked regions.
+  uint32_t area() const;
+
+ protected:
+  Rect regions_[MAX_REGIONS];
+  uint8_t count_{0};
+};
+
 class DisplayBuffer : public Display {
  public:
   /// Get the width of the image in pixels with rotation applied.
@@ -22,15 +48,55 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  /// Fill a horizontal run of pixels, clipping and rotating the run once rather than per pixel.
+  void fill_row_at(int x, int y, int w, Color color) override;
+  /// Draw a horizontal run of pixels, clipping and rotating the run once rather than per pixel.
+  void draw_row_at(int x, int y, int w, const Color *colors) override;
+
   virtual int get_height_internal() = 0;
   virtual int get_width_internal() = 0;
 
+  /// Number of bytes sent to the display by the last flush of the dirty regions.
+  uint32_t get_last_flush_bytes() const { return this->last_flush_bytes_; }
+  /// Number of bytes sent to the display by all flushes of the dirty regions.
+  uint64_t get_total_flush_bytes() const { return this->total_flush_bytes_; }
+  /// Number of flushes of the dirty regions that sent any data.
+  uint32_t get_flush_count() const { return this->flush_count_; }
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /** Fill `w` pixels of the unrotated buffer starting at [x,y], already clipped to the buffer.
+   * The default implementation calls draw_absolute_pixel_internal() for every pixel; drivers can override it
+   * to write whole spans of their buffer at once.
+   */
+  virtual void fill_absolute_row_internal(int x, int y, int w, Color color);
+  /** Draw `w` pixels of the unrotated buffer starting at [x,y], already clipped to the buffer.
+   * The default implementation calls draw_absolute_pixel_internal() for every pixel; drivers can override it
+   * to convert whole spans into their buffer at once.
+   */
+  virtual void draw_absolute_row_internal(int x, int y, int w, const Color *colors);
+
   void init_internal_(uint32_t buffer_length);
 
+  /// Mark the region spanning [x1,y1] to [x2,y2] (unrotated buffer coordinates, inclusive) as changed.
+  void mark_dirty_(int x1, int y1, int x2, int y2) { this->dirty_regions_.add(x1, y1, x2, y2); }
+  /// Mark the whole buffer as changed, e.g. because the display contents are unknown.
+  void mark_all_dirty_() { this->mark_dirty_(0, 0, this->get_width_internal() - 1, this->get_height_internal() - 1); }
+  /// Send every dirty region to the display with flush_region_internal() and reset the tracker.
+  void flush_dirty_regions_();
+  /** Driver hook to send a region of the buffer (unrotated buffer coordinates) to the display.
+   *
+   * Drivers using mark_dirty_() and flush_dirty_regions_() must override this.
+   * @return The number of bytes transferred to the display.
+   */
+  virtual size_t flush_region_internal(const Rect &region) { return 0; }
+
   uint8_t *buffer_{nullptr};
+  DirtyRegionTracker dirty_regions_;
+  uint32_t last_flush_bytes_{0};
+  uint64_t total_flush_bytes_{0};
+  uint32_t flush_count_{0};
 };
 
 }  // namespace display
@@ -77,10 +77,7 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
       break;
 
     case E131_RGBW:
-      for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[1], input_data[2], input_data[3]));
-      }
+      it->set_from_bytes(output_offset, input_data, output_end - output_offset, 4);
       break;
   }
 
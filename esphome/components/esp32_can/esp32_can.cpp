@@ -67,33 +67,71 @@ static bool get_bitrate(canbus::CanSpeed bitrate, twai_timing_config_t *t_config
 }
 
 bool ESP32Can::setup_internal() {
+  if (!this->start_driver_()) {
+    this->mark_failed();
+    return false;
+  }
+  return true;
+}
+
+bool ESP32Can::start_driver_() {
   twai_general_config_t g_config =
       TWAI_GENERAL_CONFIG_DEFAULT((gpio_num_t) this->tx_, (gpio_num_t) this->rx_, TWAI_MODE_NORMAL);
   twai_filter_config_t f_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+  f_config.acceptance_code = this->acceptance_code_;
+  f_config.acceptance_mask = this->acceptance_mask_;
   twai_timing_config_t t_config;
 
   if (!get_bitrate(this->bit_rate_, &t_config)) {
     // invalid bit rate
-    this->mark_failed();
     return false;
   }
 
   // Install TWAI driver
   if (twai_driver_install(&g_config, &t_config, &f_config) != ESP_OK) {
     // Failed to install driver
-    this->mark_failed();
     return false;
   }
 
   // Start TWAI driver
   if (twai_start() != ESP_OK) {
     // Failed to start driver
-    this->mark_failed();
     return false;
   }
   return true;
 }
 
+void ESP32Can::set_filters(const std::vector<canbus::CanFilter> &filters) {
+  auto standard = canbus::merge_filters(filters, false);
+  auto extended = canbus::merge_filters(filters, true);
+  // in single filter mode the same code and mask are applied to the identifiers of both frame types, so triggers for
+  // both keep accepting all frames
+  uint32_t code = 0, mask = 0xFFFFFFFF;
+  if (standard.has_value() && !extended.has_value()) {
+    // bits 31-21: identifier, bit 20: RTR, bits 15-0: first two data bytes
+    code = standard->id << 21;
+    mask = ~(standard->mask << 21);
+  } else if (extended.has_value() && !standard.has_value()) {
+    // bits 31-3: identifier, bit 2: RTR
+    code = extended->id << 3;
+    mask = ~(extended->mask << 3);
+  }
+  if (code == this->acceptance_code_ && mask == this->acceptance_mask_)
+    return;
+  this->acceptance_code_ = code;
+  this->acceptance_mask_ = mask;
+
+  // the filter can only be changed by installing the driver again
+  twai_stop();
+  twai_driver_uninstall();
+  if (!this->start_driver_()) {
+    ESP_LOGE(TAG, "Restarting the driver with the new acceptance filter failed");
+    this->mark_failed();
+    return;
+  }
+  ESP_LOGD(TAG, "Acceptance filter: code=0x%08" PRIx32 " mask=0x%08" PRIx32, code, mask);
+}
+
 canbus::Error ESP32Can::send_message(struct canbus::CanFrame *frame) {
   if (frame->can_data_length_code > canbus::CAN_MAX_DATA_LENGTH) {
     return canbus::ERROR_FAILTX;
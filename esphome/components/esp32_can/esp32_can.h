@@ -18,9 +18,13 @@ class ESP32Can : public canbus::Canbus {
   bool setup_internal() override;
   canbus::Error send_message(struct canbus::CanFrame *frame) override;
   canbus::Error read_message(struct canbus::CanFrame *frame) override;
+  void set_filters(const std::vector<canbus::CanFilter> &filters) override;
+  bool start_driver_();
 
   int rx_{-1};
   int tx_{-1};
+  uint32_t acceptance_code_{0};
+  uint32_t acceptance_mask_{0xFFFFFFFF};
 };
 
 }  // namespace esp32_can
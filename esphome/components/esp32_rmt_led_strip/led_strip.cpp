@@ -126,8 +126,8 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
   this->status_clear_warning();
 }
 
-light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
-  int32_t r = 0, g = 0, b = 0;
+bool ESP32RMTLEDStripLightOutput::get_pixel_layout_(light::AddressablePixelLayout &layout) const {
+  uint8_t r = 0, g = 0, b = 0;
   switch (this->rgb_order_) {
     case ORDER_RGB:
       r = 0;
@@ -160,11 +160,24 @@ light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index
       b = 0;
       break;
   }
-  uint8_t multiplier = this->is_rgbw_ ? 4 : 3;
-  return {this->buf_ + (index * multiplier) + r,
-          this->buf_ + (index * multiplier) + g,
-          this->buf_ + (index * multiplier) + b,
-          this->is_rgbw_ ? this->buf_ + (index * multiplier) + 3 : nullptr,
+  layout.pixels = this->buf_;
+  layout.stride = this->is_rgbw_ ? 4 : 3;
+  layout.offsets[0] = r;
+  layout.offsets[1] = g;
+  layout.offsets[2] = b;
+  layout.offsets[3] = 3;
+  layout.has_white = this->is_rgbw_;
+  return true;
+}
+
+light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
+  light::AddressablePixelLayout layout;
+  this->get_pixel_layout_(layout);
+  uint8_t *pixel = layout.pixels + index * layout.stride;
+  return {pixel + layout.offsets[0],
+          pixel + layout.offsets[1],
+          pixel + layout.offsets[2],
+          layout.has_white ? pixel + layout.offsets[3] : nullptr,
           &this->effect_data_[index],
           &this->correction_};
 }
@@ -1,4 +1,5 @@
 #include "fan.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -117,7 +118,7 @@ void Fan::add_on_state_callback(std::function<void()> &&callback) { this->state_
 void Fan::publish_state() {
   auto traits = this->get_traits();
 
-  ESP_LOGD(TAG, "'%s' - Sending state:", this->name_.c_str());
+  ESP_LOGD(TAG, "'%s' - Sending state:", this->get_name().c_str());
   ESP_LOGD(TAG, "  State: %s", ONOFF(this->state));
   if (traits.supports_speed()) {
     ESP_LOGD(TAG, "  Speed: %d", this->speed);
@@ -131,6 +132,7 @@ void Fan::publish_state() {
   if (traits.supports_preset_modes() && !this->preset_mode.empty()) {
     ESP_LOGD(TAG, "  Preset Mode: %s", this->preset_mode.c_str());
   }
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_FAN, this->get_entity_index());
   this->state_callback_.call();
   this->save_state_();
 }
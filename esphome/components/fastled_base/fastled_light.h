@@ -228,6 +228,15 @@ class FastLEDLightOutput : public light::AddressableLight {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
   }
+  bool get_pixel_layout_(light::AddressablePixelLayout &layout) const override {
+    layout.pixels = reinterpret_cast<uint8_t *>(this->leds_);
+    layout.stride = sizeof(CRGB);
+    layout.offsets[0] = 0;
+    layout.offsets[1] = 1;
+    layout.offsets[2] = 2;
+    layout.has_white = false;
+    return true;
+  }
 
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
@@ -91,7 +91,7 @@ void FeedbackCover::set_open_sensor(binary_sensor::BinarySensor *open_feedback)
 
   // setup callbacks to react to sensor changes
   open_feedback->add_on_state_callback([this](bool state) {
-    ESP_LOGD(TAG, "'%s' - Open feedback '%s'.", this->name_.c_str(), state ? "STARTED" : "ENDED");
+    ESP_LOGD(TAG, "'%s' - Open feedback '%s'.", this->get_name().c_str(), state ? "STARTED" : "ENDED");
     this->recompute_position_();
     if (!state && this->infer_endstop_ && this->current_trigger_operation_ == COVER_OPERATION_OPENING) {
       this->endstop_reached_(true);
@@ -104,7 +104,7 @@ void FeedbackCover::set_close_sensor(binary_sensor::BinarySensor *close_feedback
   this->close_feedback_ = close_feedback;
 
   close_feedback->add_on_state_callback([this](bool state) {
-    ESP_LOGD(TAG, "'%s' - Close feedback '%s'.", this->name_.c_str(), state ? "STARTED" : "ENDED");
+    ESP_LOGD(TAG, "'%s' - Close feedback '%s'.", this->get_name().c_str(), state ? "STARTED" : "ENDED");
     this->recompute_position_();
     if (!state && this->infer_endstop_ && this->current_trigger_operation_ == COVER_OPERATION_CLOSING) {
       this->endstop_reached_(false);
@@ -142,7 +142,8 @@ void FeedbackCover::endstop_reached_(bool open_endstop) {
   // from a position slightly past the endpoint
   if (this->current_trigger_operation_ == (open_endstop ? COVER_OPERATION_OPENING : COVER_OPERATION_CLOSING)) {
     float dur = (now - this->start_dir_time_) / 1e3f;
-    ESP_LOGD(TAG, "'%s' - %s endstop reached. Took %.1fs.", this->name_.c_str(), open_endstop ? "Open" : "Close", dur);
+    ESP_LOGD(TAG, "'%s' - %s endstop reached. Took %.1fs.", this->get_name().c_str(), open_endstop ? "Open" : "Close",
+             dur);
 
     // if there is no external mechanism, stop the cover
     if (!this->has_built_in_endstop_) {
@@ -188,7 +189,7 @@ void FeedbackCover::set_close_obstacle_sensor(binary_sensor::BinarySensor *close
   close_obstacle->add_on_state_callback([this](bool state) {
     if (state && (this->current_operation == COVER_OPERATION_CLOSING ||
                   this->current_trigger_operation_ == COVER_OPERATION_CLOSING)) {
-      ESP_LOGD(TAG, "'%s' - Close obstacle detected.", this->name_.c_str());
+      ESP_LOGD(TAG, "'%s' - Close obstacle detected.", this->get_name().c_str());
       this->start_direction_(COVER_OPERATION_IDLE);
 
       if (this->obstacle_rollback_) {
@@ -205,7 +206,7 @@ void FeedbackCover::set_open_obstacle_sensor(binary_sensor::BinarySensor *open_o
   open_obstacle->add_on_state_callback([this](bool state) {
     if (state && (this->current_operation == COVER_OPERATION_OPENING ||
                   this->current_trigger_operation_ == COVER_OPERATION_OPENING)) {
-      ESP_LOGD(TAG, "'%s' - Open obstacle detected.", this->name_.c_str());
+      ESP_LOGD(TAG, "'%s' - Open obstacle detected.", this->get_name().c_str());
       this->start_direction_(COVER_OPERATION_IDLE);
 
       if (this->obstacle_rollback_) {
@@ -237,7 +238,7 @@ void FeedbackCover::loop() {
         this->start_direction_(COVER_OPERATION_IDLE);
       }
     } else if (now - this->start_dir_time_ > this->max_duration_) {
-      ESP_LOGD(TAG, "'%s' - Max duration reached. Stopping cover.", this->name_.c_str());
+      ESP_LOGD(TAG, "'%s' - Max duration reached. Stopping cover.", this->get_name().c_str());
       this->start_direction_(COVER_OPERATION_IDLE);
     }
   }
@@ -360,7 +361,7 @@ void FeedbackCover::start_direction_(CoverOperation dir) {
   // check if there is an obstacle to start the new operation -> abort without any change
   // the case when an obstacle appears while moving is handled in the callback
   if (obstacle != nullptr && obstacle->state) {
-    ESP_LOGD(TAG, "'%s' - %s obstacle detected. Action not started.", this->name_.c_str(),
+    ESP_LOGD(TAG, "'%s' - %s obstacle detected. Action not started.", this->get_name().c_str(),
              dir == COVER_OPERATION_OPENING ? "Open" : "Close");
     return;
   }
@@ -370,7 +371,7 @@ void FeedbackCover::start_direction_(CoverOperation dir) {
   // check if we have a wait time
   if (this->direction_change_waittime_.has_value() && dir != COVER_OPERATION_IDLE &&
       this->current_operation != COVER_OPERATION_IDLE && dir != this->current_operation) {
-    ESP_LOGD(TAG, "'%s' - Reversing direction.", this->name_.c_str());
+    ESP_LOGD(TAG, "'%s' - Reversing direction.", this->get_name().c_str());
     this->start_direction_(COVER_OPERATION_IDLE);
 
     this->set_timeout("direction_change", *this->direction_change_waittime_,
@@ -379,7 +380,7 @@ void FeedbackCover::start_direction_(CoverOperation dir) {
   } else {
     this->set_current_operation_(dir, true);
     this->prev_command_trigger_ = trig;
-    ESP_LOGD(TAG, "'%s' - Firing '%s' trigger.", this->name_.c_str(),
+    ESP_LOGD(TAG, "'%s' - Firing '%s' trigger.", this->get_name().c_str(),
              dir == COVER_OPERATION_OPENING   ? "OPEN"
              : dir == COVER_OPERATION_CLOSING ? "CLOSE"
                                               : "STOP");
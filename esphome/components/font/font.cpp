@@ -14,21 +14,38 @@ void Glyph::draw(int x_at, int y_start, display::Display *display, Color color)
   int scan_x1, scan_y1, scan_width, scan_height;
   this->scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
 
-  const unsigned char *data = this->glyph_data_->data;
-  const int max_x = x_at + scan_x1 + scan_width;
-  const int max_y = y_start + scan_y1 + scan_height;
+  const int min_x = x_at + scan_x1;
+  const int min_y = y_start + scan_y1;
+  int clip_x = min_x, clip_y = min_y, clip_w = scan_width, clip_h = scan_height;
+  if (!display->clip_rect(clip_x, clip_y, clip_w, clip_h))
+    return;
 
-  for (int glyph_y = y_start + scan_y1; glyph_y < max_y; glyph_y++) {
-    for (int glyph_x = x_at + scan_x1; glyph_x < max_x; data++, glyph_x += 8) {
-      uint8_t pixel_data = progmem_read_byte(data);
-      const int pixel_max_x = std::min(max_x, glyph_x + 8);
+  // every row starts on a byte boundary; skip the rows that are clipped away
+  const int row_bytes = (scan_width + 7) / 8;
+  const unsigned char *data = this->glyph_data_->data + (clip_y - min_y) * row_bytes;
 
-      for (int pixel_x = glyph_x; pixel_x < pixel_max_x && pixel_data; pixel_x++, pixel_data <<= 1) {
-        if (pixel_data & 0x80) {
-          display->draw_pixel_at(pixel_x, glyph_y, color);
+  for (int glyph_y = clip_y; glyph_y < clip_y + clip_h; glyph_y++, data += row_bytes) {
+    // draw each run of set bits as a single span
+    int run_start = -1;
+    uint8_t pixel_data = 0;
+    for (int pixel_x = 0; pixel_x < scan_width; pixel_x++, pixel_data <<= 1) {
+      if ((pixel_x % 8) == 0) {
+        pixel_data = progmem_read_byte(data + pixel_x / 8);
+        if (pixel_data == 0 && run_start < 0) {
+          pixel_x += 7;
+          continue;
         }
       }
+      if (pixel_data & 0x80) {
+        if (run_start < 0)
+          run_start = pixel_x;
+      } else if (run_start >= 0) {
+        display->fill_row_at(min_x + run_start, glyph_y, pixel_x - run_start, color);
+        run_start = -1;
+      }
     }
+    if (run_start >= 0)
+      display->fill_row_at(min_x + run_start, glyph_y, scan_width - run_start, color);
   }
 }
 const char *Glyph::get_char() const { return this->glyph_data_->a_char; }
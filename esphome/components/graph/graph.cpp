@@ -4,6 +4,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <sstream>
 #include <iostream>  // std::cout, std::fixed
 #include <iomanip>
@@ -15,9 +17,49 @@ using namespace display;
 static const char *const TAG = "graph";
 static const char *const TAGL = "graphlegend";
 
+/// Half precision float NaN, the content of buckets without samples.
+static const uint16_t HALF_NAN = 0x7E00;
+/// Largest finite half precision float.
+static const float HALF_MAX = 65504.0f;
+static const HistoryBucket EMPTY_BUCKET{HALF_NAN, HALF_NAN, HALF_NAN};
+
+static uint16_t float_to_half(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const uint16_t sign = (bits >> 16) & 0x8000;
+  const uint32_t magnitude = bits & 0x7FFFFFFF;
+  if (magnitude > 0x7F800000)
+    return HALF_NAN;
+  // values that would round to infinity saturate at HALF_MAX
+  if (magnitude >= 0x477FF000)
+    return sign | 0x7BFF;
+  // below 2^-14 half floats are subnormal, in steps of 2^-24
+  if (magnitude < 0x38800000)
+    return sign | static_cast<uint16_t>(std::lround(std::fabs(value) * 16777216.0f));
+  // rebias the exponent from 127 to 15 and round the mantissa to 10 bits, ties to even
+  const uint32_t rebiased = magnitude - 0x38000000;
+  return sign | static_cast<uint16_t>((rebiased + 0x0FFF + ((rebiased >> 13) & 1)) >> 13);
+}
+
+static float half_to_float(uint16_t half) {
+  const uint32_t sign = uint32_t(half & 0x8000) << 16;
+  const uint32_t exponent = (half >> 10) & 0x1F;
+  const uint32_t mantissa = half & 0x3FF;
+  if (exponent == 0) {
+    const float value = std::ldexp(float(mantissa), -24);
+    return sign != 0 ? -value : value;
+  }
+  const uint32_t bits = sign | (exponent == 0x1F ? 0x7F800000 : (exponent + 112) << 23) | (mantissa << 13);
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
 void HistoryData::init(int length) {
   this->length_ = length;
-  this->samples_.resize(length, NAN);
+  this->fine_.resize(length - length / 2, EMPTY_BUCKET);
+  this->coarse_.resize((length / 2 + COARSE_COLUMNS - 1) / COARSE_COLUMNS, EMPTY_BUCKET);
+  this->merging_ = EMPTY_BUCKET;
   this->last_sample_ = millis();
 }
 
@@ -26,27 +68,167 @@ void HistoryData::take_sample(float data) {
   uint32_t dt = tm - last_sample_;
   last_sample_ = tm;
 
-  // Step data based on time
+  // Step data based on time, columns that did not receive any samples take the new value
   this->period_ += dt;
   while (this->period_ >= this->update_time_) {
-    this->samples_[this->count_] = data;
+    this->close_bucket_(data);
     this->period_ -= this->update_time_;
-    this->count_ = (this->count_ + 1) % this->length_;
-    ESP_LOGV(TAG, "Updating trace with value: %f", data);
   }
   if (!std::isnan(data)) {
-    // Recalc recent max/min
-    this->recent_min_ = data;
-    this->recent_max_ = data;
-    for (int i = 0; i < this->length_; i++) {
-      if (!std::isnan(this->samples_[i])) {
-        if (this->recent_max_ < this->samples_[i])
-          this->recent_max_ = this->samples_[i];
-        if (this->recent_min_ > this->samples_[i])
-          this->recent_min_ = this->samples_[i];
-      }
+    if (this->open_count_ == 0) {
+      this->open_min_ = data;
+      this->open_max_ = data;
+      this->open_sum_ = 0.0f;
+    } else {
+      this->open_min_ = std::min(this->open_min_, data);
+      this->open_max_ = std::max(this->open_max_, data);
     }
+    this->open_sum_ += data;
+    this->open_count_++;
+  }
+}
+
+void HistoryData::close_bucket_(float fallback) {
+  float min = fallback, max = fallback, avg = fallback;
+  if (this->open_count_ > 0) {
+    min = this->open_min_;
+    max = this->open_max_;
+    avg = this->open_sum_ / this->open_count_;
+  }
+  this->open_count_ = 0;
+  ESP_LOGV(TAG, "Updating trace with value: %f (min %f, max %f)", avg, min, max);
+
+  this->fit_(min);
+  this->fit_(max);
+  const HistoryBucket bucket{this->encode_(min), this->encode_(max), this->encode_(avg)};
+  if (this->fine_size_ < (int) this->fine_.size()) {
+    this->fine_[this->fine_size_++] = bucket;
+  } else {
+    // the oldest column of the newer half moves to the older half
+    this->merge_into_coarse_(this->fine_[this->fine_head_]);
+    this->fine_[this->fine_head_] = bucket;
+    this->fine_head_ = (this->fine_head_ + 1) % this->fine_.size();
+  }
+
+  if (!std::isnan(avg)) {
+    min = this->decode_(bucket.min);
+    max = this->decode_(bucket.max);
+    if (std::isnan(this->recent_min_) || min < this->recent_min_)
+      this->recent_min_ = min;
+    if (std::isnan(this->recent_max_) || max > this->recent_max_)
+      this->recent_max_ = max;
+  }
+}
+
+void HistoryData::merge_into_coarse_(const HistoryBucket &bucket) {
+  if (this->coarse_.empty())
+    return;
+  const float avg = this->decode_(bucket.avg);
+  if (this->merging_count_ == 0) {
+    this->merging_ = bucket;
+    this->merging_sum_ = 0.0f;
+    this->merging_valid_ = 0;
+  } else {
+    this->merging_.min = this->encode_(std::fmin(this->decode_(this->merging_.min), this->decode_(bucket.min)));
+    this->merging_.max = this->encode_(std::fmax(this->decode_(this->merging_.max), this->decode_(bucket.max)));
   }
+  if (!std::isnan(avg)) {
+    this->merging_sum_ += avg;
+    this->merging_valid_++;
+    this->merging_.avg = this->encode_(this->merging_sum_ / this->merging_valid_);
+  }
+  if (++this->merging_count_ < COARSE_COLUMNS)
+    return;
+  this->merging_count_ = 0;
+
+  if (this->coarse_size_ < (int) this->coarse_.size()) {
+    this->coarse_[this->coarse_size_++] = this->merging_;
+    return;
+  }
+  // the oldest bucket leaves the history, the min/max of the history may have been in it
+  const HistoryBucket oldest = this->coarse_[this->coarse_head_];
+  this->coarse_[this->coarse_head_] = this->merging_;
+  this->coarse_head_ = (this->coarse_head_ + 1) % this->coarse_.size();
+  if (this->decode_(oldest.min) <= this->recent_min_ || this->decode_(oldest.max) >= this->recent_max_)
+    this->update_recent_();
+}
+
+const HistoryBucket &HistoryData::get_bucket_(int idx) const {
+  if (idx < this->fine_size_)
+    return this->fine_[(this->fine_head_ + this->fine_size_ - 1 - idx) % this->fine_.size()];
+  idx -= this->fine_size_;
+  if (idx < this->merging_count_)
+    return this->merging_;
+  idx = (idx - this->merging_count_) / COARSE_COLUMNS;
+  if (idx < this->coarse_size_)
+    return this->coarse_[(this->coarse_head_ + this->coarse_size_ - 1 - idx) % this->coarse_.size()];
+  return EMPTY_BUCKET;
+}
+
+void HistoryData::fit_(float value) {
+  if (!std::isfinite(value))
+    return;
+  if (std::isnan(this->reference_)) {
+    this->reference_ = value;
+    return;
+  }
+  int scale = this->scale_;
+  while (std::fabs(std::ldexp(value - this->reference_, -scale)) > HALF_MAX)
+    scale++;
+  if (scale == this->scale_)
+    return;
+
+  ESP_LOGV(TAG, "Rescaling trace history by 2^%d", scale - this->scale_);
+  auto rescale = [this, scale](uint16_t &half) {
+    half = float_to_half(std::ldexp(half_to_float(half), this->scale_ - scale));
+  };
+  for (auto *buckets : {&this->fine_, &this->coarse_}) {
+    for (auto &bucket : *buckets) {
+      rescale(bucket.min);
+      rescale(bucket.max);
+      rescale(bucket.avg);
+    }
+  }
+  rescale(this->merging_.min);
+  rescale(this->merging_.max);
+  rescale(this->merging_.avg);
+  this->scale_ = scale;
+  this->update_recent_();
+}
+
+uint16_t HistoryData::encode_(float value) const {
+  return float_to_half(std::ldexp(value - this->reference_, -this->scale_));
+}
+
+float HistoryData::decode_(uint16_t value) const {
+  return std::ldexp(half_to_float(value), this->scale_) + this->reference_;
+}
+
+void HistoryData::update_recent_() {
+  this->recent_min_ = NAN;
+  this->recent_max_ = NAN;
+  auto add = [this](const HistoryBucket &bucket) {
+    this->recent_min_ = std::fmin(this->recent_min_, this->decode_(bucket.min));
+    this->recent_max_ = std::fmax(this->recent_max_, this->decode_(bucket.max));
+  };
+  for (int i = 0; i < this->fine_size_; i++)
+    add(this->fine_[i]);
+  if (this->merging_count_ > 0)
+    add(this->merging_);
+  for (int i = 0; i < this->coarse_size_; i++)
+    add(this->coarse_[i]);
+}
+
+float HistoryData::get_recent_max() const {
+  if (this->open_count_ > 0)
+    return std::fmax(this->recent_max_, this->open_max_);
+  return this->recent_max_;
+}
+
+float HistoryData::get_recent_min() const {
+  if (this->open_count_ > 0)
+    return std::fmin(this->recent_min_, this->open_min_);
+  return this->recent_min_;
 }
 
 void GraphTrace::init(Graph *g) {
@@ -177,6 +359,14 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
         bool b = (trace->get_line_type() & bit) == bit;
         if (b) {
           int16_t y = (int16_t) roundf((this->height_ - 1) * (1.0 - v)) - thick / 2 + y_offset;
+          // Show the spread of the samples that were folded into this column
+          float vmax = (trace->get_tracedata()->get_value_max(i) - ymin) / yrange;
+          float vmin = (trace->get_tracedata()->get_value_min(i) - ymin) / yrange;
+          int16_t bottom = this->height_ - 1;
+          int16_t y_top = std::max((int16_t) roundf(bottom * (1.0 - vmax)), (int16_t) 0);
+          int16_t y_bottom = std::min((int16_t) roundf(bottom * (1.0 - vmin)), bottom);
+          if (y_bottom - y_top >= thick)
+            buff->vertical_line(x, y_top + y_offset, y_bottom - y_top + 1, c);
           if (!continuous || !has_prev || !prev_b || (abs(y - prev_y) <= thick)) {
             for (uint16_t t = 0; t < thick; t++) {
               buff->draw_pixel_at(x, y + t, c);
@@ -83,26 +83,83 @@ class GraphLegend {
   friend Graph;
 };
 
+/// Min, max and average of the samples that fell into one or more columns of a trace, stored as half precision
+/// floats relative to the reference value of the history.
+struct HistoryBucket {
+  uint16_t min;
+  uint16_t max;
+  uint16_t avg;
+};
+
+/** Fixed-size, multi-resolution history of a trace with min/max/avg buckets.
+ *
+ * Every sample is folded into the bucket of the column it belongs to, so short spikes between two columns stay
+ * visible and memory does not depend on the sample rate or duration of the graph. The newer half of the columns has
+ * one bucket per column, the older half one bucket per `COARSE_COLUMNS` columns. With 6 bytes per bucket, the history
+ * takes less than the 4 bytes per column of a plain float per column.
+ *
+ * The min/max over the whole history is updated with every column in O(1). It's only recomputed from all buckets
+ * when the bucket that held it leaves the history.
+ */
 class HistoryData {
  public:
+  /// Number of columns that share a bucket in the older half of the history.
+  static const uint8_t COARSE_COLUMNS = 4;
+
   void init(int length);
-  ~HistoryData();
   void set_update_time_ms(uint32_t update_time_ms) { update_time_ = update_time_ms; }
   void take_sample(float data);
   int get_length() const { return length_; }
-  float get_value(int idx) const { return samples_[(count_ + length_ - 1 - idx) % length_]; }
-  float get_recent_max() const { return recent_max_; }
-  float get_recent_min() const { return recent_min_; }
+  /// Average of column `idx`, counted backwards from the most recent column.
+  float get_value(int idx) const { return this->decode_(this->get_bucket_(idx).avg); }
+  float get_value_min(int idx) const { return this->decode_(this->get_bucket_(idx).min); }
+  float get_value_max(int idx) const { return this->decode_(this->get_bucket_(idx).max); }
+  float get_recent_max() const;
+  float get_recent_min() const;
+  /// Bytes taken by the buckets of the history.
+  size_t get_memory_usage() const { return (fine_.size() + coarse_.size()) * sizeof(HistoryBucket); }
 
  protected:
+  /// Close the bucket that is being filled and store it as the most recent column.
+  void close_bucket_(float fallback);
+  /// Fold the oldest column of the newer half into the older half.
+  void merge_into_coarse_(const HistoryBucket &bucket);
+  /// Bucket of column `idx`, counted backwards from the most recent column.
+  const HistoryBucket &get_bucket_(int idx) const;
+  /// Set the reference, or grow the scale and re-encode all buckets, so `value` can be encoded.
+  void fit_(float value);
+  uint16_t encode_(float value) const;
+  float decode_(uint16_t value) const;
+  /// Recompute the min/max of the history from all buckets.
+  void update_recent_();
+
   uint32_t last_sample_;
   uint32_t period_{0};       /// in ms
   uint32_t update_time_{0};  /// in ms
   int length_;
-  int count_{0};
+  // Newer half, one bucket per column, the ring starts at the oldest column once it's full
+  std::vector<HistoryBucket> fine_;
+  int fine_head_{0};
+  int fine_size_{0};
+  // Older half, one bucket per COARSE_COLUMNS columns
+  std::vector<HistoryBucket> coarse_;
+  int coarse_head_{0};
+  int coarse_size_{0};
+  // Columns of the newer half that are being merged into the next bucket of the older half
+  HistoryBucket merging_{};
+  float merging_sum_{0.0f};
+  uint8_t merging_count_{0};
+  uint8_t merging_valid_{0};
+  // Bucket being filled for the current column
+  float open_min_{NAN};
+  float open_max_{NAN};
+  float open_sum_{0.0f};
+  uint32_t open_count_{0};
+  // The buckets store (value - reference_) * 2^-scale_, the scale grows when a value doesn't fit a half float
+  float reference_{NAN};
+  int scale_{0};
   float recent_min_{NAN};
   float recent_max_{NAN};
-  std::vector<float> samples_;
 };
 
 class GraphTrace {
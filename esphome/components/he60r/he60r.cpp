@@ -55,7 +55,7 @@ void HE60rCover::endstop_reached_(CoverOperation operation) {
     this->current_operation = COVER_OPERATION_IDLE;
     if (this->last_command_ == operation) {
       float dur = (now - this->start_dir_time_) / 1e3f;
-      ESP_LOGD(TAG, "'%s' - %s endstop reached. Took %.1fs.", this->name_.c_str(),
+      ESP_LOGD(TAG, "'%s' - %s endstop reached. Took %.1fs.", this->get_name().c_str(),
                operation == COVER_OPERATION_OPENING ? "Open" : "Close", dur);
     }
     this->publish_state();
@@ -207,7 +207,7 @@ void HE60rCover::start_direction_(CoverOperation dir) {
   this->last_command_ = dir;
   if (this->current_operation == dir)
     return;
-  ESP_LOGD(TAG, "'%s' - Direction '%s' requested.", this->name_.c_str(),
+  ESP_LOGD(TAG, "'%s' - Direction '%s' requested.", this->get_name().c_str(),
            dir == COVER_OPERATION_OPENING   ? "OPEN"
            : dir == COVER_OPERATION_CLOSING ? "CLOSE"
                                             : "STOP");
@@ -223,7 +223,7 @@ void HE60rCover::start_direction_(CoverOperation dir) {
       // just stop and reverse
       this->toggles_needed_ = 2;
     }
-    ESP_LOGD(TAG, "'%s' - Reversing direction.", this->name_.c_str());
+    ESP_LOGD(TAG, "'%s' - Reversing direction.", this->get_name().c_str());
   }
   this->start_dir_time_ = millis();
 }
@@ -1,4 +1,5 @@
 from esphome.const import (
+    CONF_ID,
     KEY_CORE,
     KEY_FRAMEWORK_VERSION,
     KEY_TARGET_FRAMEWORK,
@@ -9,6 +10,7 @@ from esphome.core import CORE
 from esphome.helpers import IS_MACOS
 import esphome.config_validation as cv
 import esphome.codegen as cg
+from esphome.cpp_helpers import fnv1_hash
 
 from .const import KEY_HOST
 
@@ -18,6 +20,79 @@ from .gpio import host_pin_to_code  # noqa
 CODEOWNERS = ["@esphome/core"]
 AUTO_LOAD = ["network"]
 
+CONF_VIRTUAL_TIME = "virtual_time"
+CONF_EVENTS = "events"
+CONF_STOP_AFTER = "stop_after"
+
+host_ns = cg.esphome_ns.namespace("host")
+VirtualClock = host_ns.class_("VirtualClock", cg.Component)
+VirtualEventDomain = host_ns.enum("VirtualEventDomain")
+
+EVENT_DOMAINS = {
+    "sensor": VirtualEventDomain.VIRTUAL_EVENT_SENSOR,
+    "binary_sensor": VirtualEventDomain.VIRTUAL_EVENT_BINARY_SENSOR,
+    "text_sensor": VirtualEventDomain.VIRTUAL_EVENT_TEXT_SENSOR,
+    "switch": VirtualEventDomain.VIRTUAL_EVENT_SWITCH,
+    "button": VirtualEventDomain.VIRTUAL_EVENT_BUTTON,
+    "number": VirtualEventDomain.VIRTUAL_EVENT_NUMBER,
+}
+
+
+def _event_value(domain, value):
+    if domain in ("sensor", "number"):
+        return str(cv.float_(value))
+    if domain in ("binary_sensor", "switch"):
+        return "on" if cv.boolean(value) else "off"
+    if domain == "button":
+        return ""
+    return value
+
+
+def load_events(path):
+    """Parse an events file into (time_ms, domain, object_id, value) tuples.
+
+    Every line is `<time> <domain>.<object_id> [value]`, the time is counted from
+    boot, e.g. `90min switch.heater on`. `#` starts a comment.
+    """
+    events = []
+    with open(path, encoding="utf-8") as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            parts = line.split(None, 2)
+            try:
+                if len(parts) < 2:
+                    raise cv.Invalid("Expected '<time> <domain>.<object_id> [value]'")
+                at = cv.positive_time_period_milliseconds(parts[0])
+                domain, _, object_id = parts[1].partition(".")
+                if domain not in EVENT_DOMAINS or not object_id:
+                    raise cv.Invalid(
+                        f"Unknown entity '{parts[1]}', supported domains are "
+                        + ", ".join(EVENT_DOMAINS)
+                    )
+                value = _event_value(domain, parts[2] if len(parts) > 2 else "")
+            except cv.Invalid as err:
+                raise cv.Invalid(f"{path}:{lineno}: {err}") from err
+            events.append((at.total_milliseconds, domain, object_id, value))
+    # stable, so events at the same time keep the order of the file
+    return sorted(events, key=lambda event: event[0])
+
+
+def validate_events_file(value):
+    value = cv.file_(value)
+    load_events(CORE.relative_config_path(value))
+    return value
+
+
+VIRTUAL_TIME_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(VirtualClock),
+        cv.Optional(CONF_EVENTS): validate_events_file,
+        cv.Optional(CONF_STOP_AFTER): cv.positive_time_period_seconds,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
 
 def set_core_data(config):
     CORE.data[KEY_HOST] = {}
@@ -28,7 +103,11 @@ def set_core_data(config):
 
 
 CONFIG_SCHEMA = cv.All(
-    cv.Schema({}),
+    cv.Schema(
+        {
+            cv.Optional(CONF_VIRTUAL_TIME): VIRTUAL_TIME_SCHEMA,
+        }
+    ),
     set_core_data,
 )
 
@@ -41,3 +120,19 @@ async def to_code(config):
         cg.add_build_flag("-L/opt/homebrew/lib")
     cg.add_define("ESPHOME_BOARD", "host")
     cg.add_platformio_option("platform", "platformio/native")
+
+    if CONF_VIRTUAL_TIME in config:
+        conf = config[CONF_VIRTUAL_TIME]
+        cg.add_define("USE_HOST_VIRTUAL_TIME")
+        var = cg.new_Pvariable(conf[CONF_ID])
+        await cg.register_component(var, conf)
+        if CONF_STOP_AFTER in conf:
+            cg.add(var.set_stop_after(conf[CONF_STOP_AFTER].total_seconds))
+        if CONF_EVENTS in conf:
+            path = CORE.relative_config_path(conf[CONF_EVENTS])
+            for at_ms, domain, object_id, value in load_events(path):
+                cg.add(
+                    var.add_event(
+                        at_ms, EVENT_DOMAINS[domain], fnv1_hash(object_id), value
+                    )
+                )
@@ -1,9 +1,15 @@
 #ifdef USE_HOST
 
+#include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/heap_tracker.h"
 #include "esphome/core/helpers.h"
 #include "preferences.h"
+#include "virtual_clock.h"
 
+#include <cinttypes>
+#include <csignal>
+#include <cstdio>
 #include <sched.h>
 #include <time.h>
 #include <cmath>
@@ -11,6 +17,31 @@
 
 namespace esphome {
 
+#ifdef USE_HOST_VIRTUAL_TIME
+// simulated time, see virtual_clock.h; a busy loop that yields still sees time pass
+void IRAM_ATTR HOT yield() { delay(1); }
+uint32_t IRAM_ATTR HOT millis() {
+  return host::global_virtual_clock == nullptr ? 0 : host::global_virtual_clock->now_us() / 1000ULL;
+}
+void IRAM_ATTR HOT delay(uint32_t ms) {
+  if (host::global_virtual_clock != nullptr)
+    host::global_virtual_clock->advance_us(uint64_t(ms) * 1000ULL);
+}
+uint32_t IRAM_ATTR HOT micros() {
+  return host::global_virtual_clock == nullptr ? 0 : host::global_virtual_clock->now_us();
+}
+void IRAM_ATTR HOT delayMicroseconds(uint32_t us) {
+  if (host::global_virtual_clock != nullptr)
+    host::global_virtual_clock->advance_us(us);
+}
+time_t arch_get_epoch() {
+  return host::global_virtual_clock == nullptr ? ::time(nullptr) : host::global_virtual_clock->epoch_now();
+}
+void arch_set_epoch(time_t epoch) {
+  if (host::global_virtual_clock != nullptr)
+    host::global_virtual_clock->set_epoch(epoch);
+}
+#else
 void IRAM_ATTR HOT yield() { ::sched_yield(); }
 uint32_t IRAM_ATTR HOT millis() {
   struct timespec spec;
@@ -44,12 +75,38 @@ void IRAM_ATTR HOT delayMicroseconds(uint32_t us) {
     res = nanosleep(&ts, &ts);
   } while (res != 0 && errno == EINTR);
 }
+#endif  // USE_HOST_VIRTUAL_TIME
+#ifdef USE_HEAP_TRACKING
+static volatile sig_atomic_t heap_report_requested = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static void print_heap_report() {
+  printf("Heap usage by component:\n");
+  global_heap_tracker.for_each([](const char *source, const HeapStats &stats) {
+    printf("  %-24s %8" PRIu32 " B live %8" PRIu32 " B peak %6" PRIu32 " live allocations %8" PRIu32 " allocations\n",
+           source, stats.live_bytes, stats.peak_bytes, stats.live_allocations, stats.allocations);
+  });
+  fflush(stdout);
+}
+#endif  // USE_HEAP_TRACKING
+
 void arch_restart() { exit(0); }
 void arch_init() {
-  // pass
+  // writing to a socket closed by the peer fails with EPIPE like on the MCUs instead of terminating the process
+  signal(SIGPIPE, SIG_IGN);
+#ifdef USE_HEAP_TRACKING
+  // the report is printed when the program exits and on `kill -USR1 <pid>`
+  atexit(print_heap_report);
+  signal(SIGUSR1, [](int) { heap_report_requested = 1; });
+#endif
 }
 void IRAM_ATTR HOT arch_feed_wdt() {
-  // pass
+#ifdef USE_HEAP_TRACKING
+  // printing from the signal handler is not safe, it is done from the main loop instead
+  if (heap_report_requested) {
+    heap_report_requested = 0;
+    print_heap_report();
+  }
+#endif
 }
 
 uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
@@ -0,0 +1,78 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import display
+from esphome.const import (
+    CONF_DIMENSIONS,
+    CONF_FORMAT,
+    CONF_HEIGHT,
+    CONF_ID,
+    CONF_LAMBDA,
+    CONF_PAGES,
+    CONF_PATH,
+    CONF_WIDTH,
+)
+from ..const import host_ns
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["host"]
+
+CONF_OUTPUT = "output"
+
+HostDisplay = host_ns.class_("HostDisplay", display.DisplayBuffer)
+HostDisplayOutputFormat = host_ns.enum("HostDisplayOutputFormat")
+
+OUTPUT_FORMATS = {
+    "PPM": HostDisplayOutputFormat.HOST_DISPLAY_OUTPUT_PPM,
+    "PNG": HostDisplayOutputFormat.HOST_DISPLAY_OUTPUT_PNG,
+}
+
+
+def validate_output_path(value):
+    value = cv.string_strict(value)
+    if value.count("%") != 1 or "%u" not in value:
+        raise cv.Invalid(
+            "Output path must contain exactly one '%u' placeholder for the frame number"
+        )
+    return value
+
+
+CONFIG_SCHEMA = cv.All(
+    display.FULL_DISPLAY_SCHEMA.extend(
+        {
+            cv.GenerateID(): cv.declare_id(HostDisplay),
+            cv.Required(CONF_DIMENSIONS): cv.Schema(
+                {
+                    cv.Required(CONF_WIDTH): cv.int_range(min=1, max=4096),
+                    cv.Required(CONF_HEIGHT): cv.int_range(min=1, max=4096),
+                }
+            ),
+            cv.Optional(CONF_OUTPUT): cv.Schema(
+                {
+                    cv.Required(CONF_PATH): validate_output_path,
+                    cv.Optional(CONF_FORMAT, default="PNG"): cv.enum(
+                        OUTPUT_FORMATS, upper=True
+                    ),
+                }
+            ),
+        }
+    ).extend(cv.polling_component_schema("1s")),
+    cv.has_at_most_one_key(CONF_PAGES, CONF_LAMBDA),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await display.register_display(var, config)
+
+    dimensions = config[CONF_DIMENSIONS]
+    cg.add(var.set_dimensions(dimensions[CONF_WIDTH], dimensions[CONF_HEIGHT]))
+
+    if output := config.get(CONF_OUTPUT):
+        cg.add(var.set_output_path(output[CONF_PATH]))
+        cg.add(var.set_output_format(output[CONF_FORMAT]))
+
+    if CONF_LAMBDA in config:
+        lambda_ = await cg.process_lambda(
+            config[CONF_LAMBDA], [(display.DisplayRef, "it")], return_type=cg.void
+        )
+        cg.add(var.set_writer(lambda_))
@@ -0,0 +1,208 @@
+#ifdef USE_HOST
+
+#include "host_display.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace esphome {
+namespace host {
+
+static const char *const TAG = "host.display";
+static const size_t BYTES_PER_PIXEL = 3;
+/// Largest block a stored (uncompressed) deflate block can hold.
+static const size_t DEFLATE_STORED_BLOCK_MAX = 65535;
+
+void HostDisplay::setup() {
+  this->init_internal_(this->width_ * this->height_ * BYTES_PER_PIXEL);
+  if (this->buffer_ == nullptr)
+    this->mark_failed();
+}
+
+void HostDisplay::dump_config() {
+  LOG_DISPLAY("", "Host Display", this);
+  if (!this->output_path_.empty()) {
+    ESP_LOGCONFIG(TAG, "  Output: %s (%s)", this->output_path_.c_str(),
+                  this->output_format_ == HOST_DISPLAY_OUTPUT_PNG ? "PNG" : "PPM");
+  }
+  LOG_UPDATE_INTERVAL(this);
+}
+
+void HostDisplay::update() {
+  this->pixel_writes_ = 0;
+  this->pixels_changed_ = 0;
+
+  uint32_t start = micros();
+  this->do_update_();
+  this->last_render_time_us_ = micros() - start;
+  this->last_pixel_writes_ = this->pixel_writes_;
+  this->last_pixels_changed_ = this->pixels_changed_;
+
+  // nothing is transferred anywhere, but this keeps the dirty region statistics comparable with real drivers
+  bool changed = !this->dirty_regions_.empty();
+  this->flush_dirty_regions_();
+  if (changed && !this->output_path_.empty())
+    this->write_frame_();
+
+  ESP_LOGD(TAG, "Frame %u: rendered in %uus, %u pixel writes, %u pixels changed, %u bytes flushed",
+           (unsigned) this->frame_count_, (unsigned) this->last_render_time_us_, (unsigned) this->last_pixel_writes_,
+           (unsigned) this->last_pixels_changed_, changed ? (unsigned) this->get_last_flush_bytes() : 0u);
+  this->frame_count_++;
+}
+
+Color HostDisplay::get_framebuffer_pixel(int x, int y) const {
+  if (this->buffer_ == nullptr || x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
+    return Color::BLACK;
+  const uint8_t *pixel = this->buffer_ + (y * this->width_ + x) * BYTES_PER_PIXEL;
+  return Color(pixel[0], pixel[1], pixel[2]);
+}
+
+void HOT HostDisplay::draw_absolute_pixel_internal(int x, int y, Color color) {
+  if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
+    return;
+  if (this->write_pixel_(this->buffer_ + (y * this->width_ + x) * BYTES_PER_PIXEL, color))
+    this->mark_dirty_(x, y, x, y);
+}
+
+void HOT HostDisplay::fill_absolute_row_internal(int x, int y, int w, Color color) {
+  uint8_t *pixel = this->buffer_ + (y * this->width_ + x) * BYTES_PER_PIXEL;
+  int first = -1, last = -1;
+  for (int i = x; i < x + w; i++, pixel += BYTES_PER_PIXEL) {
+    if (this->write_pixel_(pixel, color)) {
+      if (first < 0)
+        first = i;
+      last = i;
+    }
+  }
+  if (first >= 0)
+    this->mark_dirty_(first, y, last, y);
+}
+
+void HOT HostDisplay::draw_absolute_row_internal(int x, int y, int w, const Color *colors) {
+  uint8_t *pixel = this->buffer_ + (y * this->width_ + x) * BYTES_PER_PIXEL;
+  int first = -1, last = -1;
+  for (int i = 0; i < w; i++, pixel += BYTES_PER_PIXEL) {
+    if (this->write_pixel_(pixel, colors[i])) {
+      if (first < 0)
+        first = x + i;
+      last = x + i;
+    }
+  }
+  if (first >= 0)
+    this->mark_dirty_(first, y, last, y);
+}
+
+size_t HostDisplay::flush_region_internal(const display::Rect &region) {
+  return size_t(region.w) * region.h * BYTES_PER_PIXEL;
+}
+
+void HostDisplay::write_frame_() {
+  char path[256];
+  snprintf(path, sizeof(path), this->output_path_.c_str(), (unsigned) this->frame_count_);
+  bool success = this->output_format_ == HOST_DISPLAY_OUTPUT_PNG ? this->write_png(path) : this->write_ppm(path);
+  if (!success)
+    ESP_LOGW(TAG, "Could not write frame to %s", path);
+}
+
+bool HostDisplay::write_ppm(const std::string &path) const {
+  if (this->buffer_ == nullptr)
+    return false;
+  FILE *file = fopen(path.c_str(), "wb");
+  if (file == nullptr)
+    return false;
+  fprintf(file, "P6\n%d %d\n255\n", this->width_, this->height_);
+  size_t length = this->width_ * this->height_ * BYTES_PER_PIXEL;
+  bool success = fwrite(this->buffer_, 1, length, file) == length;
+  return fclose(file) == 0 && success;
+}
+
+static uint32_t png_crc32(uint32_t crc, const uint8_t *data, size_t length) {
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static void png_put32(std::vector<uint8_t> &out, uint32_t value) {
+  out.push_back(value >> 24);
+  out.push_back(value >> 16);
+  out.push_back(value >> 8);
+  out.push_back(value);
+}
+
+static bool png_write_chunk(FILE *file, const char *type, const std::vector<uint8_t> &data) {
+  std::vector<uint8_t> chunk;
+  chunk.reserve(data.size() + 12);
+  png_put32(chunk, data.size());
+  chunk.insert(chunk.end(), type, type + 4);
+  chunk.insert(chunk.end(), data.begin(), data.end());
+  png_put32(chunk, png_crc32(0, chunk.data() + 4, data.size() + 4));
+  return fwrite(chunk.data(), 1, chunk.size(), file) == chunk.size();
+}
+
+bool HostDisplay::write_png(const std::string &path) const {
+  if (this->buffer_ == nullptr)
+    return false;
+
+  // raw scanlines, each prefixed with filter type 0 (none)
+  const size_t stride = this->width_ * BYTES_PER_PIXEL;
+  std::vector<uint8_t> raw;
+  raw.reserve((stride + 1) * this->height_);
+  for (int y = 0; y < this->height_; y++) {
+    raw.push_back(0);
+    raw.insert(raw.end(), this->buffer_ + y * stride, this->buffer_ + (y + 1) * stride);
+  }
+
+  // zlib stream made of stored deflate blocks; the frames are for inspection, not for size
+  std::vector<uint8_t> idat;
+  idat.reserve(raw.size() + raw.size() / DEFLATE_STORED_BLOCK_MAX * 5 + 16);
+  idat.push_back(0x78);
+  idat.push_back(0x01);
+  size_t offset = 0;
+  do {
+    size_t length = std::min(raw.size() - offset, DEFLATE_STORED_BLOCK_MAX);
+    bool final = offset + length == raw.size();
+    idat.push_back(final ? 1 : 0);
+    idat.push_back(length);
+    idat.push_back(length >> 8);
+    idat.push_back(~length);
+    idat.push_back(~length >> 8);
+    idat.insert(idat.end(), raw.begin() + offset, raw.begin() + offset + length);
+    offset += length;
+  } while (offset < raw.size());
+  uint32_t adler_a = 1, adler_b = 0;
+  for (uint8_t byte : raw) {
+    adler_a = (adler_a + byte) % 65521;
+    adler_b = (adler_b + adler_a) % 65521;
+  }
+  png_put32(idat, (adler_b << 16) | adler_a);
+
+  std::vector<uint8_t> ihdr;
+  png_put32(ihdr, this->width_);
+  png_put32(ihdr, this->height_);
+  ihdr.push_back(8);  // bit depth
+  ihdr.push_back(2);  // color type: truecolor
+  ihdr.push_back(0);  // compression
+  ihdr.push_back(0);  // filter
+  ihdr.push_back(0);  // no interlace
+
+  FILE *file = fopen(path.c_str(), "wb");
+  if (file == nullptr)
+    return false;
+  static const uint8_t SIGNATURE[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  bool success = fwrite(SIGNATURE, 1, sizeof(SIGNATURE), file) == sizeof(SIGNATURE) &&
+                 png_write_chunk(file, "IHDR", ihdr) && png_write_chunk(file, "IDAT", idat) &&
+                 png_write_chunk(file, "IEND", {});
+  return fclose(file) == 0 && success;
+}
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST
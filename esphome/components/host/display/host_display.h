@@ -0,0 +1,93 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include "esphome/components/display/display_buffer.h"
+#include "esphome/core/component.h"
+
+#include <string>
+
+namespace esphome {
+namespace host {
+
+enum HostDisplayOutputFormat : uint8_t {
+  HOST_DISPLAY_OUTPUT_PPM = 0,
+  HOST_DISPLAY_OUTPUT_PNG = 1,
+};
+
+/** A display for the host platform that renders into an RGB888 framebuffer in memory.
+ *
+ * Every update measures how long the writer took and how many pixels it wrote and changed, so rendering code
+ * can be profiled on Linux. Changed frames can optionally be written to PPM or PNG files for golden-image tests.
+ */
+class HostDisplay : public display::DisplayBuffer {
+ public:
+  void set_dimensions(int width, int height) {
+    this->width_ = width;
+    this->height_ = height;
+  }
+  /// Set a printf-style path containing one `%u`, which is replaced with the frame number.
+  void set_output_path(const std::string &output_path) { this->output_path_ = output_path; }
+  void set_output_format(HostDisplayOutputFormat output_format) { this->output_format_ = output_format; }
+
+  void setup() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::PROCESSOR; }
+
+  display::DisplayType get_display_type() override { return display::DISPLAY_TYPE_COLOR; }
+
+  /// The RGB888 framebuffer, unrotated and row-major without padding.
+  const uint8_t *get_framebuffer() const { return this->buffer_; }
+  /// The color of the pixel at [x,y] of the unrotated framebuffer.
+  Color get_framebuffer_pixel(int x, int y) const;
+
+  bool write_ppm(const std::string &path) const;
+  bool write_png(const std::string &path) const;
+
+  uint32_t get_frame_count() const { return this->frame_count_; }
+  /// Time the last update spent in the display writer, including auto clear, in microseconds.
+  uint32_t get_last_render_time_us() const { return this->last_render_time_us_; }
+  /// Number of pixel writes that reached the framebuffer during the last update.
+  uint32_t get_last_pixel_writes() const { return this->last_pixel_writes_; }
+  /// Number of pixel writes during the last update that changed the framebuffer.
+  uint32_t get_last_pixels_changed() const { return this->last_pixels_changed_; }
+
+ protected:
+  int get_width_internal() override { return this->width_; }
+  int get_height_internal() override { return this->height_; }
+  void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_row_internal(int x, int y, int w, Color color) override;
+  void draw_absolute_row_internal(int x, int y, int w, const Color *colors) override;
+  size_t flush_region_internal(const display::Rect &region) override;
+
+  /// Store a pixel without bounds checks, returns true if the framebuffer changed.
+  inline bool write_pixel_(uint8_t *pixel, Color color) {
+    this->pixel_writes_++;
+    if (pixel[0] == color.r && pixel[1] == color.g && pixel[2] == color.b)
+      return false;
+    pixel[0] = color.r;
+    pixel[1] = color.g;
+    pixel[2] = color.b;
+    this->pixels_changed_++;
+    return true;
+  }
+  void write_frame_();
+
+  int width_{0};
+  int height_{0};
+  std::string output_path_{};
+  HostDisplayOutputFormat output_format_{HOST_DISPLAY_OUTPUT_PNG};
+
+  uint32_t frame_count_{0};
+  uint32_t pixel_writes_{0};
+  uint32_t pixels_changed_{0};
+  uint32_t last_render_time_us_{0};
+  uint32_t last_pixel_writes_{0};
+  uint32_t last_pixels_changed_{0};
+};
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -0,0 +1,192 @@
+#include "virtual_clock.h"
+
+#ifdef USE_HOST_VIRTUAL_TIME
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstring>
+#include <time.h>
+
+#include "esphome/core/application.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace host {
+
+static const char *const TAG = "host.virtual_time";
+
+VirtualClock *global_virtual_clock = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static uint64_t wall_clock_us() {
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  return uint64_t(spec.tv_sec) * 1000000ULL + spec.tv_nsec / 1000;
+}
+
+VirtualClock::VirtualClock() : epoch_offset_(::time(nullptr)), wall_start_us_(wall_clock_us()) {
+  global_virtual_clock = this;
+}
+
+void VirtualClock::setup() {
+  for (auto &event : this->events_) {
+    event.target = this->find_target_(event);
+    if (event.target == nullptr)
+      ESP_LOGW(TAG, "No entity with object id hash 0x%08" PRIX32 " for the event at %" PRIu32 " ms",
+               event.object_id_hash, event.at_ms);
+  }
+}
+
+void VirtualClock::loop() {
+  this->loops_++;
+  while (this->next_event_ < this->events_.size() &&
+         uint64_t(this->events_[this->next_event_].at_ms) * 1000ULL <= this->now_us_) {
+    this->fire_(this->events_[this->next_event_++]);
+  }
+  if (this->stop_after_us_ != 0 && this->now_us_ >= this->stop_after_us_)
+    this->finish_();
+}
+
+void VirtualClock::dump_config() {
+  ESP_LOGCONFIG(TAG, "Virtual Time:");
+  ESP_LOGCONFIG(TAG, "  Scripted events: %zu", this->events_.size());
+  if (this->stop_after_us_ != 0)
+    ESP_LOGCONFIG(TAG, "  Stop after: %" PRIu32 " s", uint32_t(this->stop_after_us_ / 1000000ULL));
+}
+
+void VirtualClock::advance_us(uint64_t us) {
+  if (us == 0)
+    return;
+  uint64_t target = this->now_us_ + us;
+  // an event that is already due is fired by the next loop(), only future events limit the jump
+  if (this->next_event_ < this->events_.size()) {
+    uint64_t event_us = uint64_t(this->events_[this->next_event_].at_ms) * 1000ULL;
+    if (event_us > this->now_us_)
+      target = std::min(target, event_us);
+  }
+  if (this->stop_after_us_ != 0 && this->stop_after_us_ > this->now_us_)
+    target = std::min(target, this->stop_after_us_);
+  this->now_us_ = target;
+  this->jumps_++;
+}
+
+EntityBase *VirtualClock::find_target_(const Event &event) {
+  switch (event.domain) {
+#ifdef USE_SENSOR
+    case VIRTUAL_EVENT_SENSOR:
+      for (auto *obj : App.get_sensors()) {
+        if (obj->get_object_id_hash() == event.object_id_hash)
+          return obj;
+      }
+      break;
+#endif
+#ifdef USE_BINARY_SENSOR
+    case VIRTUAL_EVENT_BINARY_SENSOR:
+      for (auto *obj : App.get_binary_sensors()) {
+        if (obj->get_object_id_hash() == event.object_id_hash)
+          return obj;
+      }
+      break;
+#endif
+#ifdef USE_TEXT_SENSOR
+    case VIRTUAL_EVENT_TEXT_SENSOR:
+      for (auto *obj : App.get_text_sensors()) {
+        if (obj->get_object_id_hash() == event.object_id_hash)
+          return obj;
+      }
+      break;
+#endif
+#ifdef USE_SWITCH
+    case VIRTUAL_EVENT_SWITCH:
+      for (auto *obj : App.get_switches()) {
+        if (obj->get_object_id_hash() == event.object_id_hash)
+          return obj;
+      }
+      break;
+#endif
+#ifdef USE_BUTTON
+    case VIRTUAL_EVENT_BUTTON:
+      for (auto *obj : App.get_buttons()) {
+        if (obj->get_object_id_hash() == event.object_id_hash)
+          return obj;
+      }
+      break;
+#endif
+#ifdef USE_NUMBER
+    case VIRTUAL_EVENT_NUMBER:
+      for (auto *obj : App.get_numbers()) {
+        if (obj->get_object_id_hash() == event.object_id_hash)
+          return obj;
+      }
+      break;
+#endif
+    default:
+      break;
+  }
+  return nullptr;
+}
+
+void VirtualClock::fire_(const Event &event) {
+  if (event.target == nullptr)
+    return;
+  ESP_LOGV(TAG, "%" PRIu32 " ms: '%s' <- %s", event.at_ms, event.target->get_name().c_str(), event.value);
+  this->fired_++;
+  switch (event.domain) {
+#ifdef USE_SENSOR
+    case VIRTUAL_EVENT_SENSOR:
+      static_cast<sensor::Sensor *>(event.target)->publish_state(parse_number<float>(event.value).value_or(NAN));
+      break;
+#endif
+#ifdef USE_BINARY_SENSOR
+    case VIRTUAL_EVENT_BINARY_SENSOR:
+      static_cast<binary_sensor::BinarySensor *>(event.target)->publish_state(strcmp(event.value, "on") == 0);
+      break;
+#endif
+#ifdef USE_TEXT_SENSOR
+    case VIRTUAL_EVENT_TEXT_SENSOR:
+      static_cast<text_sensor::TextSensor *>(event.target)->publish_state(event.value);
+      break;
+#endif
+#ifdef USE_SWITCH
+    case VIRTUAL_EVENT_SWITCH:
+      if (strcmp(event.value, "on") == 0) {
+        static_cast<switch_::Switch *>(event.target)->turn_on();
+      } else {
+        static_cast<switch_::Switch *>(event.target)->turn_off();
+      }
+      break;
+#endif
+#ifdef USE_BUTTON
+    case VIRTUAL_EVENT_BUTTON:
+      static_cast<button::Button *>(event.target)->press();
+      break;
+#endif
+#ifdef USE_NUMBER
+    case VIRTUAL_EVENT_NUMBER: {
+      auto call = static_cast<number::Number *>(event.target)->make_call();
+      call.set_value(parse_number<float>(event.value).value_or(NAN));
+      call.perform();
+      break;
+    }
+#endif
+    default:
+      break;
+  }
+}
+
+void VirtualClock::finish_() {
+  const double simulated_s = this->now_us_ / 1e6;
+  const double wall_s = (wall_clock_us() - this->wall_start_us_) / 1e6;
+  ESP_LOGI(TAG, "Simulated %.0f s in %.3f s wall time (%.0fx)", simulated_s, wall_s,
+           wall_s > 0 ? simulated_s / wall_s : 0.0);
+  ESP_LOGI(TAG, "  %" PRIu32 " loop iterations (%.0f/s), %" PRIu32 " clock jumps, %" PRIu32 " events", this->loops_,
+           wall_s > 0 ? this->loops_ / wall_s : 0.0, this->jumps_, this->fired_);
+  App.run_safe_shutdown_hooks();
+  exit(0);
+}
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST_VIRTUAL_TIME
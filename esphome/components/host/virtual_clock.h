@@ -0,0 +1,86 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_HOST_VIRTUAL_TIME
+
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "esphome/core/entity_base.h"
+
+namespace esphome {
+namespace host {
+
+enum VirtualEventDomain : uint8_t {
+  VIRTUAL_EVENT_SENSOR = 0,
+  VIRTUAL_EVENT_BINARY_SENSOR,
+  VIRTUAL_EVENT_TEXT_SENSOR,
+  VIRTUAL_EVENT_SWITCH,
+  VIRTUAL_EVENT_BUTTON,
+  VIRTUAL_EVENT_NUMBER,
+};
+
+/** Simulated clock for the host platform.
+ *
+ * millis(), micros() and delay() of the host build use this clock instead of the system clock. Time only moves when
+ * the firmware waits, and Application::loop() waits straight until the next scheduler deadline, so hours of timers
+ * and automations run in a fraction of a second. The scripted events from the `events` file are injected into the
+ * entities at their simulated time, which makes runs reproducible.
+ */
+class VirtualClock : public Component {
+ public:
+  VirtualClock();
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  /// Events must be added in the order of their time.
+  void add_event(uint32_t at_ms, VirtualEventDomain domain, uint32_t object_id_hash, const char *value) {
+    this->events_.push_back({at_ms, domain, object_id_hash, value, nullptr});
+  }
+  /// Ends the simulation with a summary once this much time was simulated, 0 runs forever.
+  void set_stop_after(uint32_t stop_after_s) { this->stop_after_us_ = uint64_t(stop_after_s) * 1000000ULL; }
+
+  uint64_t now_us() const { return this->now_us_; }
+  /// Moves the clock forward, but never past the next scripted event or the end of the simulation.
+  void advance_us(uint64_t us);
+
+  /// The simulated UNIX time, starts at the real time of the start of the simulation.
+  time_t epoch_now() const { return this->epoch_offset_ + static_cast<time_t>(this->now_us_ / 1000000ULL); }
+  void set_epoch(time_t epoch) { this->epoch_offset_ = epoch - static_cast<time_t>(this->now_us_ / 1000000ULL); }
+
+ protected:
+  struct Event {
+    uint32_t at_ms;
+    VirtualEventDomain domain;
+    uint32_t object_id_hash;
+    const char *value;
+    EntityBase *target;
+  };
+
+  EntityBase *find_target_(const Event &event);
+  void fire_(const Event &event);
+  void finish_();
+
+  std::vector<Event> events_;
+  size_t next_event_{0};
+  uint64_t now_us_{0};
+  uint64_t stop_after_us_{0};
+  time_t epoch_offset_;
+  uint64_t wall_start_us_;
+  uint32_t loops_{0};
+  uint32_t jumps_{0};
+  uint32_t fired_{0};
+};
+
+extern VirtualClock *global_virtual_clock;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST_VIRTUAL_TIME
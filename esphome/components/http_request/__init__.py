@@ -14,7 +14,13 @@ from esphome.const import (
 from esphome.core import Lambda, CORE
 
 DEPENDENCIES = ["network"]
-AUTO_LOAD = ["json"]
+
+
+def AUTO_LOAD():
+    if CORE.is_esp8266:
+        return ["json"]
+    return ["json", "socket"]
+
 
 http_request_ns = cg.esphome_ns.namespace("http_request")
 HttpRequestComponent = http_request_ns.class_("HttpRequestComponent", cg.Component)
@@ -24,6 +30,9 @@ HttpRequestSendAction = http_request_ns.class_(
 HttpRequestResponseTrigger = http_request_ns.class_(
     "HttpRequestResponseTrigger", automation.Trigger
 )
+HttpRequestDataTrigger = http_request_ns.class_(
+    "HttpRequestDataTrigger", automation.Trigger
+)
 
 CONF_HEADERS = "headers"
 CONF_USERAGENT = "useragent"
@@ -31,6 +40,7 @@ CONF_BODY = "body"
 CONF_JSON = "json"
 CONF_VERIFY_SSL = "verify_ssl"
 CONF_ON_RESPONSE = "on_response"
+CONF_ON_DATA = "on_data"
 CONF_FOLLOW_REDIRECTS = "follow_redirects"
 CONF_REDIRECT_LIMIT = "redirect_limit"
 
@@ -65,9 +75,24 @@ def validate_secure_url(config):
             "Currently ESPHome doesn't support SSL verification. "
             "Set 'verify_ssl: false' to make insecure HTTPS requests."
         )
+    if (
+        CORE.is_host
+        and not isinstance(url_, Lambda)
+        and url_.lower().startswith("https:")
+    ):
+        raise cv.Invalid("HTTPS is not supported on the host platform")
     return config
 
 
+def validate_framework(config):
+    if CORE.is_host:
+        return config
+    return cv.require_framework_version(
+        esp8266_arduino=cv.Version(2, 5, 1),
+        esp32_arduino=cv.Version(0, 0, 0),
+    )(config)
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -83,10 +108,7 @@ CONFIG_SCHEMA = cv.All(
             ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
-    cv.require_framework_version(
-        esp8266_arduino=cv.Version(2, 5, 1),
-        esp32_arduino=cv.Version(0, 0, 0),
-    ),
+    validate_framework,
 )
 
 
@@ -99,6 +121,9 @@ async def to_code(config):
 
     if CORE.is_esp8266 and not config[CONF_ESP8266_DISABLE_SSL_SUPPORT]:
         cg.add_define("USE_HTTP_REQUEST_ESP8266_HTTPS")
+    if not CORE.is_esp8266:
+        # plain http requests run from the loop on top of the socket component
+        cg.add_define("USE_HTTP_REQUEST_ASYNC")
 
     if CORE.is_esp32:
         cg.add_library("WiFiClientSecure", None)
@@ -120,6 +145,9 @@ HTTP_REQUEST_ACTION_SCHEMA = cv.Schema(
         cv.Optional(CONF_ON_RESPONSE): automation.validate_automation(
             {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(HttpRequestResponseTrigger)}
         ),
+        cv.Optional(CONF_ON_DATA): automation.validate_automation(
+            {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(HttpRequestDataTrigger)}
+        ),
     }
 ).add_extra(validate_secure_url)
 HTTP_REQUEST_GET_ACTION_SCHEMA = automation.maybe_conf(
@@ -198,5 +226,13 @@ async def http_request_action_to_code(config, action_id, template_arg, args):
         await automation.build_automation(
             trigger, [(int, "status_code"), (cg.uint32, "duration_ms")], conf
         )
+    for conf in config.get(CONF_ON_DATA, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
+        cg.add(var.register_data_trigger(trigger))
+        await automation.build_automation(
+            trigger,
+            [(cg.std_vector.template(cg.uint8).operator("ref").operator("const"), "x")],
+            conf,
+        )
 
     return var
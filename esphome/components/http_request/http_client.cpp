@@ -0,0 +1,541 @@
+#include "http_client.h"
+
+#ifdef USE_HTTP_REQUEST_ASYNC
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef USE_SOCKET_IMPL_LWIP_SOCKETS
+#include <lwip/netdb.h>
+#else
+#include <netdb.h>
+#endif
+
+namespace esphome {
+namespace http_request {
+
+static const char *const TAG = "http_request.client";
+
+/// idle connections are closed after this time, shorter than the keep-alive timeout of most servers
+static const uint32_t IDLE_CONNECTION_TIMEOUT = 4000;
+static const size_t MAX_HEADER_SIZE = 4096;
+static const size_t MAX_CHUNK_LINE_SIZE = 256;
+/// limits the time one loop() spends reading a long response
+static const uint8_t MAX_READS_PER_LOOP = 8;
+
+const char *http_client_error_to_str(int32_t error) {
+  switch (error) {
+    case HTTP_ERROR_CONNECTION_REFUSED:
+      return "connection refused";
+    case HTTP_ERROR_SEND_HEADER_FAILED:
+      return "send header failed";
+    case HTTP_ERROR_SEND_PAYLOAD_FAILED:
+      return "send payload failed";
+    case HTTP_ERROR_NOT_CONNECTED:
+      return "not connected";
+    case HTTP_ERROR_CONNECTION_LOST:
+      return "connection lost";
+    case HTTP_ERROR_NO_HTTP_SERVER:
+      return "no HTTP server";
+    case HTTP_ERROR_TOO_LESS_RAM:
+      return "too less ram";
+    case HTTP_ERROR_ENCODING:
+      return "Transfer-Encoding not supported";
+    case HTTP_ERROR_READ_TIMEOUT:
+      return "read Timeout";
+    default:
+      return "unknown";
+  }
+}
+
+bool parse_url(const std::string &url, HttpUrl &out) {
+  size_t scheme_end = url.find("://");
+  if (scheme_end == std::string::npos)
+    return false;
+  std::string scheme = str_lower_case(url.substr(0, scheme_end));
+  if (scheme == "http") {
+    out.secure = false;
+    out.port = 80;
+  } else if (scheme == "https") {
+    out.secure = true;
+    out.port = 443;
+  } else {
+    return false;
+  }
+
+  size_t host_start = scheme_end + 3;
+  size_t path_start = url.find_first_of("/?#", host_start);
+  std::string authority = url.substr(host_start, path_start - host_start);
+  size_t at = authority.rfind('@');
+  if (at != std::string::npos)
+    authority.erase(0, at + 1);
+  // the port follows the last colon, unless it is part of a bracketed IPv6 address
+  size_t colon = authority.rfind(':');
+  if (colon != std::string::npos && authority.find(']', colon) == std::string::npos) {
+    char *end;
+    unsigned long port = strtoul(authority.c_str() + colon + 1, &end, 10);  // NOLINT(google-runtime-int)
+    if (*end != '\0' || port == 0 || port > 65535)
+      return false;
+    out.port = port;
+    authority.erase(colon);
+  }
+  if (authority.size() > 2 && authority.front() == '[' && authority.back() == ']')
+    authority = authority.substr(1, authority.size() - 2);
+  if (authority.empty())
+    return false;
+  out.host = authority;
+
+  out.path = path_start == std::string::npos ? "/" : url.substr(path_start);
+  size_t fragment = out.path.find('#');
+  if (fragment != std::string::npos)
+    out.path.erase(fragment);
+  if (out.path.empty() || out.path.front() != '/')
+    out.path.insert(0, "/");
+  return true;
+}
+
+void AsyncHttpClient::send(AsyncHttpRequest &&request) { this->queue_.push_back(std::move(request)); }
+
+bool AsyncHttpClient::loop() {
+  uint32_t now = millis();
+  this->reading_ = false;
+  this->close_idle_connections_(now);
+  if (this->state_ == STATE_IDLE) {
+    if (this->queue_.empty())
+      return false;
+    this->start_(now);
+  }
+
+  if (this->state_ == STATE_CONNECTING && this->connection_.socket->writable() && this->check_connected_()) {
+    this->state_ = STATE_SENDING;
+    this->last_activity_ = millis();
+  }
+  if (this->state_ == STATE_SENDING && this->send_())
+    this->state_ = STATE_RECEIVING_HEADERS;
+  if (this->state_ == STATE_RECEIVING_HEADERS)
+    this->receive_headers_();
+  if (this->state_ == STATE_RECEIVING_BODY)
+    this->receive_body_();
+
+  if (this->state_ != STATE_IDLE && millis() - this->last_activity_ > this->timeout_) {
+    ESP_LOGV(TAG, "Timeout waiting for %s:%u", this->url_.host.c_str(), this->url_.port);
+    this->connection_.socket.reset();
+    this->keep_alive_ = false;
+    this->redirecting_ = false;
+    this->finish_(this->state_ == STATE_CONNECTING ? HTTP_ERROR_CONNECTION_REFUSED : HTTP_ERROR_READ_TIMEOUT);
+  }
+  if (this->connection_.socket != nullptr) {
+    // the connection and a full send buffer wake the loop up once the socket becomes writable
+    this->connection_.socket->set_write_interest(this->state_ == STATE_CONNECTING || this->state_ == STATE_SENDING);
+  }
+  // waiting for the server doesn't need the high frequency loop, the monitored socket wakes the loop up
+  return this->reading_ || (this->state_ == STATE_IDLE && !this->queue_.empty());
+}
+
+void AsyncHttpClient::start_(uint32_t now) {
+  this->request_ = std::move(this->queue_.front());
+  this->queue_.pop_front();
+  this->start_time_ = now;
+  this->redirects_ = 0;
+  if (!parse_url(this->request_.url, this->url_) || this->url_.secure) {
+    ESP_LOGW(TAG, "Unsupported URL %s", this->request_.url.c_str());
+    this->finish_(HTTP_ERROR_NOT_CONNECTED);
+    return;
+  }
+  this->connect_(now);
+}
+
+void AsyncHttpClient::connect_(uint32_t now) {
+  this->last_activity_ = now;
+  this->received_ = false;
+  this->build_request_();
+
+  // reuse an idle connection to the same host, unless the server closed it in the meantime
+  for (auto it = this->pool_.begin(); it != this->pool_.end();) {
+    if (it->host != this->url_.host || it->port != this->url_.port) {
+      ++it;
+      continue;
+    }
+    Connection connection = std::move(*it);
+    it = this->pool_.erase(it);
+    uint8_t probe;
+    if (connection.socket->read(&probe, 1) < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      ESP_LOGV(TAG, "Reusing the connection to %s:%u", this->url_.host.c_str(), this->url_.port);
+      this->connection_ = std::move(connection);
+      this->reused_ = true;
+      this->state_ = STATE_SENDING;
+      return;
+    }
+  }
+
+  this->reused_ = false;
+  this->connection_.host = this->url_.host;
+  this->connection_.port = this->url_.port;
+  struct addrinfo hints {};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *res = nullptr;
+  std::string port = to_string(this->url_.port);
+  int err = getaddrinfo(this->url_.host.c_str(), port.c_str(), &hints, &res);
+  if (err != 0 || res == nullptr) {
+    ESP_LOGW(TAG, "Could not resolve %s", this->url_.host.c_str());
+    this->finish_(HTTP_ERROR_CONNECTION_REFUSED);
+    return;
+  }
+  this->connection_.socket = socket::socket_loop_monitored(res->ai_family, SOCK_STREAM, 0);
+  if (this->connection_.socket == nullptr) {
+    freeaddrinfo(res);
+    this->finish_(HTTP_ERROR_TOO_LESS_RAM);
+    return;
+  }
+  this->connection_.socket->setblocking(false);
+  err = this->connection_.socket->connect(res->ai_addr, res->ai_addrlen);
+  freeaddrinfo(res);
+  if (err != 0 && errno != EINPROGRESS) {
+    ESP_LOGV(TAG, "Connecting to %s:%u failed: errno %d", this->url_.host.c_str(), this->url_.port, errno);
+    this->connection_.socket.reset();
+    this->finish_(HTTP_ERROR_CONNECTION_REFUSED);
+    return;
+  }
+  this->state_ = STATE_CONNECTING;
+}
+
+void AsyncHttpClient::build_request_() {
+  std::string &req = this->buffer_;
+  req.clear();
+  req.reserve(128 + this->request_.body.size());
+  req.append(this->request_.method).append(" ").append(this->url_.path).append(" HTTP/1.1\r\nHost: ");
+  req.append(this->url_.host);
+  if (this->url_.port != 80)
+    req.append(":").append(to_string(this->url_.port));
+  req.append("\r\n");
+  if (this->useragent_ != nullptr)
+    req.append("User-Agent: ").append(this->useragent_).append("\r\n");
+  req.append("Accept-Encoding: identity\r\n");
+  for (const auto &header : this->request_.headers)
+    req.append(header.first).append(": ").append(header.second).append("\r\n");
+  const std::string &method = this->request_.method;
+  if (!this->request_.body.empty() || method == "POST" || method == "PUT" || method == "PATCH")
+    req.append("Content-Length: ").append(to_string(this->request_.body.size())).append("\r\n");
+  req.append("\r\n");
+  req.append(this->request_.body);
+  this->sent_ = 0;
+}
+
+bool AsyncHttpClient::check_connected_() {
+  struct sockaddr_storage addr;
+  socklen_t len = sizeof(addr);
+  if (this->connection_.socket->getpeername(reinterpret_cast<struct sockaddr *>(&addr), &len) == 0)
+    return true;
+  int err = errno;
+  if (err == ENOTCONN) {
+    len = sizeof(err);
+    if (this->connection_.socket->getsockopt(SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err == 0)
+      return false;
+  }
+  ESP_LOGV(TAG, "Connecting to %s:%u failed: errno %d", this->url_.host.c_str(), this->url_.port, err);
+  this->fail_(HTTP_ERROR_CONNECTION_REFUSED);
+  return false;
+}
+
+bool AsyncHttpClient::send_() {
+  while (this->sent_ < this->buffer_.size()) {
+    ssize_t ret =
+        this->connection_.socket->write(this->buffer_.data() + this->sent_, this->buffer_.size() - this->sent_);
+    if (ret < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+        return false;
+      this->fail_(HTTP_ERROR_SEND_HEADER_FAILED);
+      return false;
+    }
+    this->sent_ += ret;
+    this->last_activity_ = millis();
+  }
+  this->buffer_.clear();
+  return true;
+}
+
+bool AsyncHttpClient::receive_headers_() {
+  uint8_t buf[512];
+  for (uint8_t i = 0; i < MAX_READS_PER_LOOP && this->state_ == STATE_RECEIVING_HEADERS; i++) {
+    ssize_t ret = this->connection_.socket->read(buf, sizeof(buf));
+    if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+      return false;
+    if (ret <= 0) {
+      this->fail_(HTTP_ERROR_CONNECTION_LOST);
+      return false;
+    }
+    this->received_ = true;
+    this->last_activity_ = millis();
+    this->buffer_.append(reinterpret_cast<const char *>(buf), ret);
+    if (this->parse_headers_())
+      return true;
+  }
+  // stopped before the socket ran dry
+  this->reading_ = this->state_ == STATE_RECEIVING_HEADERS;
+  return false;
+}
+
+bool AsyncHttpClient::parse_headers_() {
+  size_t end = this->buffer_.find("\r\n\r\n");
+  if (end == std::string::npos) {
+    if (this->buffer_.size() > MAX_HEADER_SIZE) {
+      this->keep_alive_ = false;
+      this->fail_(HTTP_ERROR_TOO_LESS_RAM);
+    }
+    return false;
+  }
+
+  // status line, e.g. "HTTP/1.1 200 OK"
+  if (this->buffer_.compare(0, 5, "HTTP/") != 0 || this->buffer_.size() < 12) {
+    this->keep_alive_ = false;
+    this->fail_(HTTP_ERROR_NO_HTTP_SERVER);
+    return false;
+  }
+  this->status_code_ = atoi(this->buffer_.c_str() + 9);
+  this->keep_alive_ = this->buffer_.compare(0, 8, "HTTP/1.0") != 0;
+  this->chunked_ = false;
+  this->until_close_ = true;
+  this->location_.clear();
+
+  size_t pos = this->buffer_.find("\r\n") + 2;
+  while (pos < end) {
+    size_t line_end = this->buffer_.find("\r\n", pos);
+    size_t colon = this->buffer_.find(':', pos);
+    if (colon < line_end) {
+      std::string name = str_lower_case(this->buffer_.substr(pos, colon - pos));
+      size_t value_start = this->buffer_.find_first_not_of(" \t", colon + 1);
+      std::string value = value_start < line_end ? this->buffer_.substr(value_start, line_end - value_start) : "";
+      if (name == "content-length") {
+        this->remaining_ = strtoul(value.c_str(), nullptr, 10);
+        this->until_close_ = false;
+      } else if (name == "transfer-encoding") {
+        this->chunked_ = str_lower_case(value).find("chunked") != std::string::npos;
+      } else if (name == "connection") {
+        std::string lower = str_lower_case(value);
+        if (lower.find("close") != std::string::npos) {
+          this->keep_alive_ = false;
+        } else if (lower.find("keep-alive") != std::string::npos) {
+          this->keep_alive_ = true;
+        }
+      } else if (name == "location") {
+        this->location_ = value;
+      }
+    }
+    pos = line_end + 2;
+  }
+  std::string rest = this->buffer_.substr(end + 4);
+  this->buffer_.clear();
+
+  if (this->status_code_ == 100) {
+    // interim response, the real one follows
+    this->buffer_ = std::move(rest);
+    return this->parse_headers_();
+  }
+  ESP_LOGV(TAG, "Response %" PRId32 " from %s:%u", this->status_code_, this->url_.host.c_str(), this->url_.port);
+
+  bool redirect = this->status_code_ == 301 || this->status_code_ == 302 || this->status_code_ == 303 ||
+                  this->status_code_ == 307 || this->status_code_ == 308;
+  this->redirecting_ =
+      redirect && this->follow_redirects_ && !this->location_.empty() && this->redirects_ < this->redirect_limit_;
+  this->state_ = STATE_RECEIVING_BODY;
+  if (this->chunked_) {
+    this->until_close_ = false;
+    this->chunk_state_ = CHUNK_SIZE;
+  } else if (this->until_close_) {
+    this->keep_alive_ = false;
+  }
+  bool no_body = this->request_.method == "HEAD" || this->status_code_ == 204 || this->status_code_ == 304;
+  if (no_body || (!this->chunked_ && !this->until_close_ && this->remaining_ == 0)) {
+    if (!rest.empty())
+      this->keep_alive_ = false;
+    this->finish_(this->status_code_);
+    return true;
+  }
+  if (!rest.empty())
+    this->feed_body_(reinterpret_cast<const uint8_t *>(rest.data()), rest.size());
+  return true;
+}
+
+bool AsyncHttpClient::receive_body_() {
+  uint8_t buf[512];
+  for (uint8_t i = 0; i < MAX_READS_PER_LOOP && this->state_ == STATE_RECEIVING_BODY; i++) {
+    ssize_t ret = this->connection_.socket->read(buf, sizeof(buf));
+    if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+      return false;
+    if (ret <= 0) {
+      if (this->until_close_ && ret == 0) {
+        this->finish_(this->status_code_);
+        return true;
+      }
+      this->fail_(HTTP_ERROR_CONNECTION_LOST);
+      return false;
+    }
+    this->last_activity_ = millis();
+    this->feed_body_(buf, ret);
+  }
+  // stopped before the socket ran dry
+  this->reading_ = this->state_ == STATE_RECEIVING_BODY;
+  return this->state_ != STATE_RECEIVING_BODY;
+}
+
+void AsyncHttpClient::feed_body_(const uint8_t *data, size_t len) {
+  if (!this->chunked_) {
+    if (this->until_close_) {
+      this->deliver_(data, len);
+      return;
+    }
+    size_t n = std::min<size_t>(len, this->remaining_);
+    this->deliver_(data, n);
+    this->remaining_ -= n;
+    if (this->remaining_ == 0) {
+      // a server sending more than announced can't be trusted with the next request
+      if (n < len)
+        this->keep_alive_ = false;
+      this->finish_(this->status_code_);
+    }
+    return;
+  }
+
+  while (len > 0 && this->state_ == STATE_RECEIVING_BODY) {
+    if (this->chunk_state_ == CHUNK_DATA) {
+      size_t n = std::min<size_t>(len, this->remaining_);
+      this->deliver_(data, n);
+      data += n;
+      len -= n;
+      this->remaining_ -= n;
+      if (this->remaining_ == 0)
+        this->chunk_state_ = CHUNK_DATA_END;
+      continue;
+    }
+
+    // the other states consume lines
+    char c = static_cast<char>(*data++);
+    len--;
+    if (c != '\n') {
+      if (c != '\r')
+        this->buffer_.push_back(c);
+      if (this->buffer_.size() > MAX_CHUNK_LINE_SIZE) {
+        this->keep_alive_ = false;
+        this->fail_(HTTP_ERROR_ENCODING);
+      }
+      continue;
+    }
+    if (this->chunk_state_ == CHUNK_SIZE) {
+      char *end;
+      this->remaining_ = strtoul(this->buffer_.c_str(), &end, 16);
+      if (end == this->buffer_.c_str()) {
+        this->keep_alive_ = false;
+        this->fail_(HTTP_ERROR_ENCODING);
+        return;
+      }
+      this->chunk_state_ = this->remaining_ == 0 ? CHUNK_TRAILER : CHUNK_DATA;
+    } else if (this->chunk_state_ == CHUNK_DATA_END) {
+      this->chunk_state_ = CHUNK_SIZE;
+    } else if (this->buffer_.empty()) {
+      // the empty line after the trailer ends the body, a redirect writes the next request into the buffer
+      if (len > 0)
+        this->keep_alive_ = false;
+      this->finish_(this->status_code_);
+      return;
+    }
+    this->buffer_.clear();
+  }
+}
+
+void AsyncHttpClient::deliver_(const uint8_t *data, size_t len) {
+  // the body of a redirect is dropped
+  if (len == 0 || this->redirecting_ || !this->request_.on_data)
+    return;
+  this->request_.on_data(data, len);
+}
+
+void AsyncHttpClient::finish_(int32_t status_code) {
+  if (this->redirecting_ && this->redirect_())
+    return;
+  this->redirecting_ = false;
+  if (status_code > 0) {
+    this->release_connection_();
+  } else {
+    this->connection_.socket.reset();
+  }
+  this->buffer_.clear();
+  this->buffer_.shrink_to_fit();
+  this->state_ = STATE_IDLE;
+
+  AsyncHttpRequest request = std::move(this->request_);
+  this->request_ = {};
+  if (request.on_complete)
+    request.on_complete(status_code, millis() - this->start_time_);
+}
+
+void AsyncHttpClient::fail_(int32_t status_code) {
+  this->connection_.socket.reset();
+  if (this->reused_ && !this->received_) {
+    // the server closed the idle connection just before it was reused
+    ESP_LOGV(TAG, "Reused connection to %s:%u was closed, reconnecting", this->url_.host.c_str(), this->url_.port);
+    this->connect_(millis());
+    return;
+  }
+  this->keep_alive_ = false;
+  this->redirecting_ = false;
+  this->finish_(status_code);
+}
+
+bool AsyncHttpClient::redirect_() {
+  std::string url = this->location_;
+  if (!url.empty() && url.front() == '/') {
+    url.insert(0, "http://" + this->url_.host + ":" + to_string(this->url_.port));
+  }
+  HttpUrl target;
+  if (!parse_url(url, target) || target.secure) {
+    ESP_LOGW(TAG, "Can't follow the redirect to %s", this->location_.c_str());
+    return false;
+  }
+  ESP_LOGV(TAG, "Redirect %" PRId32 " to %s", this->status_code_, url.c_str());
+  this->redirecting_ = false;
+  this->release_connection_();
+  this->redirects_++;
+  if (this->status_code_ == 303) {
+    this->request_.method = "GET";
+    this->request_.body.clear();
+  }
+  this->request_.url = url;
+  this->url_ = target;
+  this->connect_(millis());
+  return true;
+}
+
+void AsyncHttpClient::release_connection_() {
+  if (this->connection_.socket != nullptr && this->keep_alive_ && this->max_idle_connections_ > 0) {
+    if (this->pool_.size() >= this->max_idle_connections_)
+      this->pool_.erase(this->pool_.begin());
+    this->connection_.last_used = millis();
+    this->pool_.push_back(std::move(this->connection_));
+  }
+  this->connection_.socket.reset();
+}
+
+void AsyncHttpClient::close_idle_connections_(uint32_t now) {
+  for (auto it = this->pool_.begin(); it != this->pool_.end();) {
+    // an idle connection only becomes readable when the server closes it, it would wake the loop over and over
+    uint8_t probe;
+    if (now - it->last_used > IDLE_CONNECTION_TIMEOUT ||
+        (it->socket->ready() && (it->socket->read(&probe, 1) >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)))) {
+      it = this->pool_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace http_request
+}  // namespace esphome
+
+#endif  // USE_HTTP_REQUEST_ASYNC
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_HTTP_REQUEST_ASYNC
+
+#include "esphome/components/socket/socket.h"
+#include "esphome/core/helpers.h"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+namespace http_request {
+
+/// Negative status codes reported for failed requests, the values match the ones of the Arduino HTTPClient.
+enum HttpClientError : int32_t {
+  HTTP_ERROR_CONNECTION_REFUSED = -1,
+  HTTP_ERROR_SEND_HEADER_FAILED = -2,
+  HTTP_ERROR_SEND_PAYLOAD_FAILED = -3,
+  HTTP_ERROR_NOT_CONNECTED = -4,
+  HTTP_ERROR_CONNECTION_LOST = -5,
+  HTTP_ERROR_NO_HTTP_SERVER = -7,
+  HTTP_ERROR_TOO_LESS_RAM = -8,
+  HTTP_ERROR_ENCODING = -9,
+  HTTP_ERROR_READ_TIMEOUT = -11,
+};
+
+const char *http_client_error_to_str(int32_t error);
+
+struct HttpUrl {
+  bool secure;
+  std::string host;
+  uint16_t port;
+  std::string path;  ///< path including the query, always starts with '/'
+};
+
+/// Split an http(s) URL into its parts, returns false if it is not a valid absolute URL.
+bool parse_url(const std::string &url, HttpUrl &out);
+
+struct AsyncHttpRequest {
+  std::string method;
+  std::string url;
+  std::string body;
+  std::vector<std::pair<std::string, std::string>> headers;
+  /// called with the (de-chunked) response body as it arrives
+  std::function<void(const uint8_t *data, size_t len)> on_data;
+  /// called once with the status code (or a negative HttpClientError) and the duration
+  std::function<void(int32_t status_code, uint32_t duration_ms)> on_complete;
+};
+
+/** HTTP/1.1 client that runs its requests as a state machine from the loop.
+ *
+ * Requests are queued and run one after another, every call to loop() does as much as is possible without blocking
+ * and then returns. Connections are kept alive and reused for the next request to the same host, a few idle ones are
+ * kept in a pool. Only the name resolution blocks, which lwIP answers from its cache after the first request.
+ */
+class AsyncHttpClient {
+ public:
+  void set_timeout(uint32_t timeout) { this->timeout_ = timeout; }
+  void set_useragent(const char *useragent) { this->useragent_ = useragent; }
+  void set_follow_redirects(bool follow_redirects) { this->follow_redirects_ = follow_redirects; }
+  void set_redirect_limit(uint16_t limit) { this->redirect_limit_ = limit; }
+  void set_max_idle_connections(uint8_t max_idle_connections) { this->max_idle_connections_ = max_idle_connections; }
+
+  void send(AsyncHttpRequest &&request);
+  /** Advances the current request, returns true while there is data to process.
+   *
+   * That is a request to start, or a response that arrives faster than one call reads it. Waiting for the connection,
+   * for space in the send buffer or for the response doesn't count, use queued() to know whether requests are left.
+   */
+  bool loop();
+
+  size_t queued() const { return this->queue_.size() + (this->state_ != STATE_IDLE ? 1 : 0); }
+  size_t idle_connections() const { return this->pool_.size(); }
+
+ protected:
+  enum State : uint8_t {
+    STATE_IDLE,
+    STATE_CONNECTING,
+    STATE_SENDING,
+    STATE_RECEIVING_HEADERS,
+    STATE_RECEIVING_BODY,
+  };
+  enum ChunkState : uint8_t {
+    CHUNK_SIZE,
+    CHUNK_DATA,
+    CHUNK_DATA_END,
+    CHUNK_TRAILER,
+  };
+
+  struct Connection {
+    std::string host;
+    uint16_t port;
+    std::unique_ptr<socket::Socket> socket;
+    uint32_t last_used;
+  };
+
+  void start_(uint32_t now);
+  void connect_(uint32_t now);
+  void build_request_();
+  bool check_connected_();
+  bool send_();
+  bool receive_headers_();
+  bool parse_headers_();
+  bool receive_body_();
+  void feed_body_(const uint8_t *data, size_t len);
+  void deliver_(const uint8_t *data, size_t len);
+  /// Ends the current request, returns the connection to the pool if it can be reused.
+  void finish_(int32_t status_code);
+  /// Handles a failed connection, a reused connection may have been closed by the server, so it is retried once.
+  void fail_(int32_t status_code);
+  bool redirect_();
+  /// Keeps the connection in the pool if the server allows it, closes it otherwise.
+  void release_connection_();
+  void close_idle_connections_(uint32_t now);
+
+  std::deque<AsyncHttpRequest> queue_;
+  std::vector<Connection> pool_;
+
+  // the current request
+  AsyncHttpRequest request_;
+  HttpUrl url_;
+  Connection connection_;
+  State state_{STATE_IDLE};
+  bool reused_{false};
+  bool keep_alive_{false};
+  bool chunked_{false};
+  bool until_close_{false};
+  bool received_{false};
+  bool redirecting_{false};
+  bool reading_{false};  ///< the last loop() stopped reading before the socket ran dry
+  ChunkState chunk_state_{CHUNK_SIZE};
+  uint8_t redirects_{0};
+  int32_t status_code_{0};
+  uint32_t remaining_{0};  ///< bytes left of the body or of the current chunk
+  uint32_t start_time_{0};
+  uint32_t last_activity_{0};
+  std::string buffer_;  ///< request while sending, headers and chunk sizes while receiving
+  size_t sent_{0};
+  std::string location_;
+
+  const char *useragent_{nullptr};
+  uint32_t timeout_{5000};
+  uint16_t redirect_limit_{3};
+  bool follow_redirects_{true};
+  uint8_t max_idle_connections_{2};
+};
+
+}  // namespace http_request
+}  // namespace esphome
+
+#endif  // USE_HTTP_REQUEST_ASYNC
@@ -1,10 +1,14 @@
-#ifdef USE_ARDUINO
-
 #include "http_request.h"
+
+#if defined(USE_ARDUINO) || defined(USE_HOST)
+
 #include "esphome/core/defines.h"
 #include "esphome/core/log.h"
 #include "esphome/components/network/util.h"
 
+#include <cinttypes>
+#include <cstring>
+
 namespace esphome {
 namespace http_request {
 
@@ -18,6 +22,112 @@ void HttpRequestComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "  Redirect limit: %d", this->redirect_limit_);
 }
 
+#ifdef USE_HTTP_REQUEST_ASYNC
+void HttpRequestComponent::loop() {
+  if (this->async_client_.loop()) {
+    this->high_freq_.start();
+  } else {
+    this->high_freq_.stop();
+  }
+}
+#endif
+
+void HttpRequestComponent::queue_request(const std::string &url, const char *method, const std::string &body,
+                                         const std::vector<std::pair<std::string, std::string>> &headers,
+                                         const std::vector<HttpRequestResponseTrigger *> &response_triggers,
+                                         const std::vector<HttpRequestDataTrigger *> &data_triggers,
+                                         const std::function<void()> &on_done) {
+#ifdef USE_HTTP_REQUEST_ASYNC
+  if (!str_startswith(str_lower_case(url), "https:")) {
+    if (!network::is_connected()) {
+      this->status_set_warning();
+      ESP_LOGW(TAG, "HTTP Request failed; Not connected to network");
+      if (on_done)
+        on_done();
+      return;
+    }
+    AsyncHttpRequest request;
+    request.method = method;
+    request.url = url;
+    request.body = body;
+    request.headers = headers;
+    auto response_body = std::make_shared<std::string>();
+    if (data_triggers.empty()) {
+      request.on_data = [response_body](const uint8_t *data, size_t len) {
+        response_body->append(reinterpret_cast<const char *>(data), len);
+      };
+    } else {
+      request.on_data = [data_triggers](const uint8_t *data, size_t len) {
+        std::vector<uint8_t> chunk(data, data + len);
+        for (auto *trigger : data_triggers)
+          trigger->process(chunk);
+      };
+    }
+    request.on_complete = [this, url, response_body, response_triggers, on_done](int32_t status_code,
+                                                                                  uint32_t duration) {
+      this->response_body_ = response_body;
+      for (auto *trigger : response_triggers)
+        trigger->process(status_code, duration);
+      this->response_body_.reset();
+      this->report_response_(url, status_code, duration);
+      if (on_done)
+        on_done();
+    };
+    this->async_client_.send(std::move(request));
+    this->high_freq_.start();
+    return;
+  }
+#endif
+
+#ifdef USE_ARDUINO
+  this->set_url(url);
+  this->set_method(method);
+  this->set_body(body);
+  std::list<Header> header_list;
+  for (const auto &header : headers)
+    header_list.push_back({header.first.c_str(), header.second.c_str()});
+  this->set_headers(header_list);
+  this->send(response_triggers);
+  if (!data_triggers.empty()) {
+    // the blocking client delivers the whole body at once
+    const char *response = this->get_string();
+    std::vector<uint8_t> data(response, response + strlen(response));
+    for (auto *trigger : data_triggers)
+      trigger->process(data);
+  }
+  this->close();
+  this->set_body("");
+  this->headers_.clear();
+#else
+  ESP_LOGW(TAG, "HTTP Request failed; HTTPS is not supported on this platform; URL: %s", url.c_str());
+  this->status_set_warning();
+#endif
+  if (on_done)
+    on_done();
+}
+
+#ifdef USE_HTTP_REQUEST_ASYNC
+void HttpRequestComponent::report_response_(const std::string &url, int32_t status_code, uint32_t duration) {
+  if (status_code < 0) {
+    ESP_LOGW(TAG, "HTTP Request failed; URL: %s; Error: %s; Duration: %" PRIu32 " ms", url.c_str(),
+             http_client_error_to_str(status_code), duration);
+    this->status_set_warning();
+    return;
+  }
+  if (status_code < 200 || status_code >= 300) {
+    ESP_LOGW(TAG, "HTTP Request failed; URL: %s; Code: %" PRId32 "; Duration: %" PRIu32 " ms", url.c_str(),
+             status_code, duration);
+    this->status_set_warning();
+    return;
+  }
+  this->status_clear_warning();
+  ESP_LOGD(TAG, "HTTP Request completed; URL: %s; Code: %" PRId32 "; Duration: %" PRIu32 " ms", url.c_str(),
+           status_code, duration);
+}
+#endif
+
+#ifdef USE_ARDUINO
+
 void HttpRequestComponent::set_url(std::string url) {
   this->url_ = std::move(url);
   this->secure_ = this->url_.compare(0, 6, "https:") == 0;
@@ -124,7 +234,16 @@ void HttpRequestComponent::close() {
   this->client_.end();
 }
 
+#endif  // USE_ARDUINO
+
 const char *HttpRequestComponent::get_string() {
+#ifdef USE_HTTP_REQUEST_ASYNC
+  if (this->response_body_ != nullptr)
+    return this->response_body_->c_str();
+#endif
+#ifndef USE_ARDUINO
+  return "";
+#else
 #if defined(ESP32)
   // The static variable is here because HTTPClient::getString() returns a String on ESP32,
   // and we need something to keep a buffer alive.
@@ -136,9 +255,10 @@ const char *HttpRequestComponent::get_string() {
 #endif
   str = this->client_.getString();
   return str.c_str();
+#endif  // USE_ARDUINO
 }
 
 }  // namespace http_request
 }  // namespace esphome
 
-#endif  // USE_ARDUINO
+#endif  // USE_ARDUINO || USE_HOST
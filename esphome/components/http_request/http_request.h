@@ -1,18 +1,23 @@
 #pragma once
 
-#ifdef USE_ARDUINO
+#include "esphome/core/defines.h"
+
+#if defined(USE_ARDUINO) || defined(USE_HOST)
 
 #include "esphome/components/json/json_util.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
-#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+#include "http_client.h"
 
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#ifdef USE_ARDUINO
 #ifdef USE_ESP32
 #include <HTTPClient.h>
 #endif
@@ -22,6 +27,7 @@
 #include <WiFiClientSecure.h>
 #endif
 #endif
+#endif  // USE_ARDUINO
 
 namespace esphome {
 namespace http_request {
@@ -36,35 +42,90 @@ class HttpRequestResponseTrigger : public Trigger<int32_t, uint32_t> {
   void process(int32_t status_code, uint32_t duration_ms) { this->trigger(status_code, duration_ms); }
 };
 
+class HttpRequestDataTrigger : public Trigger<const std::vector<uint8_t> &> {
+ public:
+  void process(const std::vector<uint8_t> &data) { this->trigger(data); }
+};
+
 class HttpRequestComponent : public Component {
  public:
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+#ifdef USE_HTTP_REQUEST_ASYNC
+  void loop() override;
+#endif
+
+  void set_useragent(const char *useragent) {
+    this->useragent_ = useragent;
+#ifdef USE_HTTP_REQUEST_ASYNC
+    this->async_client_.set_useragent(useragent);
+#endif
+  }
+  void set_timeout(uint16_t timeout) {
+    this->timeout_ = timeout;
+#ifdef USE_HTTP_REQUEST_ASYNC
+    this->async_client_.set_timeout(timeout);
+#endif
+  }
+  void set_follow_redirects(bool follow_redirects) {
+    this->follow_redirects_ = follow_redirects;
+#ifdef USE_HTTP_REQUEST_ASYNC
+    this->async_client_.set_follow_redirects(follow_redirects);
+#endif
+  }
+  void set_redirect_limit(uint16_t limit) {
+    this->redirect_limit_ = limit;
+#ifdef USE_HTTP_REQUEST_ASYNC
+    this->async_client_.set_redirect_limit(limit);
+#endif
+  }
+
+  /** Performs a request without blocking the loop where the platform allows it.
+   *
+   * Plain http requests are queued and run from the loop, reusing the connection to the host. https requests, and all
+   * requests on the ESP8266, use the blocking Arduino HTTPClient. The body is passed to the data triggers in chunks as
+   * it arrives, without data triggers it is collected and available from get_string() in the response triggers.
+   * on_done is called after the response triggers, or once the request failed.
+   */
+  void queue_request(const std::string &url, const char *method, const std::string &body,
+                     const std::vector<std::pair<std::string, std::string>> &headers,
+                     const std::vector<HttpRequestResponseTrigger *> &response_triggers,
+                     const std::vector<HttpRequestDataTrigger *> &data_triggers,
+                     const std::function<void()> &on_done = nullptr);
+  const char *get_string();
 
+#ifdef USE_ARDUINO
+  // blocking interface
   void set_url(std::string url);
   void set_method(const char *method) { this->method_ = method; }
-  void set_useragent(const char *useragent) { this->useragent_ = useragent; }
-  void set_timeout(uint16_t timeout) { this->timeout_ = timeout; }
-  void set_follow_redirects(bool follow_redirects) { this->follow_redirects_ = follow_redirects; }
-  void set_redirect_limit(uint16_t limit) { this->redirect_limit_ = limit; }
   void set_body(const std::string &body) { this->body_ = body; }
   void set_headers(std::list<Header> headers) { this->headers_ = std::move(headers); }
   void send(const std::vector<HttpRequestResponseTrigger *> &response_triggers);
   void close();
-  const char *get_string();
+#endif
 
  protected:
+  const char *useragent_{nullptr};
+  bool follow_redirects_;
+  uint16_t redirect_limit_;
+  uint16_t timeout_{5000};
+#ifdef USE_HTTP_REQUEST_ASYNC
+  void report_response_(const std::string &url, int32_t status_code, uint32_t duration);
+
+  AsyncHttpClient async_client_;
+  HighFrequencyLoopRequester high_freq_;
+  /// body of the request whose response triggers run
+  std::shared_ptr<std::string> response_body_;
+#endif
+#ifdef USE_ARDUINO
   HTTPClient client_{};
   std::string url_;
   std::string last_url_;
   const char *method_;
-  const char *useragent_{nullptr};
   bool secure_;
-  bool follow_redirects_;
-  uint16_t redirect_limit_;
-  uint16_t timeout_{5000};
   std::string body_;
   std::list<Header> headers_;
+#endif
 #ifdef USE_ESP8266
   std::shared_ptr<WiFiClient> wifi_client_;
 #ifdef USE_HTTP_REQUEST_ESP8266_HTTPS
@@ -89,32 +150,35 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
 
   void register_response_trigger(HttpRequestResponseTrigger *trigger) { this->response_triggers_.push_back(trigger); }
 
-  void play(Ts... x) override {
-    this->parent_->set_url(this->url_.value(x...));
-    this->parent_->set_method(this->method_.value(x...));
+  void register_data_trigger(HttpRequestDataTrigger *trigger) { this->data_triggers_.push_back(trigger); }
+
+  void play_complex(Ts... x) override {
+    // the next action runs once the response arrived
+    auto f = std::bind(&HttpRequestSendAction<Ts...>::play_next_, this, x...);
+    this->num_running_++;
+    std::string body;
     if (this->body_.has_value()) {
-      this->parent_->set_body(this->body_.value(x...));
+      body = this->body_.value(x...);
     }
     if (!this->json_.empty()) {
       auto f = std::bind(&HttpRequestSendAction<Ts...>::encode_json_, this, x..., std::placeholders::_1);
-      this->parent_->set_body(json::build_json(f));
+      body = json::build_json(f);
     }
     if (this->json_func_ != nullptr) {
       auto f = std::bind(&HttpRequestSendAction<Ts...>::encode_json_func_, this, x..., std::placeholders::_1);
-      this->parent_->set_body(json::build_json(f));
+      body = json::build_json(f);
     }
-    std::list<Header> headers;
+    std::vector<std::pair<std::string, std::string>> headers;
+    headers.reserve(this->headers_.size());
     for (const auto &item : this->headers_) {
       auto val = item.second;
-      Header header;
-      header.name = item.first;
-      header.value = val.value(x...);
-      headers.push_back(header);
+      headers.emplace_back(item.first, val.value(x...));
     }
-    this->parent_->set_headers(headers);
-    this->parent_->send(this->response_triggers_);
-    this->parent_->close();
-    this->parent_->set_body("");
+    this->parent_->queue_request(this->url_.value(x...), this->method_.value(x...), body, headers,
+                                 this->response_triggers_, this->data_triggers_, f);
+  }
+
+  void play(Ts... x) override { /* ignore - see play_complex */
   }
 
  protected:
@@ -130,9 +194,10 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
   std::map<const char *, TemplatableValue<std::string, Ts...>> json_{};
   std::function<void(Ts..., JsonObject)> json_func_{nullptr};
   std::vector<HttpRequestResponseTrigger *> response_triggers_;
+  std::vector<HttpRequestDataTrigger *> data_triggers_;
 };
 
 }  // namespace http_request
 }  // namespace esphome
 
-#endif  // USE_ARDUINO
+#endif  // USE_ARDUINO || USE_HOST
@@ -8,7 +8,7 @@ namespace hx711 {
 static const char *const TAG = "hx711";
 
 void HX711Sensor::setup() {
-  ESP_LOGCONFIG(TAG, "Setting up HX711 '%s'...", this->name_.c_str());
+  ESP_LOGCONFIG(TAG, "Setting up HX711 '%s'...", this->get_name().c_str());
   this->sck_pin_->setup();
   this->dout_pin_->setup();
   this->sck_pin_->digital_write(false);
@@ -25,12 +25,16 @@ void HX711Sensor::dump_config() {
 }
 float HX711Sensor::get_setup_priority() const { return setup_priority::DATA; }
 void HX711Sensor::update() {
-  uint32_t result;
-  if (this->read_sensor_(&result)) {
-    int32_t value = static_cast<int32_t>(result);
-    ESP_LOGD(TAG, "'%s': Got value %" PRId32, this->name_.c_str(), value);
-    this->publish_state(value);
-  }
+  // DOUT goes low once a conversion is ready, at the latest after 100 ms at 10 samples per second
+  this->deferred_read_.read_when(this->dout_pin_, false, 200, [this](bool /*ready*/) {
+    // warns if the conversion still isn't ready
+    uint32_t result;
+    if (this->read_sensor_(&result)) {
+      int32_t value = static_cast<int32_t>(result);
+      ESP_LOGD(TAG, "'%s': Got value %" PRId32, this->get_name().c_str(), value);
+      this->publish_state(value);
+    }
+  });
 }
 bool HX711Sensor::read_sensor_(uint32_t *result) {
   if (this->dout_pin_->digital_read()) {
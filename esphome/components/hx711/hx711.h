@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/deferred_read.h"
 #include "esphome/core/hal.h"
 #include "esphome/components/sensor/sensor.h"
 
@@ -32,6 +33,7 @@ class HX711Sensor : public sensor::Sensor, public PollingComponent {
   GPIOPin *dout_pin_;
   GPIOPin *sck_pin_;
   HX711Gain gain_{HX711_GAIN_128};
+  DeferredRead deferred_read_{this, "read"};
 };
 
 }  // namespace hx711
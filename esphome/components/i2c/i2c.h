@@ -1,6 +1,7 @@
 #pragma once
 
 #include "i2c_bus.h"
+#include "i2c_transaction.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/optional.h"
 #include <array>
@@ -203,6 +204,11 @@ class I2CDevice {
   /// @return an i2c::ErrorCode
   ErrorCode write_register16(uint16_t a_register, const uint8_t *data, size_t len, bool stop = true);
 
+  /// @brief queues a transaction for the device on the I2CBus, see I2CTransaction
+  /// @param transaction the transaction, which has to stay valid until its callback was called
+  /// @return false if the transaction is still pending or has no steps
+  bool submit(I2CTransaction *transaction) { return bus_->submit(address_, transaction); }
+
   ///
   /// Compat APIs
   /// All methods below have been added for compatibility reasons. They do not bring any functionality and therefore on
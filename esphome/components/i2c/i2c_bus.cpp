@@ -0,0 +1,106 @@
+#include "i2c_bus.h"
+#include "i2c_transaction.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include <algorithm>
+
+namespace esphome {
+namespace i2c {
+
+bool I2CBus::submit(uint8_t address, I2CTransaction *transaction) {
+  if (transaction->pending_ || transaction->steps_.empty())
+    return false;
+  transaction->address_ = address;
+  transaction->next_step_ = 0;
+  transaction->resume_at_ = micros();
+  transaction->pending_ = true;
+  this->transactions_.push_back(transaction);
+  this->high_freq_.start();
+  return true;
+}
+
+void I2CBus::process_transactions_() {
+  if (this->transactions_.empty())
+    return;
+  uint32_t now = micros();
+  // transactions submitted by the callbacks are left for the next loop
+  size_t count = this->transactions_.size();
+  for (size_t i = 0; i < count;) {
+    I2CTransaction *transaction = this->transactions_[i];
+    if (static_cast<int32_t>(transaction->resume_at_ - now) > 0) {
+      i++;
+      continue;
+    }
+    I2CAddressStats &stats = this->get_stats_(transaction->address_);
+    ErrorCode err = ERROR_OK;
+    bool done = this->run_transaction_(transaction, stats, err);
+    now = micros();
+    if (!done) {
+      i++;
+      continue;
+    }
+    this->transactions_.erase(this->transactions_.begin() + i);
+    count--;
+    stats.transactions++;
+    if (err != ERROR_OK)
+      stats.errors++;
+    transaction->pending_ = false;
+    if (transaction->callback_) {
+      // the callback may rebuild and resubmit the transaction, don't destroy it while it runs
+      auto callback = std::move(transaction->callback_);
+      callback(err);
+      if (!transaction->callback_)
+        transaction->callback_ = std::move(callback);
+    }
+  }
+
+  // only keep the loop running continuously if the next step is due before the next regular loop
+  uint32_t next = UINT32_MAX;
+  for (auto *transaction : this->transactions_)
+    next = std::min<uint32_t>(next, std::max<int32_t>(0, static_cast<int32_t>(transaction->resume_at_ - now)));
+  if (next < App.get_loop_interval() * 1000) {
+    this->high_freq_.start();
+  } else {
+    this->high_freq_.stop();
+  }
+}
+
+bool I2CBus::run_transaction_(I2CTransaction *transaction, I2CAddressStats &stats, ErrorCode &err) {
+  uint32_t start = micros();
+  while (transaction->next_step_ < transaction->steps_.size()) {
+    const I2CTransactionStep &step = transaction->steps_[transaction->next_step_++];
+    if (step.type == I2C_STEP_WAIT) {
+      uint32_t now = micros();
+      stats.bus_time_us += now - start;
+      stats.wait_time_us += step.wait_us;
+      transaction->resume_at_ = now + step.wait_us;
+      return false;
+    }
+    if (step.type == I2C_STEP_WRITE) {
+      WriteBuffer buffer{transaction->data_.data() + step.offset, step.len};
+      err = this->writev(transaction->address_, &buffer, 1, step.stop);
+    } else {
+      ReadBuffer buffer{step.buffer, step.len};
+      err = this->readv(transaction->address_, &buffer, 1);
+    }
+    if (err != ERROR_OK)
+      break;
+    stats.bytes += step.len;
+  }
+  stats.bus_time_us += micros() - start;
+  return true;
+}
+
+I2CAddressStats &I2CBus::get_stats_(uint8_t address) {
+  for (auto &stats : this->statistics_) {
+    if (stats.address == address)
+      return stats;
+  }
+  I2CAddressStats stats{};
+  stats.address = address;
+  this->statistics_.push_back(stats);
+  return this->statistics_.back();
+}
+
+}  // namespace i2c
+}  // namespace esphome
@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <utility>
 #include <vector>
+#include "esphome/core/helpers.h"
 
 namespace esphome {
 namespace i2c {
@@ -32,6 +33,18 @@ struct WriteBuffer {
   size_t len;           ///< length of the buffer
 };
 
+/// @brief Statistics of the transactions executed by the bus for one device address
+struct I2CAddressStats {
+  uint8_t address;
+  uint32_t transactions;  ///< number of completed transactions
+  uint32_t errors;        ///< number of transactions that failed
+  uint32_t bytes;         ///< bytes written and read
+  uint32_t bus_time_us;   ///< time the bus was busy with the device
+  uint32_t wait_time_us;  ///< time spent waiting between steps, during which the bus served other devices
+};
+
+class I2CTransaction;  // forward declaration
+
 /// @brief This Class provides the methods to read and write bytes from an I2CBus.
 /// @note The I2CBus virtual class follows a *Factory design pattern* that provides all the interfaces methods required
 /// by clients while deferring the actual implementation of these methods to a subclasses. I2C-bus specification and
@@ -91,7 +104,23 @@ class I2CBus {
   /// @details This is a pure virtual method that must be implemented in the subclass.
   virtual ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t count, bool stop) = 0;
 
+  /// @brief Queues a transaction, its steps are executed from the loop of the bus
+  /// @param address address of the I²C component on the i2c bus
+  /// @param transaction the transaction, which has to stay valid until its callback was called
+  /// @return false if the transaction is still pending or has no steps
+  bool submit(uint8_t address, I2CTransaction *transaction);
+
+  /// @brief Statistics of the transactions, one entry per device address
+  const std::vector<I2CAddressStats> &get_statistics() const { return this->statistics_; }
+
  protected:
+  /// @brief Runs the due steps of all queued transactions, to be called from the loop of the bus component.
+  /// @details Each due transaction runs until its next wait or its end, in the order they were submitted.
+  void process_transactions_();
+  /// @brief Runs the steps of a transaction up to its next wait, returns true if it completed (or failed)
+  bool run_transaction_(I2CTransaction *transaction, I2CAddressStats &stats, ErrorCode &err);
+  I2CAddressStats &get_stats_(uint8_t address);
+
   /// @brief Scans the I2C bus for devices. Devices presence is kept in an array of std::pair
   /// that contains the address and the corresponding bool presence flag.
   void i2c_scan_() {
@@ -106,6 +135,9 @@ class I2CBus {
   }
   std::vector<std::pair<uint8_t, bool>> scan_results_;  ///< array containing scan results
   bool scan_{false};                                    ///< Should we scan ? Can be set in the yaml
+  std::vector<I2CTransaction *> transactions_;          ///< queued transactions
+  std::vector<I2CAddressStats> statistics_;
+  HighFrequencyLoopRequester high_freq_;
 };
 
 }  // namespace i2c
@@ -0,0 +1,100 @@
+#ifdef USE_HOST
+
+#include "i2c_bus_host.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <cinttypes>
+
+namespace esphome {
+namespace i2c {
+
+static const char *const TAG = "i2c.host";
+
+void HostI2CBus::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up I2C bus...");
+  if (this->scan_) {
+    ESP_LOGV(TAG, "Scanning i2c bus for active devices...");
+    this->i2c_scan_();
+  }
+}
+
+void HostI2CBus::dump_config() {
+  ESP_LOGCONFIG(TAG, "I2C Bus (simulated):");
+  ESP_LOGCONFIG(TAG, "  Frequency: %" PRIu32 " Hz", this->frequency_);
+  ESP_LOGCONFIG(TAG, "  Devices: %u", (unsigned) this->devices_.size());
+  if (this->scan_) {
+    ESP_LOGI(TAG, "Results from i2c bus scan:");
+    if (scan_results_.empty()) {
+      ESP_LOGI(TAG, "Found no i2c devices!");
+    } else {
+      for (const auto &s : scan_results_) {
+        if (s.second)
+          ESP_LOGI(TAG, "Found i2c device at address 0x%02X", s.first);
+      }
+    }
+  }
+}
+
+uint8_t *HostI2CBus::add_device(uint8_t address) {
+  Device *device = this->get_device_(address);
+  if (device == nullptr) {
+    this->devices_.emplace_back(new Device{});  // NOLINT
+    device = this->devices_.back().get();
+    device->address = address;
+  }
+  return device->registers.data();
+}
+
+HostI2CBus::Device *HostI2CBus::get_device_(uint8_t address) {
+  for (auto &device : this->devices_) {
+    if (device->address == address)
+      return device.get();
+  }
+  return nullptr;
+}
+
+void HostI2CBus::transfer_(size_t bytes) {
+  // start, address byte and stop, 9 clock cycles per byte
+  delayMicroseconds((bytes + 2) * 9 * 1000000ULL / this->frequency_);
+}
+
+ErrorCode HostI2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t cnt) {
+  Device *device = this->get_device_(address);
+  if (device == nullptr) {
+    this->transfer_(0);
+    return ERROR_NOT_ACKNOWLEDGED;
+  }
+  size_t bytes = 0;
+  for (size_t i = 0; i < cnt; i++) {
+    for (size_t j = 0; j < buffers[i].len; j++)
+      buffers[i].data[j] = device->registers[device->pointer++];
+    bytes += buffers[i].len;
+  }
+  this->transfer_(bytes);
+  return ERROR_OK;
+}
+
+ErrorCode HostI2CBus::writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
+  Device *device = this->get_device_(address);
+  if (device == nullptr) {
+    this->transfer_(0);
+    return ERROR_NOT_ACKNOWLEDGED;
+  }
+  size_t bytes = 0;
+  for (size_t i = 0; i < cnt; i++) {
+    for (size_t j = 0; j < buffers[i].len; j++, bytes++) {
+      if (bytes == 0) {
+        device->pointer = buffers[i].data[j];
+      } else {
+        device->registers[device->pointer++] = buffers[i].data[j];
+      }
+    }
+  }
+  this->transfer_(bytes);
+  return ERROR_OK;
+}
+
+}  // namespace i2c
+}  // namespace esphome
+
+#endif  // USE_HOST
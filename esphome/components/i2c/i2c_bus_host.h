@@ -0,0 +1,53 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include "i2c_bus.h"
+#include "esphome/core/component.h"
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace esphome {
+namespace i2c {
+
+/// @brief Simulated I2C bus of the host platform, to test and benchmark drivers without hardware.
+/// @details Every device added is a bank of 256 registers: the first byte of a write sets the register pointer and the
+/// remaining bytes are stored from there on, a read returns the registers from the pointer on. Other addresses don't
+/// acknowledge. Transfers block as long as they would on a real bus of the configured frequency, with virtual time they
+/// advance the clock by that duration. On the host platform every configured I2C device is added automatically.
+class HostI2CBus : public I2CBus, public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  void loop() override { this->process_transactions_(); }
+  ErrorCode readv(uint8_t address, ReadBuffer *buffers, size_t cnt) override;
+  ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  void set_scan(bool scan) { scan_ = scan; }
+  void set_frequency(uint32_t frequency) { frequency_ = frequency; }
+
+  /// @brief adds a simulated device to the bus
+  /// @return the registers of the device, to preset or inspect them
+  uint8_t *add_device(uint8_t address);
+
+ protected:
+  struct Device {
+    uint8_t address;
+    uint8_t pointer;
+    std::array<uint8_t, 256> registers;
+  };
+
+  Device *get_device_(uint8_t address);
+  /// block for the time a transfer of `bytes` bytes (plus start, address and stop) takes on the bus
+  void transfer_(size_t bytes);
+
+  std::vector<std::unique_ptr<Device>> devices_;
+  uint32_t frequency_{100000};
+};
+
+}  // namespace i2c
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -0,0 +1,58 @@
+#include "i2c_transaction.h"
+
+namespace esphome {
+namespace i2c {
+
+I2CTransaction &I2CTransaction::write(const uint8_t *data, size_t len, bool stop) {
+  I2CTransactionStep step{};
+  step.type = I2C_STEP_WRITE;
+  step.stop = stop;
+  step.offset = this->data_.size();
+  step.len = len;
+  this->data_.insert(this->data_.end(), data, data + len);
+  this->steps_.push_back(step);
+  return *this;
+}
+
+I2CTransaction &I2CTransaction::write_register(uint8_t a_register, const uint8_t *data, size_t len, bool stop) {
+  this->write(&a_register, 1, stop);
+  // extend the write of the register address by the data
+  this->data_.insert(this->data_.end(), data, data + len);
+  this->steps_.back().len += len;
+  return *this;
+}
+
+I2CTransaction &I2CTransaction::read(uint8_t *data, size_t len) {
+  I2CTransactionStep step{};
+  step.type = I2C_STEP_READ;
+  step.len = len;
+  step.buffer = data;
+  this->steps_.push_back(step);
+  return *this;
+}
+
+I2CTransaction &I2CTransaction::read_register(uint8_t a_register, uint8_t *data, size_t len, bool stop) {
+  this->write(&a_register, 1, stop);
+  return this->read(data, len);
+}
+
+I2CTransaction &I2CTransaction::wait(uint32_t ms) {
+  I2CTransactionStep step{};
+  step.type = I2C_STEP_WAIT;
+  step.wait_us = ms * 1000;
+  this->steps_.push_back(step);
+  return *this;
+}
+
+I2CTransaction &I2CTransaction::then(std::function<void(ErrorCode)> &&callback) {
+  this->callback_ = std::move(callback);
+  return *this;
+}
+
+void I2CTransaction::clear() {
+  this->steps_.clear();
+  this->data_.clear();
+}
+
+}  // namespace i2c
+}  // namespace esphome
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "i2c_bus.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+namespace esphome {
+namespace i2c {
+
+enum I2CTransactionStepType : uint8_t {
+  I2C_STEP_WRITE,
+  I2C_STEP_READ,
+  I2C_STEP_WAIT,
+};
+
+struct I2CTransactionStep {
+  I2CTransactionStepType type;
+  bool stop;         ///< write: send a stop after the data
+  uint16_t offset;   ///< write: offset of the data in the data of the transaction
+  uint16_t len;      ///< write/read: number of bytes
+  uint8_t *buffer;   ///< read: destination of the bytes
+  uint32_t wait_us;  ///< wait: time to wait before the next step
+};
+
+/// @brief A sequence of reads, writes and waits on one device that the bus executes without blocking the loop.
+/// @details The bus is released between the steps of a transaction, so while one device waits (e.g. for a conversion
+/// to finish) the bus carries the transactions of other devices. Write data is copied into the transaction, read steps
+/// store into buffers owned by the caller, which have to stay valid until the transaction completes.
+/// Transactions are meant to be kept as members and rebuilt or resubmitted, clear() keeps the allocated memory.
+/// @n typical usage:
+/// @code
+/// this->transaction_.clear();
+/// this->transaction_.write({CMD_MEASURE})
+///     .wait(20)
+///     .read(this->buffer_, 6)
+///     .then([this](i2c::ErrorCode err) { this->on_data_(err); });
+/// this->submit(&this->transaction_);
+/// @endcode
+class I2CTransaction {
+ public:
+  /// @brief appends a write of `len` bytes (copied) to the transaction
+  I2CTransaction &write(const uint8_t *data, size_t len, bool stop = true);
+  I2CTransaction &write(std::initializer_list<uint8_t> data, bool stop = true) {
+    return this->write(data.begin(), data.size(), stop);
+  }
+  /// @brief appends a write of the register address followed by `len` bytes (copied) to the transaction
+  I2CTransaction &write_register(uint8_t a_register, const uint8_t *data, size_t len, bool stop = true);
+  /// @brief appends a read of `len` bytes into `data` to the transaction
+  I2CTransaction &read(uint8_t *data, size_t len);
+  /// @brief appends a write of the register address and a read of `len` bytes into `data` to the transaction
+  I2CTransaction &read_register(uint8_t a_register, uint8_t *data, size_t len, bool stop = true);
+  /// @brief appends a wait to the transaction, the bus serves other devices in the meantime
+  I2CTransaction &wait(uint32_t ms);
+  /// @brief sets the callback called with the result once all steps ran or a step failed
+  I2CTransaction &then(std::function<void(ErrorCode)> &&callback);
+
+  /// @brief removes all steps, the callback is kept. Must not be called while the transaction is pending.
+  void clear();
+  bool is_pending() const { return this->pending_; }
+  bool empty() const { return this->steps_.empty(); }
+
+ protected:
+  friend class I2CBus;
+
+  std::vector<I2CTransactionStep> steps_;
+  std::vector<uint8_t> data_;
+  std::function<void(ErrorCode)> callback_;
+  uint32_t resume_at_{0};  ///< micros() at which the next step is due
+  uint8_t address_{0};
+  uint8_t next_step_{0};
+  bool pending_{false};
+};
+
+}  // namespace i2c
+}  // namespace esphome
@@ -38,10 +38,6 @@ void ILI9XXXDisplay::setup() {
 
   this->set_madctl();
   this->command(this->pre_invertcolors_ ? ILI9XXX_INVON : ILI9XXX_INVOFF);
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 
   if (this->buffer_color_mode_ == BITS_16) {
     this->init_internal_(this->get_buffer_length_() * 2);
@@ -107,80 +103,97 @@ void ILI9XXXDisplay::dump_config() {
 float ILI9XXXDisplay::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 void ILI9XXXDisplay::fill(Color color) {
-  uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
-  switch (this->buffer_color_mode_) {
-    case BITS_8_INDEXED:
-      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
-      break;
-    case BITS_16:
-      new_color = display::ColorUtil::color_to_565(color);
-      {
-        const uint32_t buffer_length_16_bits = this->get_buffer_length_() * 2;
-        if (((uint8_t) (new_color >> 8)) == ((uint8_t) new_color)) {
-          // Upper and lower is equal can use quicker memset operation. Takes ~20ms.
-          memset(this->buffer_, (uint8_t) new_color, buffer_length_16_bits);
-        } else {
-          // Slower set of both buffers. Takes ~30ms.
-          for (uint32_t i = 0; i < buffer_length_16_bits; i = i + 2) {
-            this->buffer_[i] = (uint8_t) (new_color >> 8);
-            this->buffer_[i + 1] = (uint8_t) new_color;
-          }
-        }
-      }
-      return;
-      break;
-    default:
-      new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
-      break;
-  }
-  memset(this->buffer_, (uint8_t) new_color, this->get_buffer_length_());
+  // only rows whose contents actually change are marked dirty, so clearing and redrawing an unchanged screen
+  // does not cause a full transfer.
+  for (int y = 0; y < this->get_height_internal(); y++)
+    this->fill_absolute_row_internal(0, y, this->get_width_internal(), color);
 }
 
 void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0) {
     return;
   }
+  if (this->write_buffer_pixel_((y * width_) + x, this->color_to_buffer_(color))) {
+    this->mark_dirty_(x, y, x, y);
+  }
+}
+
+void HOT ILI9XXXDisplay::fill_absolute_row_internal(int x, int y, int w, Color color) {
+  if (y >= this->get_height_internal() || y < 0)
+    return;
+  int x_end = std::min(x + w, this->get_width_internal());
+  x = std::max(x, 0);
+
+  // convert the color once for the whole span
+  const uint16_t value = this->color_to_buffer_(color);
+  int first = -1, last = -1;
+  uint32_t pos = (y * width_) + x;
+  for (int i = x; i < x_end; i++, pos++) {
+    if (this->write_buffer_pixel_(pos, value)) {
+      if (first < 0)
+        first = i;
+      last = i;
+    }
+  }
+  if (first >= 0)
+    this->mark_dirty_(first, y, last, y);
+}
+
+void HOT ILI9XXXDisplay::draw_absolute_row_internal(int x, int y, int w, const Color *colors) {
+  if (y >= this->get_height_internal() || y < 0)
+    return;
+  int x_end = std::min(x + w, this->get_width_internal());
+  if (x < 0) {
+    colors -= x;
+    x = 0;
+  }
+  if (x >= x_end)
+    return;
+
+  int first = -1, last = -1;
   uint32_t pos = (y * width_) + x;
-  uint16_t new_color;
-  bool updated = false;
+  // neighbouring pixels often share a color, so avoid repeating the (possibly expensive) conversion
+  Color last_color = colors[0];
+  uint16_t value = this->color_to_buffer_(last_color);
+  for (int i = x; i < x_end; i++, pos++, colors++) {
+    if (colors->raw_32 != last_color.raw_32) {
+      last_color = *colors;
+      value = this->color_to_buffer_(last_color);
+    }
+    if (this->write_buffer_pixel_(pos, value)) {
+      if (first < 0)
+        first = i;
+      last = i;
+    }
+  }
+  if (first >= 0)
+    this->mark_dirty_(first, y, last, y);
+}
+
+uint16_t HOT ILI9XXXDisplay::color_to_buffer_(Color color) {
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
-      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
-      break;
+      return display::ColorUtil::color_to_index8_palette888(color, this->palette_);
     case BITS_16:
-      pos = pos * 2;
-      new_color = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
-      if (this->buffer_[pos] != (uint8_t) (new_color >> 8)) {
-        this->buffer_[pos] = (uint8_t) (new_color >> 8);
-        updated = true;
-      }
-      pos = pos + 1;
-      new_color = new_color & 0xFF;
-      break;
+      return display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
     default:
-      new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
-      break;
+      return display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
   }
+}
 
-  if (this->buffer_[pos] != new_color) {
-    this->buffer_[pos] = new_color;
-    updated = true;
-  }
-  if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+bool HOT ILI9XXXDisplay::write_buffer_pixel_(uint32_t pos, uint16_t value) {
+  if (this->buffer_color_mode_ == BITS_16) {
+    pos = pos * 2;
+    if (this->buffer_[pos] == (uint8_t) (value >> 8) && this->buffer_[pos + 1] == (uint8_t) value)
+      return false;
+    this->buffer_[pos] = (uint8_t) (value >> 8);
+    this->buffer_[pos + 1] = (uint8_t) value;
+    return true;
   }
+  if (this->buffer_[pos] == value)
+    return false;
+  this->buffer_[pos] = value;
+  return true;
 }
 
 void ILI9XXXDisplay::update() {
@@ -197,16 +210,18 @@ void ILI9XXXDisplay::update() {
   this->display_();
 }
 
-void ILI9XXXDisplay::display_() {
-  uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
-  // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
-    return;
-  }
+void ILI9XXXDisplay::display_() { this->flush_dirty_regions_(); }
 
-  // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
+size_t ILI9XXXDisplay::flush_region_internal(const display::Rect &region) {
+  uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
+  // we will only update the changed region to the display
+  size_t const x_low = region.x;
+  size_t const y_low = region.y;
+  size_t const x_high = region.x2() - 1;
+  size_t const y_high = region.y2() - 1;
+  size_t const w = region.w;
+  size_t const h = region.h;
+  size_t bytes_per_pixel = this->is_18bitdisplay_ ? 3 : 2;
 
   size_t mhz = this->data_rate_ / 1000000;
   // estimate time for a single write
@@ -214,69 +229,67 @@ void ILI9XXXDisplay::display_() {
   // estimate time for multiple writes
   size_t mw_time = (w * h * 16) / mhz + w * h * 2 / ILI9XXX_TRANSFER_BUFFER_SIZE * SPI_SETUP_US;
   ESP_LOGV(TAG,
-           "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
+           "Start display(xlow:%zu, ylow:%zu, xhigh:%zu, yhigh:%zu, width:%zu, "
            "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
+           x_low, y_low, x_high, y_high, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
   auto now = millis();
   if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
     // 16 bit mode maps directly to display format
     ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
-  } else {
-    ESP_LOGV(TAG, "Doing multiple write");
-    size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
-    size_t idx = 0;    // index into transfer_buffer
-    size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
-    while (rem-- != 0) {
-      uint16_t color_val;
-      switch (this->buffer_color_mode_) {
-        case BITS_8:
-          color_val = display::ColorUtil::color_to_565(display::ColorUtil::rgb332_to_color(this->buffer_[pos++]));
-          break;
-        case BITS_8_INDEXED:
-          color_val = display::ColorUtil::color_to_565(
-              display::ColorUtil::index8_to_color_palette888(this->buffer_[pos++], this->palette_));
-          break;
-        default:  // case BITS_16:
-          color_val = (buffer_[pos * 2] << 8) + buffer_[pos * 2 + 1];
-          pos++;
-          break;
-      }
-      if (this->is_18bitdisplay_) {
-        transfer_buffer[idx++] = (uint8_t) ((color_val & 0xF800) >> 8);  // Blue
-        transfer_buffer[idx++] = (uint8_t) ((color_val & 0x7E0) >> 3);   // Green
-        transfer_buffer[idx++] = (uint8_t) (color_val << 3);             // Red
-      } else {
-        put16_be(transfer_buffer + idx, color_val);
-        idx += 2;
-      }
-      if (idx == ILI9XXX_TRANSFER_BUFFER_SIZE) {
-        this->write_array(transfer_buffer, idx);
-        idx = 0;
-        App.feed_wdt();
-      }
-      // end of line? Skip to the next.
-      if (++pixel == w) {
-        pixel = 0;
-        pos += this->width_ - w;
-      }
+    set_addr_window_(0, y_low, this->width_ - 1, y_high);
+    this->write_array(this->buffer_ + y_low * this->width_ * 2, h * this->width_ * 2);
+    this->end_data_();
+    ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
+    return this->width_ * h * 2;
+  }
+
+  ESP_LOGV(TAG, "Doing multiple write");
+  size_t rem = h * w;  // remaining number of pixels to write
+  set_addr_window_(x_low, y_low, x_high, y_high);
+  size_t idx = 0;    // index into transfer_buffer
+  size_t pixel = 0;  // pixel number offset
+  size_t pos = y_low * this->width_ + x_low;
+  while (rem-- != 0) {
+    uint16_t color_val;
+    switch (this->buffer_color_mode_) {
+      case BITS_8:
+        color_val = display::ColorUtil::color_to_565(display::ColorUtil::rgb332_to_color(this->buffer_[pos++]));
+        break;
+      case BITS_8_INDEXED:
+        color_val = display::ColorUtil::color_to_565(
+            display::ColorUtil::index8_to_color_palette888(this->buffer_[pos++], this->palette_));
+        break;
+      default:  // case BITS_16:
+        color_val = (buffer_[pos * 2] << 8) + buffer_[pos * 2 + 1];
+        pos++;
+        break;
+    }
+    if (this->is_18bitdisplay_) {
+      transfer_buffer[idx++] = (uint8_t) ((color_val & 0xF800) >> 8);  // Blue
+      transfer_buffer[idx++] = (uint8_t) ((color_val & 0x7E0) >> 3);   // Green
+      transfer_buffer[idx++] = (uint8_t) (color_val << 3);             // Red
+    } else {
+      put16_be(transfer_buffer + idx, color_val);
+      idx += 2;
     }
-    // flush any balance.
-    if (idx != 0) {
+    if (idx == ILI9XXX_TRANSFER_BUFFER_SIZE) {
       this->write_array(transfer_buffer, idx);
+      idx = 0;
+      App.feed_wdt();
     }
+    // end of line? Skip to the next.
+    if (++pixel == w) {
+      pixel = 0;
+      pos += this->width_ - w;
+    }
+  }
+  // flush any balance.
+  if (idx != 0) {
+    this->write_array(transfer_buffer, idx);
   }
   this->end_data_();
   ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  return w * h * bytes_per_pixel;
 }
 
 // note that this bypasses the buffer and writes directly to the display.
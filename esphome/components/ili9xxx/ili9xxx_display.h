@@ -91,10 +91,17 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_row_internal(int x, int y, int w, Color color) override;
+  void draw_absolute_row_internal(int x, int y, int w, const Color *colors) override;
+  /// Convert a color to the buffer format; in 16 bit mode the result is the big endian RGB565 value.
+  uint16_t color_to_buffer_(Color color);
+  /// Store a converted color at pixel index `pos` of the buffer, returns true if the buffer changed.
+  bool write_buffer_pixel_(uint32_t pos, uint16_t value);
   void setup_pins_();
 
   virtual void set_madctl();
   void display_();
+  size_t flush_region_internal(const display::Rect &region) override;
   void init_lcd_();
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t x2, uint16_t y2);
   void reset_();
@@ -104,10 +111,6 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   int16_t height_{0};  ///< Display height as modified by current rotation
   int16_t offset_x_{0};
   int16_t offset_y_{0};
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
   const uint8_t *palette_;
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
@@ -6,59 +6,51 @@ namespace esphome {
 namespace image {
 
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
-  switch (type_) {
-    case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
-          } else if (!this->transparent_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
-          }
+  // clip once for the whole image, then hand the visible part to the display row by row
+  int clip_x = x, clip_y = y, clip_w = this->width_, clip_h = this->height_;
+  if (!display->clip_rect(clip_x, clip_y, clip_w, clip_h))
+    return;
+  const int img_x_start = clip_x - x;
+  const int img_x_end = img_x_start + clip_w;
+  const int img_y_end = clip_y - y + clip_h;
+
+  for (int img_y = clip_y - y; img_y < img_y_end; img_y++) {
+    if (this->type_ == IMAGE_TYPE_BINARY) {
+      // emit runs of equal bits as single-color spans
+      int run_start = img_x_start;
+      bool run_on = this->get_binary_pixel_(img_x_start, img_y);
+      for (int img_x = img_x_start + 1; img_x <= img_x_end; img_x++) {
+        bool on = img_x < img_x_end && this->get_binary_pixel_(img_x, img_y);
+        if (img_x != img_x_end && on == run_on)
+          continue;
+        if (run_on) {
+          display->fill_row_at(x + run_start, y + img_y, img_x - run_start, color_on);
+        } else if (!this->transparent_) {
+          display->fill_row_at(x + run_start, y + img_y, img_x - run_start, color_off);
         }
+        run_start = img_x;
+        run_on = on;
       }
-      break;
+      continue;
     }
-    case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_grayscale_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
-    case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
-    case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb24_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
+
+    // decode opaque pixels into a small row buffer, flushing it at transparent pixels
+    Color row[display::DISPLAY_ROW_CHUNK_SIZE];
+    int run_start = img_x_start;
+    int count = 0;
+    for (int img_x = img_x_start; img_x < img_x_end; img_x++) {
+      Color color = this->get_color_pixel_(img_x, img_y);
+      bool opaque = color.w >= 0x80;
+      if (opaque) {
+        if (count == 0)
+          run_start = img_x;
+        row[count++] = color;
       }
-      break;
-    case IMAGE_TYPE_RGBA:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgba_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
+      if (count != 0 && (!opaque || count == display::DISPLAY_ROW_CHUNK_SIZE || img_x == img_x_end - 1)) {
+        display->draw_row_at(x + run_start, y + img_y, count, row);
+        count = 0;
       }
-      break;
+    }
   }
 }
 Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
@@ -79,6 +71,20 @@ Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
       return color_off;
   }
 }
+Color Image::get_color_pixel_(int x, int y) const {
+  switch (this->type_) {
+    case IMAGE_TYPE_GRAYSCALE:
+      return this->get_grayscale_pixel_(x, y);
+    case IMAGE_TYPE_RGB565:
+      return this->get_rgb565_pixel_(x, y);
+    case IMAGE_TYPE_RGB24:
+      return this->get_rgb24_pixel_(x, y);
+    case IMAGE_TYPE_RGBA:
+      return this->get_rgba_pixel_(x, y);
+    default:
+      return Color(0, 0, 0, 0);
+  }
+}
 bool Image::get_binary_pixel_(int x, int y) const {
   const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
   const uint32_t pos = x + y * width_8;
@@ -47,6 +47,8 @@ class Image : public display::BaseImage {
 
  protected:
   bool get_binary_pixel_(int x, int y) const;
+  /// Pixel color of a non-binary image, with transparent pixels having an alpha below 0x80.
+  Color get_color_pixel_(int x, int y) const;
   Color get_rgb24_pixel_(int x, int y) const;
   Color get_rgba_pixel_(int x, int y) const;
   Color get_rgb565_pixel_(int x, int y) const;
@@ -1,6 +1,9 @@
 #include "addressable_light.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace esphome {
 namespace light {
 
@@ -27,6 +30,155 @@ std::unique_ptr<LightTransformer> AddressableLight::create_default_transition()
   return make_unique<AddressableLightTransformer>(*this);
 }
 
+static uint8_t color_correct_channel(const ESPColorCorrection &correction, uint8_t channel, uint8_t value) {
+  switch (channel) {
+    case 0:
+      return correction.color_correct_red(value);
+    case 1:
+      return correction.color_correct_green(value);
+    case 2:
+      return correction.color_correct_blue(value);
+    default:
+      return correction.color_correct_white(value);
+  }
+}
+
+static uint8_t color_uncorrect_channel(const ESPColorCorrection &correction, uint8_t channel, uint8_t value) {
+  switch (channel) {
+    case 0:
+      return correction.color_uncorrect_red(value);
+    case 1:
+      return correction.color_uncorrect_green(value);
+    case 2:
+      return correction.color_uncorrect_blue(value);
+    default:
+      return correction.color_uncorrect_white(value);
+  }
+}
+
+template<typename F> void AddressableLight::map_channels_(int32_t from, int32_t to, F op) {
+  from = std::max<int32_t>(from, 0);
+  to = std::min(to, this->size());
+  AddressablePixelLayout layout;
+  if (!this->get_pixel_layout_(layout)) {
+    for (int32_t i = from; i < to; i++) {
+      auto view = this->get_view_internal(i);
+      Color color = view.get();
+      view.set(Color(op(color.r, 0), op(color.g, 1), op(color.b, 2), op(color.w, 3)));
+    }
+    return;
+  }
+
+  const uint8_t channels = layout.has_white ? 4 : 3;
+  for (uint8_t channel = 0; channel < channels; channel++) {
+    // raw value -> new raw value, filled in the first time a raw value is seen
+    uint8_t table[256];
+    uint32_t known[8] = {};
+    uint8_t *pixel = layout.pixels + from * layout.stride + layout.offsets[channel];
+    for (int32_t i = from; i < to; i++, pixel += layout.stride) {
+      const uint8_t raw = *pixel;
+      if ((known[raw >> 5] & (1UL << (raw & 31))) == 0) {
+        uint8_t value = color_uncorrect_channel(this->correction_, channel, raw);
+        table[raw] = color_correct_channel(this->correction_, channel, op(value, channel));
+        known[raw >> 5] |= 1UL << (raw & 31);
+      }
+      *pixel = table[raw];
+    }
+  }
+}
+
+void AddressableLight::fill(int32_t from, int32_t to, const Color &color) {
+  from = std::max<int32_t>(from, 0);
+  to = std::min(to, this->size());
+  AddressablePixelLayout layout;
+  if (!this->get_pixel_layout_(layout)) {
+    for (int32_t i = from; i < to; i++)
+      this->get_view_internal(i) = color;
+    return;
+  }
+
+  const Color corrected = this->correction_.color_correct(color);
+  const uint8_t channels = layout.has_white ? 4 : 3;
+  uint8_t *pixel = layout.pixels + from * layout.stride;
+  for (int32_t i = from; i < to; i++, pixel += layout.stride) {
+    for (uint8_t channel = 0; channel < channels; channel++)
+      pixel[layout.offsets[channel]] = corrected.raw[channel];
+  }
+}
+
+void AddressableLight::blend(int32_t from, int32_t to, const Color &color, uint8_t amnt) {
+  // same arithmetic as Color::gradient()
+  const float amnt_f = float(amnt) / 255.0f;
+  this->map_channels_(from, to, [&color, amnt_f](uint8_t value, uint8_t channel) -> uint8_t {
+    return amnt_f * (color.raw[channel] - value) + value;
+  });
+}
+
+void AddressableLight::scale(int32_t from, int32_t to, uint8_t amnt) {
+  this->map_channels_(from, to, [amnt](uint8_t value, uint8_t channel) { return esp_scale8(value, amnt); });
+}
+
+void AddressableLight::lighten(int32_t from, int32_t to, uint8_t delta) {
+  this->map_channels_(from, to, [delta](uint8_t value, uint8_t channel) -> uint8_t {
+    return value > 255 - delta ? 255 : value + delta;
+  });
+}
+
+void AddressableLight::darken(int32_t from, int32_t to, uint8_t delta) {
+  this->map_channels_(from, to,
+                      [delta](uint8_t value, uint8_t channel) -> uint8_t { return value < delta ? 0 : value - delta; });
+}
+
+void AddressableLight::set_from_bytes(int32_t from, const uint8_t *data, int32_t count, uint8_t bytes_per_led) {
+  if (from < 0) {
+    data += -from * bytes_per_led;
+    count += from;
+    from = 0;
+  }
+  count = std::min(count, this->size() - from);
+  if (count <= 0)
+    return;
+  AddressablePixelLayout layout;
+  if (!this->get_pixel_layout_(layout)) {
+    for (int32_t i = 0; i < count; i++, data += bytes_per_led)
+      this->get_view_internal(from + i) = Color(data[0], data[1], data[2], bytes_per_led == 4 ? data[3] : 0);
+    return;
+  }
+
+  const ESPColorCorrection &correction = this->correction_;
+  const uint8_t white = correction.color_correct_white(0);
+  uint8_t *pixel = layout.pixels + from * layout.stride;
+  for (int32_t i = 0; i < count; i++, data += bytes_per_led, pixel += layout.stride) {
+    pixel[layout.offsets[0]] = correction.color_correct_red(data[0]);
+    pixel[layout.offsets[1]] = correction.color_correct_green(data[1]);
+    pixel[layout.offsets[2]] = correction.color_correct_blue(data[2]);
+    if (layout.has_white)
+      pixel[layout.offsets[3]] = bytes_per_led == 4 ? correction.color_correct_white(data[3]) : white;
+  }
+}
+
+void AddressableLight::copy(int32_t dest, int32_t src, int32_t count) {
+  count = std::min(count, this->size() - std::max(dest, src));
+  if (dest == src || dest < 0 || src < 0 || count <= 0)
+    return;
+  AddressablePixelLayout layout;
+  if (!this->get_pixel_layout_(layout)) {
+    if (src > dest) {
+      // copy from left
+      for (int32_t i = 0; i < count; i++)
+        this->get_view_internal(dest + i).set(this->get_view_internal(src + i).get());
+    } else {
+      // copy from right
+      for (int32_t i = count - 1; i >= 0; i--)
+        this->get_view_internal(dest + i).set(this->get_view_internal(src + i).get());
+    }
+    return;
+  }
+
+  // the raw bytes are copied as they are, there is no need for a correction round trip
+  memmove(layout.pixels + dest * layout.stride, layout.pixels + src * layout.stride, count * layout.stride);
+}
+
 Color color_from_light_color_values(LightColorValues val) {
   auto r = to_uint8_scale(val.get_color_brightness() * val.get_red());
   auto g = to_uint8_scale(val.get_color_brightness() * val.get_green());
@@ -99,8 +251,11 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
     uint8_t inv_alpha8 = 255 - alpha8;
     Color add = this->target_color_ * alpha8;
 
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
+    // add + led * inv_alpha8, per channel
+    this->light_.map_channels_(0, this->light_.size(), [&add, inv_alpha8](uint8_t value, uint8_t channel) -> uint8_t {
+      uint8_t scaled = esp_scale8(value, inv_alpha8);
+      return scaled > 255 - add.raw[channel] ? 255 : scaled + add.raw[channel];
+    });
   }
 
   this->last_transition_progress_ = smoothed_progress;
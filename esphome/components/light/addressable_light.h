@@ -28,6 +28,14 @@ class AddressableLightState : public LightState {
   using LightState::LightState;
 };
 
+/// Layout of the pixel buffer of a driver, lets the span operations work directly on the raw bytes.
+struct AddressablePixelLayout {
+  uint8_t *pixels;     ///< The first byte of the first LED.
+  uint8_t stride;      ///< Bytes from one LED to the next, copy() moves any bytes between the channels along.
+  uint8_t offsets[4];  ///< Offsets of the red, green, blue and white channel within a LED.
+  bool has_white;
+};
+
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
@@ -60,6 +68,28 @@ class AddressableLight : public LightOutput, public Component {
       amnt = this->size();
     this->range(amnt, this->size()) = this->range(0, -amnt);
   }
+
+  /** Span operations on the half-open range [from, to) of LEDs.
+   *
+   * They produce the same result as applying the corresponding operation to every LED of an ESPRangeView, but drivers
+   * that expose their pixel buffer through get_pixel_layout_() have them run directly on the raw bytes, with the
+   * color correction of each distinct raw value computed only once per call.
+   */
+  void fill(int32_t from, int32_t to, const Color &color);
+  /// Blend towards `color` by amnt/255, blending towards WHITE/BLACK equals fade_to_white()/fade_to_black().
+  void blend(int32_t from, int32_t to, const Color &color, uint8_t amnt);
+  /// Scale every channel by amnt/255.
+  void scale(int32_t from, int32_t to, uint8_t amnt);
+  void lighten(int32_t from, int32_t to, uint8_t delta);
+  void darken(int32_t from, int32_t to, uint8_t delta);
+  /** Set `count` LEDs starting at `from` from uncorrected color bytes, e.g. a received E1.31 or WLED frame.
+   *
+   * @param bytes_per_led 3 for RGB (white is set to 0) or 4 for RGBW data.
+   */
+  void set_from_bytes(int32_t from, const uint8_t *data, int32_t count, uint8_t bytes_per_led = 3);
+  /// Copy the color of `count` LEDs starting at `src` to `dest`, the ranges may overlap.
+  void copy(int32_t dest, int32_t src, int32_t count);
+
   // Indicates whether an effect that directly updates the output buffer is active to prevent overwriting
   bool is_effect_active() const { return this->effect_active_; }
   void set_effect_active(bool effect_active) { this->effect_active_ = effect_active; }
@@ -96,6 +126,10 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /// Describe the pixel buffer for the span operations, lights without a contiguous buffer return false.
+  virtual bool get_pixel_layout_(AddressablePixelLayout &layout) const { return false; }
+  /// Replace every channel of the LEDs in [from, to) with op(value, channel) on the uncorrected values.
+  template<typename F> void map_channels_(int32_t from, int32_t to, F op);
 
   bool effect_active_{false};
   ESPColorCorrection correction_{};
@@ -1,8 +1,12 @@
+#include "esphome/core/application.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 #include "light_state.h"
 #include "light_output.h"
 #include "transformers.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace light {
 
@@ -109,30 +113,54 @@ void LightState::dump_config() {
     ESP_LOGCONFIG(TAG, "  Min Mireds: %.1f", this->get_traits().get_min_mireds());
     ESP_LOGCONFIG(TAG, "  Max Mireds: %.1f", this->get_traits().get_max_mireds());
   }
+  if (this->frame_interval_ != 0)
+    ESP_LOGCONFIG(TAG, "  Frame Rate: %.1f frames/s", 1e6f / this->frame_interval_);
 }
 void LightState::loop() {
-  // Apply effect (if any)
   auto *effect = this->get_active_effect_();
-  if (effect != nullptr) {
-    effect->apply();
+  const bool rendering = effect != nullptr || this->transformer_ != nullptr;
+  bool render = rendering;
+  uint32_t start = 0;
+  if (this->frame_interval_ != 0) {
+    start = micros();
+    if (rendering != this->rendering_) {
+      // (re)start the frame clock with the first frame right away
+      this->next_frame_ = start;
+      this->window_frames_ = 0;
+      this->window_frame_time_ = 0;
+      if (rendering && this->frame_interval_ < App.get_loop_interval() * 1000) {
+        this->high_freq_.start();
+      } else {
+        this->high_freq_.stop();
+      }
+    }
+    render = rendering && this->frame_due_(start);
   }
+  this->rendering_ = rendering;
 
-  // Apply transformer (if any)
-  if (this->transformer_ != nullptr) {
-    auto values = this->transformer_->apply();
-    if (values.has_value()) {
-      this->current_values = *values;
-      this->output_->update_state(this);
-      this->next_write_ = true;
+  if (render) {
+    // Apply effect (if any)
+    if (effect != nullptr) {
+      effect->apply();
     }
 
-    if (this->transformer_->is_finished()) {
-      // if the transition has written directly to the output, current_values is outdated, so update it
-      this->current_values = this->transformer_->get_target_values();
+    // Apply transformer (if any)
+    if (this->transformer_ != nullptr) {
+      auto values = this->transformer_->apply();
+      if (values.has_value()) {
+        this->current_values = *values;
+        this->output_->update_state(this);
+        this->next_write_ = true;
+      }
 
-      this->transformer_->stop();
-      this->transformer_ = nullptr;
-      this->target_state_reached_callback_.call();
+      if (this->transformer_->is_finished()) {
+        // if the transition has written directly to the output, current_values is outdated, so update it
+        this->current_values = this->transformer_->get_target_values();
+
+        this->transformer_->stop();
+        this->transformer_ = nullptr;
+        this->target_state_reached_callback_.call();
+      }
     }
   }
 
@@ -141,11 +169,49 @@ void LightState::loop() {
     this->next_write_ = false;
     this->output_->write_state(this);
   }
+
+  if (render && this->frame_interval_ != 0) {
+    const uint32_t now = micros();
+    this->record_frame_(now, now - start);
+  }
+}
+
+bool LightState::frame_due_(uint32_t now) {
+  const auto late = static_cast<int32_t>(now - this->next_frame_);
+  if (late < 0)
+    return false;
+  // stay on the frame clock, frames that were missed entirely are dropped
+  const uint32_t missed = late / this->frame_interval_;
+  this->skipped_frames_ += missed;
+  this->next_frame_ += (missed + 1) * this->frame_interval_;
+  return true;
+}
+
+void LightState::record_frame_(uint32_t now, uint32_t frame_time) {
+  // statistics are collected over windows of about one second
+  static const uint32_t WINDOW_LENGTH = 1000000;
+  if (this->window_frames_ == 0)
+    this->window_start_ = now - frame_time;
+  this->window_frames_++;
+  this->window_frame_time_ += frame_time;
+  const uint32_t elapsed = now - this->window_start_;
+  if (elapsed < WINDOW_LENGTH)
+    return;
+
+  this->achieved_frame_rate_ = this->window_frames_ * 1e6f / elapsed;
+  this->average_frame_time_ = this->window_frame_time_ / this->window_frames_;
+  ESP_LOGV(TAG, "'%s': %.1f frames/s, %" PRIu32 " us/frame, %" PRIu32 " frames skipped", this->get_name().c_str(),
+           this->achieved_frame_rate_, this->average_frame_time_, this->skipped_frames_);
+  this->window_frames_ = 0;
+  this->window_frame_time_ = 0;
 }
 
 float LightState::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 
-void LightState::publish_state() { this->remote_values_callback_.call(); }
+void LightState::publish_state() {
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_LIGHT, this->get_entity_index());
+  this->remote_values_callback_.call();
+}
 
 LightOutput *LightState::get_output() const { return this->output_; }
 std::string LightState::get_effect_name() {
@@ -172,6 +238,9 @@ void LightState::set_flash_transition_length(uint32_t flash_transition_length) {
 }
 uint32_t LightState::get_flash_transition_length() const { return this->flash_transition_length_; }
 void LightState::set_gamma_correct(float gamma_correct) { this->gamma_correct_ = gamma_correct; }
+void LightState::set_frame_rate(float frame_rate) {
+  this->frame_interval_ = frame_rate > 0.0f ? static_cast<uint32_t>(1e6f / frame_rate) : 0;
+}
 void LightState::set_restore_mode(LightRestoreMode restore_mode) { this->restore_mode_ = restore_mode; }
 bool LightState::supports_effects() { return !this->effects_.empty(); }
 const std::vector<LightEffect *> &LightState::get_effects() const { return this->effects_; }
@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/entity_base.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/optional.h"
 #include "esphome/core/preferences.h"
 #include "light_call.h"
@@ -116,6 +117,19 @@ class LightState : public EntityBase, public Component {
   /// Set the restore mode of this light
   void set_restore_mode(LightRestoreMode restore_mode);
 
+  /** Set the rate at which effects and transitions are rendered, 0 renders them in every loop iteration.
+   *
+   * Frames are aligned to a fixed clock: if rendering falls behind, the missed frames are skipped instead of delaying
+   * the following ones. Effects and transitions take their progress from the elapsed time, so they keep their speed.
+   */
+  void set_frame_rate(float frame_rate);
+  /// Frames per second rendered during the last complete statistics window (0 before the first one).
+  float get_achieved_frame_rate() const { return this->achieved_frame_rate_; }
+  /// Average time in µs spent rendering and writing a frame during the last complete statistics window.
+  uint32_t get_average_frame_time() const { return this->average_frame_time_; }
+  /// Total number of frames that were skipped because rendering fell behind the frame clock.
+  uint32_t get_skipped_frames() const { return this->skipped_frames_; }
+
   /// Return whether the light has any effects that meet the trait requirements.
   bool supports_effects();
 
@@ -167,6 +181,11 @@ class LightState : public EntityBase, public Component {
   /// Internal method to save the current remote_values to the preferences
   void save_remote_values_();
 
+  /// Advance the frame clock, returns whether a frame is due.
+  bool frame_due_(uint32_t now);
+  /// Account a rendered frame for the statistics.
+  void record_frame_(uint32_t now, uint32_t frame_time);
+
   /// Store the output to allow effects to have more access.
   LightOutput *output_;
   /// Value for storing the index of the currently active effect. 0 if no effect is active
@@ -203,6 +222,22 @@ class LightState : public EntityBase, public Component {
   LightRestoreMode restore_mode_;
   /// List of effects for this light.
   std::vector<LightEffect *> effects_;
+
+  /// Interval of the frame clock in µs, 0 if frames are rendered in every loop iteration.
+  uint32_t frame_interval_{0};
+  /// Start of the next frame in µs.
+  uint32_t next_frame_{0};
+  /// Whether an effect or transition was being rendered in the previous loop iteration.
+  bool rendering_{false};
+  /// Makes the main loop run often enough for frame rates above its own rate.
+  HighFrequencyLoopRequester high_freq_;
+
+  uint32_t skipped_frames_{0};
+  uint32_t window_start_{0};
+  uint32_t window_frames_{0};
+  uint32_t window_frame_time_{0};
+  float achieved_frame_rate_{0.0f};
+  uint32_t average_frame_time_{0};
 };
 
 }  // namespace light
@@ -1,4 +1,5 @@
 #include "lock.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -51,7 +52,8 @@ void Lock::publish_state(LockState state) {
 
   this->state = state;
   this->rtc_.save(&this->state);
-  ESP_LOGD(TAG, "'%s': Sending state %s", this->name_.c_str(), lock_state_to_string(state));
+  ESP_LOGD(TAG, "'%s': Sending state %s", this->get_name().c_str(), lock_state_to_string(state));
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_LOCK, this->get_entity_index());
   this->state_callback_.call();
 }
 
@@ -21,6 +21,7 @@ from esphome.const import (
     PLATFORM_RTL87XX,
     PLATFORM_ESP32,
     PLATFORM_ESP8266,
+    PLATFORM_HOST,
     PLATFORM_RP2040,
 )
 from esphome.core import CORE, EsphomeError, Lambda, coroutine_with_priority
@@ -160,6 +161,7 @@ LoggerMessageTrigger = logger_ns.class_(
 )
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_DEFERRED_BUFFER_SIZE = "deferred_buffer_size"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -206,6 +208,10 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(
                 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH, esp8266=True
             ): cv.All(cv.only_on_esp8266, cv.boolean),
+            cv.Optional(CONF_DEFERRED_BUFFER_SIZE): cv.All(
+                cv.only_on([PLATFORM_ESP32, PLATFORM_HOST]),
+                cv.int_range(min=0, max=1024),
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
@@ -222,6 +228,9 @@ async def to_code(config):
                 HARDWARE_UART_TO_UART_SELECTION[config[CONF_HARDWARE_UART]]
             )
         )
+    if config.get(CONF_DEFERRED_BUFFER_SIZE, 0) > 0:
+        cg.add_define("USE_LOGGER_DEFERRED")
+        cg.add(log.set_deferred_buffer_size(config[CONF_DEFERRED_BUFFER_SIZE]))
     cg.add(log.pre_setup())
 
     for tag, level in config[CONF_LOGS].items():
@@ -0,0 +1,362 @@
+#include "deferred_log_buffer.h"
+
+#ifdef USE_LOGGER_DEFERRED
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+enum FormatArgKind : uint8_t {
+  FORMAT_ARG_NONE,
+  FORMAT_ARG_INT,
+  FORMAT_ARG_LONG,
+  FORMAT_ARG_LONG_LONG,
+  FORMAT_ARG_SIZE,
+  FORMAT_ARG_DOUBLE,
+  FORMAT_ARG_POINTER,
+  FORMAT_ARG_STRING,
+  FORMAT_ARG_INVALID,
+};
+
+/// One conversion specification of a printf format string.
+struct FormatSpec {
+  const char *start;  // the '%'
+  const char *end;    // one past the conversion character
+  uint8_t stars;      // width and/or precision passed as int arguments
+  bool star_precision;
+  int precision;  // -1 if not given in the format string
+  FormatArgKind kind;
+};
+
+static void parse_spec(const char *start, FormatSpec &spec) {
+  const char *p = start + 1;
+  spec.start = start;
+  spec.stars = 0;
+  spec.star_precision = false;
+  spec.precision = -1;
+  while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+    p++;
+  if (*p == '*') {
+    spec.stars++;
+    p++;
+  } else {
+    while (isdigit(*p))
+      p++;
+  }
+  if (*p == '.') {
+    p++;
+    if (*p == '*') {
+      spec.stars++;
+      spec.star_precision = true;
+      p++;
+    } else {
+      spec.precision = 0;
+      while (isdigit(*p))
+        spec.precision = spec.precision * 10 + (*p++ - '0');
+    }
+  }
+  int longs = 0;
+  bool size = false, unsupported = false;
+  for (;; p++) {
+    if (*p == 'h') {
+      continue;
+    } else if (*p == 'l') {
+      longs++;
+    } else if (*p == 'z') {
+      size = true;
+    } else if (*p == 'j' || *p == 't' || *p == 'L') {
+      unsupported = true;
+    } else {
+      break;
+    }
+  }
+  char conversion = *p;
+  spec.end = conversion == '\0' ? p : p + 1;
+  switch (conversion) {
+    case 'd':
+    case 'i':
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+      if (unsupported) {
+        spec.kind = FORMAT_ARG_INVALID;
+      } else if (size) {
+        spec.kind = FORMAT_ARG_SIZE;
+      } else {
+        spec.kind = longs == 0 ? FORMAT_ARG_INT : longs == 1 ? FORMAT_ARG_LONG : FORMAT_ARG_LONG_LONG;
+      }
+      break;
+    case 'c':
+      spec.kind = longs || size || unsupported ? FORMAT_ARG_INVALID : FORMAT_ARG_INT;
+      break;
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+      spec.kind = unsupported ? FORMAT_ARG_INVALID : FORMAT_ARG_DOUBLE;
+      break;
+    case 's':
+      spec.kind = longs || size || unsupported ? FORMAT_ARG_INVALID : FORMAT_ARG_STRING;
+      break;
+    case 'p':
+      spec.kind = FORMAT_ARG_POINTER;
+      break;
+    case '%':
+      spec.kind = spec.stars == 0 ? FORMAT_ARG_NONE : FORMAT_ARG_INVALID;
+      break;
+    default:
+      // %n, wide characters and malformed specifications
+      spec.kind = FORMAT_ARG_INVALID;
+      break;
+  }
+}
+
+template<typename T> static bool put_arg(uint8_t *&out, const uint8_t *end, T value) {
+  if (size_t(end - out) < sizeof(T))
+    return false;
+  memcpy(out, &value, sizeof(T));
+  out += sizeof(T);
+  return true;
+}
+
+template<typename T> static T take_arg(const uint8_t *&in) {
+  T value;
+  memcpy(&value, in, sizeof(T));
+  in += sizeof(T);
+  return value;
+}
+
+/// Record the arguments into `payload`, returns the number of bytes used or -1 if they don't fit or aren't supported.
+static int encode_args(uint8_t *payload, const char *format, va_list args) {
+  uint8_t *out = payload;
+  const uint8_t *end = payload + DEFERRED_LOG_PAYLOAD_SIZE;
+  for (const char *p = format; *p != '\0'; p++) {
+    if (*p != '%')
+      continue;
+    FormatSpec spec;
+    parse_spec(p, spec);
+    if (spec.kind == FORMAT_ARG_INVALID)
+      return -1;
+    p = spec.end - 1;
+    int precision = spec.precision;
+    for (uint8_t i = 0; i < spec.stars; i++) {
+      // the precision is the last one
+      precision = va_arg(args, int);
+      if (!put_arg(out, end, precision))
+        return -1;
+    }
+    if (!spec.star_precision)
+      precision = spec.precision;
+    bool ok = true;
+    switch (spec.kind) {
+      case FORMAT_ARG_INT:
+        ok = put_arg(out, end, va_arg(args, int));
+        break;
+      case FORMAT_ARG_LONG:
+        ok = put_arg(out, end, va_arg(args, long));
+        break;
+      case FORMAT_ARG_LONG_LONG:
+        ok = put_arg(out, end, va_arg(args, long long));
+        break;
+      case FORMAT_ARG_SIZE:
+        ok = put_arg(out, end, va_arg(args, size_t));
+        break;
+      case FORMAT_ARG_DOUBLE:
+        ok = put_arg(out, end, va_arg(args, double));
+        break;
+      case FORMAT_ARG_POINTER:
+        ok = put_arg(out, end, va_arg(args, void *));
+        break;
+      case FORMAT_ARG_STRING: {
+        // the string may not outlive the call, so copy it, only up to the precision (a negative one means none)
+        const char *str = va_arg(args, const char *);
+        if (str == nullptr)
+          str = "(null)";
+        if (out == end)
+          return -1;
+        size_t limit = end - out - 1;
+        bool limited = precision >= 0 && size_t(precision) <= limit;
+        if (limited)
+          limit = precision;
+        size_t length = strnlen(str, limit);
+        if (length == limit && !limited && str[length] != '\0')
+          return -1;
+        memcpy(out, str, length);
+        out += length;
+        *out++ = '\0';
+        break;
+      }
+      default:
+        break;
+    }
+    if (!ok)
+      return -1;
+  }
+  return out - payload;
+}
+
+DeferredLogBuffer::DeferredLogBuffer(size_t capacity) {
+  uint32_t size = 1;
+  while (size < capacity)
+    size <<= 1;
+  this->mask_ = size - 1;
+  this->records_ = std::unique_ptr<DeferredLogRecord[]>(new DeferredLogRecord[size]);  // NOLINT
+  for (uint32_t i = 0; i < size; i++)
+    this->records_[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+DeferredPushResult DeferredLogBuffer::push(int level, const char *tag, int line, const char *format, va_list args,
+                                           bool truncate) {
+  // encoded before a slot is claimed, a claimed slot can't be given back
+  uint8_t payload[DEFERRED_LOG_PAYLOAD_SIZE];
+  const char *payload_format = format;
+  va_list arg_copy;
+  va_copy(arg_copy, args);
+  int length = encode_args(payload, format, arg_copy);
+  va_end(arg_copy);
+  if (length < 0) {
+    // not representable as raw arguments, format right away
+    payload_format = nullptr;
+    auto *text = reinterpret_cast<char *>(payload);
+    text[0] = '\0';
+    va_copy(arg_copy, args);
+    length = vsnprintf(text, DEFERRED_LOG_PAYLOAD_SIZE, format, arg_copy);
+    va_end(arg_copy);
+    if (length >= int(DEFERRED_LOG_PAYLOAD_SIZE) && !truncate)
+      return DEFERRED_TOO_LONG;
+    length = strnlen(text, DEFERRED_LOG_PAYLOAD_SIZE - 1);
+  }
+
+  DeferredLogRecord *record;
+  uint32_t pos = this->enqueue_pos_.load(std::memory_order_relaxed);
+  while (true) {
+    record = &this->records_[pos & this->mask_];
+    uint32_t sequence = record->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<int32_t>(sequence - pos);
+    if (diff == 0) {
+      // slot is free, claim it
+      if (this->enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      // slot still holds a record from the previous lap, the ring is full
+      return DEFERRED_FULL;
+    } else {
+      // another producer claimed it first
+      pos = this->enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  record->tag = tag;
+  record->line = line;
+  record->level = level;
+  record->format = payload_format;
+  record->length = length;
+  memcpy(record->payload, payload, length);
+  if (payload_format == nullptr)
+    record->payload[length] = '\0';
+  record->sequence.store(pos + 1, std::memory_order_release);
+  return DEFERRED_PUSHED;
+}
+
+const DeferredLogRecord *DeferredLogBuffer::front() const {
+  const DeferredLogRecord *record = &this->records_[this->dequeue_pos_ & this->mask_];
+  if (record->sequence.load(std::memory_order_acquire) != this->dequeue_pos_ + 1)
+    return nullptr;
+  return record;
+}
+
+void DeferredLogBuffer::pop() {
+  DeferredLogRecord *record = &this->records_[this->dequeue_pos_ & this->mask_];
+  // hand the slot to the producer of the next lap
+  record->sequence.store(this->dequeue_pos_ + this->mask_ + 1, std::memory_order_release);
+  this->dequeue_pos_++;
+}
+
+size_t DeferredLogBuffer::format(const DeferredLogRecord &record, char *out, size_t size) {
+  if (size == 0)
+    return 0;
+  size_t at = 0;
+  if (record.format == nullptr) {
+    at = std::min<size_t>(record.length, size - 1);
+    memcpy(out, record.payload, at);
+    out[at] = '\0';
+    return at;
+  }
+
+  const uint8_t *in = record.payload;
+  const char *p = record.format;
+  while (*p != '\0' && at + 1 < size) {
+    if (*p != '%') {
+      out[at++] = *p++;
+      continue;
+    }
+    FormatSpec spec;
+    parse_spec(p, spec);
+    p = spec.end;
+    if (spec.kind == FORMAT_ARG_NONE) {
+      out[at++] = '%';
+      continue;
+    }
+    // copy the specification, substituting the recorded width and precision for '*'
+    char conversion[32];
+    size_t length = 0;
+    for (const char *c = spec.start; c < spec.end && length + 12 < sizeof(conversion); c++) {
+      if (*c == '*') {
+        length += snprintf(conversion + length, sizeof(conversion) - length, "%d", take_arg<int>(in));
+      } else {
+        conversion[length++] = *c;
+      }
+    }
+    conversion[length] = '\0';
+
+    char *dest = out + at;
+    size_t remaining = size - at;
+    int ret = 0;
+    switch (spec.kind) {
+      case FORMAT_ARG_INT:
+        ret = snprintf(dest, remaining, conversion, take_arg<int>(in));  // NOLINT
+        break;
+      case FORMAT_ARG_LONG:
+        ret = snprintf(dest, remaining, conversion, take_arg<long>(in));  // NOLINT
+        break;
+      case FORMAT_ARG_LONG_LONG:
+        ret = snprintf(dest, remaining, conversion, take_arg<long long>(in));  // NOLINT
+        break;
+      case FORMAT_ARG_SIZE:
+        ret = snprintf(dest, remaining, conversion, take_arg<size_t>(in));  // NOLINT
+        break;
+      case FORMAT_ARG_DOUBLE:
+        ret = snprintf(dest, remaining, conversion, take_arg<double>(in));  // NOLINT
+        break;
+      case FORMAT_ARG_POINTER:
+        ret = snprintf(dest, remaining, conversion, take_arg<void *>(in));  // NOLINT
+        break;
+      case FORMAT_ARG_STRING: {
+        const char *str = reinterpret_cast<const char *>(in);
+        in += strlen(str) + 1;
+        ret = snprintf(dest, remaining, conversion, str);  // NOLINT
+        break;
+      }
+      default:
+        break;
+    }
+    if (ret > 0)
+      at += std::min<size_t>(ret, remaining - 1);
+  }
+  out[at] = '\0';
+  return at;
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_DEFERRED
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_DEFERRED
+
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace logger {
+
+/// Bytes available in a record for the arguments of a log call.
+static const size_t DEFERRED_LOG_PAYLOAD_SIZE = 112;
+
+/** A log call that has not been formatted yet.
+ *
+ * The payload holds the raw arguments in the order of the format string, string arguments are copied (up to their
+ * precision). If the arguments can't be recorded, the message is formatted by the caller and stored as text with
+ * `format` set to nullptr.
+ */
+struct DeferredLogRecord {
+  std::atomic<uint32_t> sequence;
+  const char *tag;
+  const char *format;
+  uint16_t line;
+  uint8_t level;
+  uint8_t length;
+  uint8_t payload[DEFERRED_LOG_PAYLOAD_SIZE];
+};
+
+enum DeferredPushResult : uint8_t {
+  DEFERRED_PUSHED,
+  /// the ring is full
+  DEFERRED_FULL,
+  /// the arguments and the formatted message are larger than the payload
+  DEFERRED_TOO_LONG,
+};
+
+/** Lock-free multi-producer, single-consumer ring of log records.
+ *
+ * Every slot carries a sequence number telling producers and the consumer whose turn it is, so producers on any task
+ * only claim a slot with a compare-and-swap and copy the arguments. Formatting and output happen when the logger drains
+ * the ring from the main loop.
+ */
+class DeferredLogBuffer {
+ public:
+  /// The capacity is rounded up to a power of two.
+  explicit DeferredLogBuffer(size_t capacity);
+
+  /** Record a log call, `args` is left untouched.
+   *
+   * A message that doesn't fit into a record is only recorded (truncated) if `truncate` is set, otherwise
+   * DEFERRED_TOO_LONG is returned and the caller should format it right away.
+   */
+  DeferredPushResult push(int level, const char *tag, int line, const char *format, va_list args, bool truncate);
+  /// Oldest record, or nullptr if the ring is empty. Only to be called by the consumer.
+  const DeferredLogRecord *front() const;
+  /// Release the record returned by front().
+  void pop();
+
+  void record_dropped() { this->dropped_.fetch_add(1, std::memory_order_relaxed); }
+  /// Total number of messages that did not fit into the ring.
+  uint32_t get_dropped() const { return this->dropped_.load(std::memory_order_relaxed); }
+  size_t get_capacity() const { return this->mask_ + 1; }
+
+  /// Format a record into `out`, returns the number of characters written (excluding the null terminator).
+  static size_t format(const DeferredLogRecord &record, char *out, size_t size);
+
+ protected:
+  std::unique_ptr<DeferredLogRecord[]> records_;
+  uint32_t mask_;
+  std::atomic<uint32_t> enqueue_pos_{0};
+  uint32_t dequeue_pos_{0};
+  std::atomic<uint32_t> dropped_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_DEFERRED
@@ -26,6 +26,11 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#if defined(USE_LOGGER_DEFERRED) && defined(USE_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 namespace logger {
 
@@ -64,7 +69,13 @@ void Logger::write_header_(int level, const char *tag, int line) {
 }
 
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if (level > this->level_for(tag))
+    return;
+#ifdef USE_LOGGER_DEFERRED
+  if (this->deferred_buffer_ != nullptr && this->defer_(level, tag, line, format, args))
+    return;
+#endif
+  if (recursion_guard_)
     return;
 
   recursion_guard_ = true;
@@ -106,6 +117,89 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
 }
 #endif
 
+#ifdef USE_LOGGER_DEFERRED
+bool Logger::is_main_task_() const {
+#ifdef USE_ESP32
+  return xTaskGetCurrentTaskHandle() == this->main_task_;
+#else
+  return true;
+#endif
+}
+
+bool HOT Logger::defer_(int level, const char *tag, int line, const char *format, va_list args) {
+  bool can_write = this->is_main_task_() && !this->recursion_guard_;
+  if (can_write && level <= ESPHOME_LOG_LEVEL_ERROR) {
+    // Errors are written right away so they make it out before a possible crash, after what was queued before them
+    this->process_deferred_();
+    return false;
+  }
+  // only other tasks have to put up with a truncated message, the main task writes it right away
+  DeferredPushResult result = this->deferred_buffer_->push(level, tag, line, format, args, !can_write);
+  if (result == DEFERRED_PUSHED)
+    return true;
+  if (can_write) {
+    // Make room by writing out the queued messages, this keeps them in order with the new one
+    this->process_deferred_();
+    if (result == DEFERRED_TOO_LONG)
+      return false;
+    return this->deferred_buffer_->push(level, tag, line, format, args, false) == DEFERRED_PUSHED;
+  }
+  this->deferred_buffer_->record_dropped();
+  return true;
+}
+
+void Logger::process_deferred_() {
+  if (this->recursion_guard_)
+    return;
+
+  uint32_t dropped = this->deferred_buffer_->get_dropped();
+  if (dropped != this->reported_dropped_) {
+    this->recursion_guard_ = true;
+    this->reset_buffer_();
+    this->write_header_(ESPHOME_LOG_LEVEL_WARN, TAG, __LINE__);
+    this->printf_to_buffer_("%" PRIu32 " log messages dropped, deferred buffer full", dropped - this->reported_dropped_);
+    this->write_footer_();
+    this->log_message_(ESPHOME_LOG_LEVEL_WARN, TAG);
+    this->recursion_guard_ = false;
+    this->reported_dropped_ = dropped;
+  }
+
+  // Messages logged by the log callbacks are queued as well, limit the work to one lap of the ring
+  for (size_t i = 0; i < this->deferred_buffer_->get_capacity(); i++) {
+    const DeferredLogRecord *record = this->deferred_buffer_->front();
+    if (record == nullptr)
+      break;
+    int level = record->level;
+    const char *tag = record->tag;
+    this->recursion_guard_ = true;
+    this->reset_buffer_();
+    this->write_header_(level, tag, record->line);
+    if (!this->is_buffer_full_()) {
+      this->tx_buffer_at_ += DeferredLogBuffer::format(*record, this->tx_buffer_ + this->tx_buffer_at_,
+                                                       this->buffer_remaining_capacity_());
+    }
+    this->deferred_buffer_->pop();
+    this->write_footer_();
+    this->log_message_(level, tag);
+    this->recursion_guard_ = false;
+  }
+}
+
+void Logger::loop() {
+  if (this->deferred_buffer_ != nullptr)
+    this->process_deferred_();
+}
+
+void Logger::on_shutdown() {
+  if (this->deferred_buffer_ != nullptr)
+    this->process_deferred_();
+}
+
+uint32_t Logger::get_dropped_messages() const {
+  return this->deferred_buffer_ == nullptr ? 0 : this->deferred_buffer_->get_dropped();
+}
+#endif
+
 #ifdef USE_ESP_IDF
 void Logger::init_uart_() {
   uart_config_t uart_config{};
@@ -340,6 +434,14 @@ void Logger::pre_setup() {
   }
 #endif  // USE_ESP8266
 
+#ifdef USE_LOGGER_DEFERRED
+  if (this->deferred_buffer_size_ > 0) {
+    this->deferred_buffer_ = make_unique<DeferredLogBuffer>(this->deferred_buffer_size_);
+#ifdef USE_ESP32
+    this->main_task_ = xTaskGetCurrentTaskHandle();
+#endif
+  }
+#endif
   global_logger = this;
 #if defined(USE_ESP_IDF) || defined(USE_ESP32_FRAMEWORK_ARDUINO)
   esp_log_set_vprintf(esp_idf_log_vprintf_);
@@ -391,6 +493,14 @@ void Logger::pre_setup() {
     }
   }
 
+#ifdef USE_LOGGER_DEFERRED
+  if (this->deferred_buffer_size_ > 0) {
+    this->deferred_buffer_ = make_unique<DeferredLogBuffer>(this->deferred_buffer_size_);
+#ifdef USE_ESP32
+    this->main_task_ = xTaskGetCurrentTaskHandle();
+#endif
+  }
+#endif
   global_logger = this;
   ESP_LOGI(TAG, "Log initialized");
 }
@@ -443,6 +553,12 @@ void Logger::dump_config() {
   ESP_LOGCONFIG(TAG, "  Hardware UART: %s", UART_SELECTIONS[this->uart_]);
 #endif
 
+#ifdef USE_LOGGER_DEFERRED
+  if (this->deferred_buffer_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Deferred Buffer: %zu messages", this->deferred_buffer_->get_capacity());
+  }
+#endif
+
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
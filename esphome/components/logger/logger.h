@@ -7,6 +7,11 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
+#ifdef USE_LOGGER_DEFERRED
+#include <memory>
+#include "deferred_log_buffer.h"
+#endif
+
 #ifdef USE_ARDUINO
 #if defined(USE_ESP8266) || defined(USE_ESP32)
 #include <HardwareSerial.h>
@@ -87,11 +92,22 @@ class Logger : public Component {
   /// Set the log level of the specified tag.
   void set_log_level(const std::string &tag, int log_level);
 
+#ifdef USE_LOGGER_DEFERRED
+  /// Number of log calls that can be queued for formatting in the main loop, set to 0 to log synchronously.
+  void set_deferred_buffer_size(size_t size) { this->deferred_buffer_size_ = size; }
+  /// Number of log messages that were dropped because the deferred buffer was full.
+  uint32_t get_dropped_messages() const;
+#endif
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Set up this component.
   void pre_setup();
   void dump_config() override;
+#ifdef USE_LOGGER_DEFERRED
+  void loop() override;
+  void on_shutdown() override;
+#endif
 
   int level_for(const char *tag);
 
@@ -119,6 +135,13 @@ class Logger : public Component {
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
+#ifdef USE_LOGGER_DEFERRED
+  /// Queue a log call for the main loop, returns false if it has to be logged synchronously.
+  bool defer_(int level, const char *tag, int line, const char *format, va_list args);
+  /// Format and write out the queued log calls.
+  void process_deferred_();
+  bool is_main_task_() const;
+#endif
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -182,6 +205,15 @@ class Logger : public Component {
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
+#ifdef USE_LOGGER_DEFERRED
+  size_t deferred_buffer_size_{0};
+  std::unique_ptr<DeferredLogBuffer> deferred_buffer_;
+  /// Drop count that has already been reported in the log.
+  uint32_t reported_dropped_{0};
+#ifdef USE_ESP32
+  void *main_task_{nullptr};
+#endif
+#endif
 };
 
 extern Logger *global_logger;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
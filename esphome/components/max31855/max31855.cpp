@@ -19,7 +19,7 @@ void MAX31855Sensor::update() {
 }
 
 void MAX31855Sensor::setup() {
-  ESP_LOGCONFIG(TAG, "Setting up MAX31855Sensor '%s'...", this->name_.c_str());
+  ESP_LOGCONFIG(TAG, "Setting up MAX31855Sensor '%s'...", this->get_name().c_str());
   this->spi_setup();
 }
 void MAX31855Sensor::dump_config() {
@@ -229,6 +229,32 @@ canbus::Error MCP2515::set_filter_(const RXF num, const bool extended, const uin
   return canbus::ERROR_OK;
 }
 
+void MCP2515::set_filters(const std::vector<canbus::CanFilter> &filters) {
+  auto standard = canbus::merge_filters(filters, false);
+  auto extended = canbus::merge_filters(filters, true);
+  if (!standard.has_value() && !extended.has_value())
+    return;
+  // RXB0 (mask 0, filters 0-1) receives standard frames, RXB1 (mask 1, filters 2-5) extended ones. Frames passing
+  // RXB0 roll over into RXB1 when it is full.
+  const canbus::CanFilter &rxb0 = standard.has_value() ? *standard : *extended;
+  const canbus::CanFilter &rxb1 = extended.has_value() ? *extended : *standard;
+  bool ok = this->set_filter_mask_(MASK0, rxb0.use_extended_id, rxb0.mask) == canbus::ERROR_OK;
+  for (RXF num : {RXF0, RXF1})
+    ok &= this->set_filter_(num, rxb0.use_extended_id, rxb0.id) == canbus::ERROR_OK;
+  ok &= this->set_filter_mask_(MASK1, rxb1.use_extended_id, rxb1.mask) == canbus::ERROR_OK;
+  for (RXF num : {RXF2, RXF3, RXF4, RXF5})
+    ok &= this->set_filter_(num, rxb1.use_extended_id, rxb1.id) == canbus::ERROR_OK;
+  ok &= this->set_mode_(this->mcp_mode_) == canbus::ERROR_OK;
+  if (!ok) {
+    ESP_LOGW(TAG, "Setting the acceptance filters failed");
+    return;
+  }
+  ESP_LOGD(TAG, "Acceptance filter RXB0: %s id=0x%08" PRIx32 " mask=0x%08" PRIx32,
+           rxb0.use_extended_id ? "extended" : "standard", rxb0.id, rxb0.mask);
+  ESP_LOGD(TAG, "Acceptance filter RXB1: %s id=0x%08" PRIx32 " mask=0x%08" PRIx32,
+           rxb1.use_extended_id ? "extended" : "standard", rxb1.id, rxb1.mask);
+}
+
 canbus::Error MCP2515::send_message_(TXBn txbn, struct canbus::CanFrame *frame) {
   const struct TxBnRegs *txbuf = &TXB[txbn];
 
@@ -95,6 +95,7 @@ class MCP2515 : public canbus::Canbus,
   canbus::Error send_message(struct canbus::CanFrame *frame) override;
   canbus::Error read_message_(RXBn rxbn, struct canbus::CanFrame *frame);
   canbus::Error read_message(struct canbus::CanFrame *frame) override;
+  void set_filters(const std::vector<canbus::CanFilter> &filters) override;
   bool check_receive_();
   bool check_error_();
   uint8_t get_error_flags_();
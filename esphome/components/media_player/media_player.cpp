@@ -1,5 +1,6 @@
 #include "media_player.h"
 
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -112,7 +113,10 @@ void MediaPlayer::add_on_state_callback(std::function<void()> &&callback) {
   this->state_callback_.add(std::move(callback));
 }
 
-void MediaPlayer::publish_state() { this->state_callback_.call(); }
+void MediaPlayer::publish_state() {
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_MEDIA_PLAYER, this->get_entity_index());
+  this->state_callback_.call();
+}
 
 }  // namespace media_player
 }  // namespace esphome
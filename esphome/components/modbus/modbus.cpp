@@ -2,10 +2,15 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 namespace esphome {
 namespace modbus {
 
 static const char *const TAG = "modbus";
+/// an unresponsive device is skipped for at most send_wait_time_ << MAX_BACKOFF_SHIFT ms
+static const uint8_t MAX_BACKOFF_SHIFT = 5;
 
 void Modbus::setup() {
   if (this->flow_control_pin_ != nullptr) {
@@ -21,6 +26,8 @@ void Modbus::loop() {
   }
   // stop blocking new send commands after send_wait_time_ ms regardless if a response has been received since then
   if (now - this->last_send_ > send_wait_time_) {
+    if (waiting_for_response != 0)
+      this->on_response_timeout_(waiting_for_response, now);
     waiting_for_response = 0;
   }
 
@@ -33,6 +40,56 @@ void Modbus::loop() {
       this->rx_buffer_.clear();
     }
   }
+
+  if (waiting_for_response == 0)
+    this->schedule_next_command_();
+}
+
+void Modbus::schedule_next_command_() {
+  const uint32_t now = millis();
+  const size_t count = this->devices_.size();
+  ModbusDevice *next = nullptr;
+  size_t next_index = 0;
+  ModbusCommandPriority next_priority = MODBUS_PRIORITY_READ;
+  uint32_t next_deadline = 0;
+  // start after the device that sent last, so devices with equal commands take turns
+  for (size_t i = 1; i <= count; i++) {
+    size_t index = (this->last_scheduled_ + i) % count;
+    ModbusDevice *device = this->devices_[index];
+    if (device->stats_.consecutive_timeouts != 0 && static_cast<int32_t>(now - device->skip_until_) < 0)
+      continue;
+    ModbusCommandPriority priority;
+    uint32_t deadline;
+    if (!device->get_pending_command(priority, deadline))
+      continue;
+    if (next == nullptr || priority > next_priority ||
+        (priority == next_priority && static_cast<int32_t>(deadline - next_deadline) < 0)) {
+      next = device;
+      next_index = index;
+      next_priority = priority;
+      next_deadline = deadline;
+    }
+  }
+  if (next == nullptr)
+    return;
+  this->last_scheduled_ = next_index;
+  next->send_pending_command();
+}
+
+void Modbus::on_response_timeout_(uint8_t address, uint32_t now) {
+  for (auto *device : this->devices_) {
+    if (device->address_ != address)
+      continue;
+    auto &stats = device->stats_;
+    stats.timeouts++;
+    if (stats.consecutive_timeouts < UINT8_MAX)
+      stats.consecutive_timeouts++;
+    // back off exponentially, so an offline device doesn't keep the others waiting for its timeouts
+    uint8_t shift = std::min<uint8_t>(stats.consecutive_timeouts - 1, MAX_BACKOFF_SHIFT);
+    uint32_t backoff = uint32_t(this->send_wait_time_) << shift;
+    device->skip_until_ = now + backoff;
+    ESP_LOGD(TAG, "No response from device 0x%02X, skipping it for %" PRIu32 " ms", address, backoff);
+  }
 }
 
 bool Modbus::parse_modbus_byte_(uint8_t byte) {
@@ -112,8 +169,19 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
   }
   std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
   bool found = false;
+  uint32_t latency = millis() - this->last_send_;
   for (auto *device : this->devices_) {
     if (device->address_ == address) {
+      if (waiting_for_response == address) {
+        auto &stats = device->stats_;
+        stats.responses++;
+        stats.consecutive_timeouts = 0;
+        stats.last_latency_ms = latency;
+        stats.max_latency_ms = std::max(stats.max_latency_ms, latency);
+        stats.average_latency_ms = stats.responses == 1 ? latency : (stats.average_latency_ms * 7 + latency) / 8;
+        ESP_LOGV(TAG, "Response from device 0x%02X after %" PRIu32 " ms (average %" PRIu32 " ms)", address, latency,
+                 stats.average_latency_ms);
+      }
       // Is it an error response?
       if ((function_code & 0x80) == 0x80) {
         ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, raw[2]);
@@ -10,6 +10,24 @@ namespace modbus {
 
 class ModbusDevice;
 
+/// Commands with a higher priority are sent first, regardless of their deadline
+enum ModbusCommandPriority : uint8_t {
+  MODBUS_PRIORITY_READ = 0,
+  MODBUS_PRIORITY_WRITE = 1,
+};
+
+/// Response statistics of a device, collected by the bus
+struct ModbusDeviceStats {
+  uint32_t responses{0};
+  uint32_t timeouts{0};
+  /// timeouts since the last response, the device is skipped for a growing time while this is not zero
+  uint8_t consecutive_timeouts{0};
+  uint32_t last_latency_ms{0};
+  uint32_t max_latency_ms{0};
+  /// exponential moving average over the last responses
+  uint32_t average_latency_ms{0};
+};
+
 class Modbus : public uart::UARTDevice, public Component {
  public:
   Modbus() = default;
@@ -36,12 +54,18 @@ class Modbus : public uart::UARTDevice, public Component {
   GPIOPin *flow_control_pin_{nullptr};
 
   bool parse_modbus_byte_(uint8_t byte);
+  /// grant the bus to the device with the most urgent pending command
+  void schedule_next_command_();
+  /// the device at `address` did not answer within send_wait_time_
+  void on_response_timeout_(uint8_t address, uint32_t now);
   uint16_t send_wait_time_{250};
   bool disable_crc_;
   std::vector<uint8_t> rx_buffer_;
   uint32_t last_modbus_byte_{0};
   uint32_t last_send_{0};
   std::vector<ModbusDevice *> devices_;
+  /// index of the device that was granted the bus last, ties are resolved round robin starting after it
+  size_t last_scheduled_{0};
 };
 
 class ModbusDevice {
@@ -58,11 +82,26 @@ class ModbusDevice {
   // If more than one device is connected block sending a new command before a response is received
   bool waiting_for_response() { return parent_->waiting_for_response != 0; }
 
+  /** Report the next command this device wants to send.
+   *
+   * Devices that queue their commands let the bus decide when they may send. The bus calls this whenever the line is
+   * idle and grants it to the device with the highest priority and, among those, the earliest deadline (a millis()
+   * timestamp). Devices that send on their own don't override this.
+   */
+  virtual bool get_pending_command(ModbusCommandPriority &priority, uint32_t &deadline) { return false; }
+  /// Called by the bus when the device may send the command it reported with get_pending_command()
+  virtual void send_pending_command() {}
+  /// Response statistics of this device
+  const ModbusDeviceStats &get_stats() const { return this->stats_; }
+
  protected:
   friend Modbus;
 
   Modbus *parent_;
   uint8_t address_;
+  ModbusDeviceStats stats_;
+  /// the bus skips the device until this time after it stopped responding
+  uint32_t skip_until_{0};
 };
 
 }  // namespace modbus
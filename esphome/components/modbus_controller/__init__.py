@@ -2,10 +2,18 @@ import binascii
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import modbus
-from esphome.const import CONF_ADDRESS, CONF_ID, CONF_NAME, CONF_LAMBDA, CONF_OFFSET
+from esphome.const import (
+    CONF_ADDRESS,
+    CONF_COUNT,
+    CONF_ID,
+    CONF_NAME,
+    CONF_LAMBDA,
+    CONF_OFFSET,
+)
 from esphome.cpp_helpers import logging
 from .const import (
     CONF_BITMASK,
+    CONF_BRIDGE_REGISTER_GAPS,
     CONF_BYTE_OFFSET,
     CONF_COMMAND_THROTTLE,
     CONF_OFFLINE_SKIP_UPDATES,
@@ -16,6 +24,7 @@ from .const import (
     CONF_REGISTER_TYPE,
     CONF_RESPONSE_SIZE,
     CONF_SKIP_UPDATES,
+    CONF_UNREADABLE_REGISTERS,
     CONF_VALUE_TYPE,
 )
 
@@ -106,6 +115,18 @@ CONFIG_SCHEMA = cv.All(
                 CONF_COMMAND_THROTTLE, default="0ms"
             ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_OFFLINE_SKIP_UPDATES, default=0): cv.positive_int,
+            cv.Optional(CONF_BRIDGE_REGISTER_GAPS, default=False): cv.boolean,
+            cv.Optional(CONF_UNREADABLE_REGISTERS, default=[]): cv.ensure_list(
+                cv.Schema(
+                    {
+                        cv.Required(CONF_REGISTER_TYPE): cv.enum(MODBUS_REGISTER_TYPE),
+                        cv.Required(CONF_ADDRESS): cv.positive_int,
+                        cv.Optional(CONF_COUNT, default=1): cv.int_range(
+                            min=1, max=65535
+                        ),
+                    }
+                )
+            ),
         }
     )
     .extend(cv.polling_component_schema("60s"))
@@ -211,6 +232,13 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     cg.add(var.set_command_throttle(config[CONF_COMMAND_THROTTLE]))
     cg.add(var.set_offline_skip_updates(config[CONF_OFFLINE_SKIP_UPDATES]))
+    cg.add(var.set_bridge_register_gaps(config[CONF_BRIDGE_REGISTER_GAPS]))
+    for conf in config[CONF_UNREADABLE_REGISTERS]:
+        cg.add(
+            var.add_unreadable_registers(
+                conf[CONF_REGISTER_TYPE], conf[CONF_ADDRESS], conf[CONF_COUNT]
+            )
+        )
     await register_modbus_device(var, config)
 
 
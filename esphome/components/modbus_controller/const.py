@@ -1,4 +1,5 @@
 CONF_BITMASK = "bitmask"
+CONF_BRIDGE_REGISTER_GAPS = "bridge_register_gaps"
 CONF_BYTE_OFFSET = "byte_offset"
 CONF_COMMAND_THROTTLE = "command_throttle"
 CONF_OFFLINE_SKIP_UPDATES = "offline_skip_updates"
@@ -11,6 +12,7 @@ CONF_REGISTER_COUNT = "register_count"
 CONF_REGISTER_TYPE = "register_type"
 CONF_RESPONSE_SIZE = "response_size"
 CONF_SKIP_UPDATES = "skip_updates"
+CONF_UNREADABLE_REGISTERS = "unreadable_registers"
 CONF_USE_WRITE_MULTIPLE = "use_write_multiple"
 CONF_VALUE_TYPE = "value_type"
 CONF_WRITE_LAMBDA = "write_lambda"
@@ -6,6 +6,8 @@ namespace esphome {
 namespace modbus_controller {
 
 static const char *const TAG = "modbus_controller";
+/// upper limit for the deadline of read commands, keeps deadlines comparable if the update interval is "never"
+static const uint32_t MAX_READ_DEADLINE_MS = 24 * 60 * 60 * 1000;
 
 void ModbusController::setup() {
   // Modbus::setup();
@@ -56,6 +58,20 @@ bool ModbusController::send_next_command_() {
   return (!command_queue_.empty());
 }
 
+bool ModbusController::get_pending_command(modbus::ModbusCommandPriority &priority, uint32_t &deadline) {
+  // responses are processed before the next command is sent
+  if (this->command_queue_.empty() || !this->incoming_queue_.empty())
+    return false;
+  if (millis() - this->last_command_timestamp_ <= this->command_throttle_)
+    return false;
+  const auto &command = this->command_queue_.front();
+  priority = command->get_priority();
+  deadline = command->deadline;
+  return true;
+}
+
+void ModbusController::send_pending_command() { this->send_next_command_(); }
+
 // Queue incoming response
 void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
   auto &current_command = this->command_queue_.front();
@@ -140,7 +156,20 @@ void ModbusController::queue_command(const ModbusCommandItem &command) {
       return;
     }
   }
-  command_queue_.push_back(make_unique<ModbusCommandItem>(command));
+  auto item = make_unique<ModbusCommandItem>(command);
+  if (item->get_priority() == modbus::MODBUS_PRIORITY_WRITE) {
+    item->deadline = millis();
+    // writes go ahead of reads that haven't been sent yet, the front command may still wait for its response
+    auto is_unsent_read = [](const std::unique_ptr<ModbusCommandItem> &queued) {
+      return queued->send_countdown == ModbusCommandItem::MAX_SEND_REPEATS &&
+             queued->get_priority() == modbus::MODBUS_PRIORITY_READ;
+    };
+    command_queue_.insert(std::find_if(command_queue_.begin(), command_queue_.end(), is_unsent_read), std::move(item));
+  } else {
+    // reads should complete before the next update queues them again
+    item->deadline = millis() + std::min<uint32_t>(this->get_update_interval(), MAX_READ_DEADLINE_MS);
+    command_queue_.push_back(std::move(item));
+  }
 }
 
 void ModbusController::update_range_(RegisterRange &r) {
@@ -187,9 +216,52 @@ void ModbusController::update() {
   }
 }
 
+bool ModbusController::fits_range_(const RegisterRange &r, const SensorItem *curr, uint16_t gap,
+                                   uint8_t buffer_offset) const {
+  bool is_bit = modbus_register_is_bit(r.register_type);
+  uint16_t max_count = is_bit ? MODBUS_MAX_READ_BITS : MODBUS_MAX_READ_REGISTERS;
+  if (r.register_count + gap + curr->register_count > max_count)
+    return false;
+  // the offset of the sensor into the response has to fit into its 8 bit offset
+  uint16_t gap_size = is_bit ? gap : gap * 2;
+  return buffer_offset + gap_size + curr->offset <= UINT8_MAX;
+}
+
+bool ModbusController::can_bridge_gap_(const RegisterRange &r, const SensorItem *curr, uint8_t buffer_offset) const {
+  uint16_t range_end = r.start_address + r.register_count;
+  if (!this->bridge_register_gaps_ || curr->start_address <= range_end)
+    return false;
+  uint16_t gap = curr->start_address - range_end;
+
+  // bytes the unused registers add to the response, compared to the overhead of a separate read command
+  uint16_t gap_bytes;
+  if (modbus_register_is_bit(r.register_type)) {
+    gap_bytes = (r.register_count + gap + 7) / 8 - (r.register_count + 7) / 8;
+  } else {
+    gap_bytes = gap * 2;
+  }
+  if (gap_bytes >= MODBUS_READ_OVERHEAD_BYTES || !this->fits_range_(r, curr, gap, buffer_offset))
+    return false;
+
+  // the size of the gap is only known if all items use the default response size
+  if (curr->response_bytes != 0)
+    return false;
+  for (auto *item : r.sensors) {
+    if (item->response_bytes != 0)
+      return false;
+  }
+  for (const auto &hole : this->unreadable_registers_) {
+    if (hole.register_type == r.register_type && hole.start_address < curr->start_address &&
+        range_end < hole.start_address + hole.register_count)
+      return false;
+  }
+  return true;
+}
+
 // walk through the sensors and determine the register ranges to read
 size_t ModbusController::create_register_ranges_() {
   register_ranges_.clear();
+  this->bridged_registers_ = 0;
   if (sensorset_.empty()) {
     ESP_LOGW(TAG, "No sensors registered");
     return 0;
@@ -238,7 +310,8 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
-        } else if (curr->start_address == (r.start_address + r.register_count)) {
+        } else if (curr->start_address == (r.start_address + r.register_count) &&
+                   this->fits_range_(r, curr, 0, buffer_offset)) {
           // this register can extend the current range
 
           // remove this sensore because start_address is changed (sort-order)
@@ -255,6 +328,26 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Extend range - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
+        } else if (this->can_bridge_gap_(r, curr, buffer_offset)) {
+          // reading the unused registers in front of this register is cheaper than a new read command
+          uint16_t gap = curr->start_address - (r.start_address + r.register_count);
+
+          // remove this sensore because start_address is changed (sort-order)
+          ix = sensorset_.erase(ix);
+
+          curr->start_address = r.start_address;
+          buffer_offset += modbus_register_is_bit(r.register_type) ? gap : gap * 2;
+          curr->offset += buffer_offset;
+          buffer_offset += curr->get_register_size();
+          r.register_count += gap + curr->register_count;
+          this->bridged_registers_ += gap;
+
+          sensorset_.insert(curr);
+          // move iterator backwards because it will be incremented later
+          ix--;
+
+          ESP_LOGV(TAG, "Bridge %u registers - change to register: 0x%X %d offset=%u", gap, curr->start_address,
+                   curr->register_count, curr->offset);
         }
       }
     }
@@ -297,6 +390,10 @@ size_t ModbusController::create_register_ranges_() {
 void ModbusController::dump_config() {
   ESP_LOGCONFIG(TAG, "ModbusController:");
   ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
+  ESP_LOGCONFIG(TAG, "  Read Commands per Update: %zu", this->register_ranges_.size());
+  if (this->bridge_register_gaps_) {
+    ESP_LOGCONFIG(TAG, "  Unused Registers Read: %u", this->bridged_registers_);
+  }
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
   ESP_LOGCONFIG(TAG, "sensormap");
   for (auto &it : sensorset_) {
@@ -319,11 +416,8 @@ void ModbusController::loop() {
     if (message != nullptr)
       process_modbus_data_(message.get());
     incoming_queue_.pop();
-
-  } else {
-    // all messages processed send pending commands
-    send_next_command_();
   }
+  // pending commands are sent when the bus grants this device the line, see send_pending_command()
 }
 
 void ModbusController::on_write_register_response(ModbusRegisterType register_type, uint16_t start_address,
@@ -511,6 +605,18 @@ bool ModbusCommandItem::send() {
   return true;
 }
 
+modbus::ModbusCommandPriority ModbusCommandItem::get_priority() const {
+  switch (this->function_code) {
+    case ModbusFunctionCode::WRITE_SINGLE_COIL:
+    case ModbusFunctionCode::WRITE_SINGLE_REGISTER:
+    case ModbusFunctionCode::WRITE_MULTIPLE_COILS:
+    case ModbusFunctionCode::WRITE_MULTIPLE_REGISTERS:
+      return modbus::MODBUS_PRIORITY_WRITE;
+    default:
+      return modbus::MODBUS_PRIORITY_READ;
+  }
+}
+
 bool ModbusCommandItem::is_equal(const ModbusCommandItem &other) {
   // for custom commands we have to check for identical payloads, since
   // address/count/type fields will be set to zero
@@ -81,6 +81,10 @@ inline ModbusFunctionCode modbus_register_read_function(ModbusRegisterType reg_t
       break;
   }
 }
+/// Coils and discrete inputs are read as bits, the other register types as 16 bit words
+inline bool modbus_register_is_bit(ModbusRegisterType reg_type) {
+  return reg_type == ModbusRegisterType::COIL || reg_type == ModbusRegisterType::DISCRETE_INPUT;
+}
 inline ModbusFunctionCode modbus_register_write_function(ModbusRegisterType reg_type) {
   switch (reg_type) {
     case ModbusRegisterType::COIL:
@@ -287,12 +291,26 @@ using SensorSet = std::set<SensorItem *, SensorItemsComparator>;
 struct RegisterRange {
   uint16_t start_address;
   ModbusRegisterType register_type;
-  uint8_t register_count;
+  uint16_t register_count;
   uint16_t skip_updates;          // the config value
   SensorSet sensors;              // all sensors of this range
   uint16_t skip_updates_counter;  // the running value
 };
 
+/// Registers the device declared as not readable, read commands never span them.
+struct UnreadableRegisters {
+  ModbusRegisterType register_type;
+  uint16_t start_address;
+  uint16_t register_count;
+};
+
+/// Most registers a single read command may request (function codes 3 and 4).
+static const uint16_t MODBUS_MAX_READ_REGISTERS = 125;
+/// Most coils or discrete inputs per read command, limited by the 8 bit offsets of the sensor items.
+static const uint16_t MODBUS_MAX_READ_BITS = 255;
+/// Bus time of an additional read command in bytes: request frame, response header and CRC and the silent intervals.
+static const uint16_t MODBUS_READ_OVERHEAD_BYTES = 20;
+
 class ModbusCommandItem {
  public:
   static const size_t MAX_PAYLOAD_BYTES = 240;
@@ -309,6 +327,10 @@ class ModbusCommandItem {
   // wrong commands (esp. custom commands) can block the send queue
   // limit the number of repeats
   uint8_t send_countdown{MAX_SEND_REPEATS};
+  /// millis() timestamp the command should be sent by, used by the bus to order the commands of all devices
+  uint32_t deadline{0};
+  /// write commands are sent before pending reads
+  modbus::ModbusCommandPriority get_priority() const;
   /// factory methods
   /** Create modbus read command
    *  Function code 02-04
@@ -422,6 +444,10 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void on_modbus_data(const std::vector<uint8_t> &data) override;
   /// called when a modbus error response was received
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
+  /// called by the bus to ask for the priority and deadline of the next queued command
+  bool get_pending_command(modbus::ModbusCommandPriority &priority, uint32_t &deadline) override;
+  /// called by the bus when the next queued command may be sent
+  void send_pending_command() override;
   /// default delegate called by process_modbus_data when a response has retrieved from the incoming queue
   void on_register_data(ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data);
   /// default delegate called by process_modbus_data when a response for a write response has retrieved from the
@@ -432,6 +458,14 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void set_command_throttle(uint16_t command_throttle) { this->command_throttle_ = command_throttle; }
   /// called by esphome generated code to set the offline_skip_updates
   void set_offline_skip_updates(uint16_t offline_skip_updates) { this->offline_skip_updates_ = offline_skip_updates; }
+  /// Read unused registers between sensors when that is cheaper than an additional read command
+  void set_bridge_register_gaps(bool bridge_register_gaps) { this->bridge_register_gaps_ = bridge_register_gaps; }
+  /// Declare registers that must not be read, gaps are never bridged across them
+  void add_unreadable_registers(ModbusRegisterType register_type, uint16_t start_address, uint16_t register_count) {
+    this->unreadable_registers_.push_back(UnreadableRegisters{register_type, start_address, register_count});
+  }
+  /// get the number of read commands sent for each update (without skipped updates)
+  size_t get_read_commands_per_update() const { return this->register_ranges_.size(); }
   /// get the number of queued modbus commands (should be mostly empty)
   size_t get_command_queue_length() { return command_queue_.size(); }
   /// get if the module is offline, didn't respond the last command
@@ -440,6 +474,10 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
  protected:
   /// parse sensormap_ and create range of sequential addresses
   size_t create_register_ranges_();
+  /// check if the sensor can be added to the range by also reading the unused registers in front of it
+  bool can_bridge_gap_(const RegisterRange &r, const SensorItem *curr, uint8_t buffer_offset) const;
+  /// check if the sensor fits into the range without exceeding the limits of a single read command
+  bool fits_range_(const RegisterRange &r, const SensorItem *curr, uint16_t gap, uint8_t buffer_offset) const;
   // find register in sensormap. Returns iterator with all registers having the same start address
   SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
   /// submit the read command for the address range to the send queue
@@ -466,6 +504,12 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   bool module_offline_;
   /// how many updates to skip if module is offline
   uint16_t offline_skip_updates_;
+  /// read unused registers between sensors if cheaper than a new command
+  bool bridge_register_gaps_{false};
+  /// registers that are never read when bridging gaps
+  std::vector<UnreadableRegisters> unreadable_registers_;
+  /// number of unused registers read because of bridged gaps
+  uint16_t bridged_registers_{0};
 };
 
 /** Convert vector<uint8_t> response payload to float.
@@ -15,7 +15,7 @@ std::string MQTTBinarySensorComponent::component_type() const { return "binary_s
 const EntityBase *MQTTBinarySensorComponent::get_entity() const { return this->binary_sensor_; }
 
 void MQTTBinarySensorComponent::setup() {
-  this->binary_sensor_->add_on_state_callback([this](bool state) { this->publish_state(state); });
+  this->publish_on_entity_change_(ENTITY_TYPE_BINARY_SENSOR);
 }
 
 void MQTTBinarySensorComponent::dump_config() {
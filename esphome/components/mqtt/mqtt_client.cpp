@@ -53,6 +53,8 @@ void MQTTClientComponent::setup() {
     this->state_ = MQTT_CLIENT_DISCONNECTED;
     this->disconnect_reason_ = reason;
   });
+  this->entity_subscriber_ = global_entity_change_bus.subscribe(
+      [this](EntityType type, uint16_t index) { this->on_entity_change_(type, index); });
 #ifdef USE_LOGGER
   if (this->is_log_message_enabled() && logger::global_logger != nullptr) {
     logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
@@ -285,6 +287,8 @@ void MQTTClientComponent::check_connected() {
 void MQTTClientComponent::loop() {
   // Call the backend loop first
   mqtt_backend_.loop();
+  // several changes of an entity since the last loop are published once, with the latest state
+  global_entity_change_bus.drain(this->entity_subscriber_);
 
   if (this->disconnect_reason_.has_value()) {
     const LogString *reason_s;
@@ -563,6 +567,19 @@ void MQTTClientComponent::disable_log_message() { this->log_message_.topic = "";
 bool MQTTClientComponent::is_log_message_enabled() const { return !this->log_message_.topic.empty(); }
 void MQTTClientComponent::set_reboot_timeout(uint32_t reboot_timeout) { this->reboot_timeout_ = reboot_timeout; }
 void MQTTClientComponent::register_mqtt_component(MQTTComponent *component) { this->children_.push_back(component); }
+void MQTTClientComponent::register_entity_component(EntityType type, uint16_t index, MQTTComponent *component) {
+  if (index == ENTITY_INDEX_UNREGISTERED)
+    return;
+  auto &components = this->entity_components_[type];
+  if (components.size() <= index)
+    components.resize(index + 1, nullptr);
+  components[index] = component;
+}
+void MQTTClientComponent::on_entity_change_(EntityType type, uint16_t index) {
+  const auto &components = this->entity_components_[type];
+  if (index < components.size() && components[index] != nullptr)
+    components[index]->send_initial_state();
+}
 void MQTTClientComponent::set_log_level(int level) { this->log_level_ = level; }
 void MQTTClientComponent::set_keep_alive(uint16_t keep_alive_s) { this->mqtt_backend_.set_keep_alive(keep_alive_s); }
 void MQTTClientComponent::set_log_message_template(MQTTMessage &&message) { this->log_message_ = std::move(message); }
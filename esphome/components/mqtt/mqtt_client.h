@@ -6,6 +6,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 #include "esphome/components/json/json_util.h"
 #include "esphome/components/network/ip_address.h"
@@ -241,6 +242,8 @@ class MQTTClientComponent : public Component {
   void set_reboot_timeout(uint32_t reboot_timeout);
 
   void register_mqtt_component(MQTTComponent *component);
+  /// Publishes the state of the component whenever the entity with the given type and index changed.
+  void register_entity_component(EntityType type, uint16_t index, MQTTComponent *component);
 
   bool is_connected();
 
@@ -274,6 +277,8 @@ class MQTTClientComponent : public Component {
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
 
+  void on_entity_change_(EntityType type, uint16_t index);
+
   MQTTCredentials credentials_;
   /// The last will message. Disabled optional denotes it being default and
   /// an empty topic denotes the the feature being disabled.
@@ -313,6 +318,9 @@ class MQTTClientComponent : public Component {
   bool dns_resolved_{false};
   bool dns_resolve_error_{false};
   std::vector<MQTTComponent *> children_;
+  /// The component of every entity that publishes its state, by entity type and index.
+  std::vector<MQTTComponent *> entity_components_[ENTITY_TYPE_COUNT];
+  uint8_t entity_subscriber_{0};
   uint32_t reboot_timeout_{300000};
   uint32_t connect_begin_;
   uint32_t last_connected_{0};
@@ -245,7 +245,7 @@ void MQTTClimateComponent::setup() {
     });
   }
 
-  this->device_->add_on_state_callback([this](Climate & /*unused*/) { this->publish_state_(); });
+  this->publish_on_entity_change_(ENTITY_TYPE_CLIMATE);
 }
 MQTTClimateComponent::MQTTClimateComponent(Climate *device) : device_(device) {}
 bool MQTTClimateComponent::send_initial_state() { return this->publish_state_(); }
@@ -198,6 +198,9 @@ void MQTTComponent::set_availability(std::string topic, std::string payload_avai
   this->availability_->payload_not_available = std::move(payload_not_available);
 }
 void MQTTComponent::disable_availability() { this->set_availability("", "", ""); }
+void MQTTComponent::publish_on_entity_change_(EntityType type) {
+  global_mqtt_client->register_entity_component(type, this->get_entity()->get_entity_index(), this);
+}
 void MQTTComponent::call_setup() {
   if (this->is_internal())
     return;
@@ -157,6 +157,9 @@ class MQTTComponent : public Component {
    */
   virtual const EntityBase *get_entity() const = 0;
 
+  /// Publish the state from send_initial_state() whenever the entity changed, call from setup().
+  void publish_on_entity_change_(EntityType type);
+
   /** A unique ID for this MQTT component, empty for no unique id. See unique ID requirements:
    * https://developers.home-assistant.io/docs/en/entity_registry_index.html#unique-id-requirements
    *
@@ -16,7 +16,7 @@ using namespace esphome::cover;
 MQTTCoverComponent::MQTTCoverComponent(Cover *cover) : cover_(cover) {}
 void MQTTCoverComponent::setup() {
   auto traits = this->cover_->get_traits();
-  this->cover_->add_on_state_callback([this]() { this->publish_state(); });
+  this->publish_on_entity_change_(ENTITY_TYPE_COVER);
   this->subscribe(this->get_command_topic_(), [this](const std::string &topic, const std::string &payload) {
     auto call = this->cover_->make_call();
     call.set_command(payload.c_str());
@@ -87,8 +87,7 @@ void MQTTFanComponent::setup() {
                     });
   }
 
-  auto f = std::bind(&MQTTFanComponent::publish_state, this);
-  this->state_->add_on_state_callback([this, f]() { this->defer("send", f); });
+  this->publish_on_entity_change_(ENTITY_TYPE_FAN);
 }
 
 void MQTTFanComponent::dump_config() {
@@ -28,7 +28,7 @@ void MQTTLockComponent::setup() {
       this->status_momentary_warning("state", 5000);
     }
   });
-  this->lock_->add_on_state_callback([this]() { this->defer("send", [this]() { this->publish_state(); }); });
+  this->publish_on_entity_change_(ENTITY_TYPE_LOCK);
 }
 void MQTTLockComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "MQTT Lock '%s': ", this->lock_->get_name().c_str());
@@ -26,7 +26,7 @@ void MQTTNumberComponent::setup() {
     call.set_value(*val);
     call.perform();
   });
-  this->number_->add_on_state_callback([this](float state) { this->publish_state(state); });
+  this->publish_on_entity_change_(ENTITY_TYPE_NUMBER);
 }
 
 void MQTTNumberComponent::dump_config() {
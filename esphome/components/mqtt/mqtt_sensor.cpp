@@ -21,7 +21,7 @@ using namespace esphome::sensor;
 MQTTSensorComponent::MQTTSensorComponent(Sensor *sensor) : sensor_(sensor) {}
 
 void MQTTSensorComponent::setup() {
-  this->sensor_->add_on_state_callback([this](float state) { this->publish_state(state); });
+  this->publish_on_entity_change_(ENTITY_TYPE_SENSOR);
 }
 
 void MQTTSensorComponent::dump_config() {
@@ -34,8 +34,7 @@ void MQTTSwitchComponent::setup() {
         break;
     }
   });
-  this->switch_->add_on_state_callback(
-      [this](bool enabled) { this->defer("send", [this, enabled]() { this->publish_state(enabled); }); });
+  this->publish_on_entity_change_(ENTITY_TYPE_SWITCH);
 }
 void MQTTSwitchComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "MQTT Switch '%s': ", this->switch_->get_name().c_str());
@@ -22,7 +22,7 @@ void MQTTTextComponent::setup() {
     call.perform();
   });
 
-  this->text_->add_on_state_callback([this](const std::string &state) { this->publish_state(state); });
+  this->publish_on_entity_change_(ENTITY_TYPE_TEXT);
 }
 
 void MQTTTextComponent::dump_config() {
@@ -16,7 +16,7 @@ void MQTTTextSensor::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &
   config.command_topic = false;
 }
 void MQTTTextSensor::setup() {
-  this->sensor_->add_on_state_callback([this](const std::string &state) { this->publish_state(state); });
+  this->publish_on_entity_change_(ENTITY_TYPE_TEXT_SENSOR);
 }
 
 void MQTTTextSensor::dump_config() {
@@ -121,6 +121,16 @@ class NeoPixelRGBLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_COL
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                nullptr, this->effect_data_ + index, &this->correction_);
   }
+  bool get_pixel_layout_(light::AddressablePixelLayout &layout) const override {  // NOLINT
+    layout.pixels = this->controller_->Pixels();
+    layout.stride = 3;
+    layout.offsets[0] = this->rgb_offsets_[0];
+    layout.offsets[1] = this->rgb_offsets_[1];
+    layout.offsets[2] = this->rgb_offsets_[2];
+    layout.offsets[3] = this->rgb_offsets_[3];
+    layout.has_white = false;
+    return true;
+  }
 };
 
 template<typename T_METHOD, typename T_COLOR_FEATURE = NeoRgbwFeature>
@@ -138,6 +148,16 @@ class NeoPixelRGBWLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_CO
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                base + this->rgb_offsets_[3], this->effect_data_ + index, &this->correction_);
   }
+  bool get_pixel_layout_(light::AddressablePixelLayout &layout) const override {  // NOLINT
+    layout.pixels = this->controller_->Pixels();
+    layout.stride = 4;
+    layout.offsets[0] = this->rgb_offsets_[0];
+    layout.offsets[1] = this->rgb_offsets_[1];
+    layout.offsets[2] = this->rgb_offsets_[2];
+    layout.offsets[3] = this->rgb_offsets_[3];
+    layout.has_white = true;
+    return true;
+  }
 };
 
 }  // namespace neopixelbus
@@ -23,6 +23,7 @@ from .base_component import (
     CONF_START_UP_PAGE,
     CONF_AUTO_WAKE_ON_TOUCH,
     CONF_EXIT_REPARSE_ON_START,
+    CONF_MAX_COMMANDS_IN_FLIGHT,
 )
 
 CODEOWNERS = ["@senexcrenshaw"]
@@ -72,6 +73,9 @@ CONFIG_SCHEMA = (
             cv.Optional(CONF_START_UP_PAGE): cv.positive_int,
             cv.Optional(CONF_AUTO_WAKE_ON_TOUCH, default=True): cv.boolean,
             cv.Optional(CONF_EXIT_REPARSE_ON_START, default=False): cv.boolean,
+            cv.Optional(CONF_MAX_COMMANDS_IN_FLIGHT, default=0): cv.int_range(
+                min=0, max=255
+            ),
         }
     )
     .extend(cv.polling_component_schema("5s"))
@@ -118,6 +122,8 @@ async def to_code(config):
 
     cg.add(var.set_exit_reparse_on_start_internal(config[CONF_EXIT_REPARSE_ON_START]))
 
+    cg.add(var.set_max_commands_in_flight(config[CONF_MAX_COMMANDS_IN_FLIGHT]))
+
     await display.register_display(var, config)
 
     for conf in config.get(CONF_ON_SETUP, []):
@@ -2,12 +2,15 @@
 #include "esphome/core/util.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include <algorithm>
 #include <cinttypes>
 
 namespace esphome {
 namespace nextion {
 
 static const char *const TAG = "nextion";
+/// Queue entries kept for reuse, more are freed
+static const size_t MAX_POOLED_QUEUE_ENTRIES = 16;
 
 void Nextion::setup() {
   this->is_setup_ = false;
@@ -74,7 +77,7 @@ bool Nextion::check_connect_() {
 #ifdef NEXTION_PROTOCOL_LOG
     ESP_LOGN(TAG, "Bad connect request %s", response.c_str());
     for (size_t i = 0; i < response.length(); i++) {
-      ESP_LOGN(TAG, "response %s %d %d %c", response.c_str(), i, response[i], response[i]);
+      ESP_LOGN(TAG, "response %s %zu %d %c", response.c_str(), i, response[i], response[i]);
     }
 #endif
 
@@ -120,8 +123,13 @@ void Nextion::reset_(bool reset_nextion) {
   while (this->available()) {  // Clear receive buffer
     this->read_byte(&d);
   };
+  for (auto *entry : this->nextion_queue_)
+    this->release_queue_entry_(entry);
   this->nextion_queue_.clear();
+  for (auto *entry : this->waveform_queue_)
+    this->release_queue_entry_(entry);
   this->waveform_queue_.clear();
+  this->pending_commands_.clear();
 }
 
 void Nextion::dump_config() {
@@ -144,6 +152,10 @@ void Nextion::dump_config() {
   if (this->start_up_page_ != -1) {
     ESP_LOGCONFIG(TAG, "  Start Up Page:    %d", this->start_up_page_);
   }
+
+  if (this->max_commands_in_flight_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Max In Flight:    %u", this->max_commands_in_flight_);
+  }
 }
 
 float Nextion::get_setup_priority() const { return setup_priority::DATA; }
@@ -154,6 +166,8 @@ void Nextion::update() {
   if (this->writer_.has_value()) {
     (*this->writer_)(*this);
   }
+  ESP_LOGV(TAG, "Queue: %zu unacknowledged, %zu waiting (max %zu), %" PRIu32 " superseded", this->nextion_queue_.size(),
+           this->pending_commands_.size(), this->max_pending_commands_, this->superseded_commands_);
 }
 
 void Nextion::add_sleep_state_callback(std::function<void()> &&callback) {
@@ -267,6 +281,7 @@ void Nextion::loop() {
 
   this->process_serial_();            // Receive serial data
   this->process_nextion_commands_();  // Process nextion return commands
+  this->send_pending_commands_();     // Use the slots freed by acknowledged commands
 
   if (!this->nextion_reports_is_setup_) {
     if (this->started_ms_ == 0)
@@ -296,9 +311,8 @@ bool Nextion::remove_from_q_(bool report_empty) {
     if (component->get_variable_name() == "sleep_wake") {
       this->is_sleeping_ = false;
     }
-    delete component;  // NOLINT(cppcoreguidelines-owning-memory)
   }
-  delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+  this->release_queue_entry_(nb);
   this->nextion_queue_.pop_front();
   return true;
 }
@@ -320,7 +334,7 @@ void Nextion::process_nextion_commands_() {
   size_t to_process_length = 0;
   std::string to_process;
 
-  ESP_LOGN(TAG, "this->command_data_ %s length %d", this->command_data_.c_str(), this->command_data_.length());
+  ESP_LOGN(TAG, "this->command_data_ %s length %zu", this->command_data_.c_str(), this->command_data_.length());
 #ifdef NEXTION_PROTOCOL_LOG
   this->print_queue_members_();
 #endif
@@ -397,7 +411,7 @@ void Nextion::process_nextion_commands_() {
           ESP_LOGN(TAG, "Removing waveform from queue with component id %d and waveform id %d",
                    component->get_component_id(), component->get_wave_channel_id());
 
-          delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+          this->release_queue_entry_(nb);
           this->waveform_queue_.pop_front();
         }
         break;
@@ -509,7 +523,7 @@ void Nextion::process_nextion_commands_() {
           component->set_state_from_string(to_process, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(nb);
         this->nextion_queue_.pop_front();
 
         break;
@@ -555,7 +569,7 @@ void Nextion::process_nextion_commands_() {
           component->set_state_from_int(value, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(nb);
         this->nextion_queue_.pop_front();
 
         break;
@@ -597,7 +611,7 @@ void Nextion::process_nextion_commands_() {
         auto index = to_process.find('\0');
         if (index == std::string::npos || (to_process_length - index - 1) < 1) {
           ESP_LOGE(TAG, "Bad switch component data received for 0x90 event!");
-          ESP_LOGN(TAG, "to_process %s %zu %d", to_process.c_str(), to_process_length, index);
+          ESP_LOGN(TAG, "to_process %s %zu %zu", to_process.c_str(), to_process_length, index);
           break;
         }
 
@@ -625,7 +639,7 @@ void Nextion::process_nextion_commands_() {
         auto index = to_process.find('\0');
         if (index == std::string::npos || (to_process_length - index - 1) != 4) {
           ESP_LOGE(TAG, "Bad sensor component data received for 0x91 event!");
-          ESP_LOGN(TAG, "to_process %s %zu %d", to_process.c_str(), to_process_length, index);
+          ESP_LOGN(TAG, "to_process %s %zu %zu", to_process.c_str(), to_process_length, index);
           break;
         }
 
@@ -662,7 +676,7 @@ void Nextion::process_nextion_commands_() {
         auto index = to_process.find('\0');
         if (index == std::string::npos || (to_process_length - index - 1) < 1) {
           ESP_LOGE(TAG, "Bad text sensor component data received for 0x92 event!");
-          ESP_LOGN(TAG, "to_process %s %zu %d", to_process.c_str(), to_process_length, index);
+          ESP_LOGN(TAG, "to_process %s %zu %zu", to_process.c_str(), to_process_length, index);
           break;
         }
 
@@ -697,7 +711,7 @@ void Nextion::process_nextion_commands_() {
         auto index = to_process.find('\0');
         if (index == std::string::npos || (to_process_length - index - 1) < 1) {
           ESP_LOGE(TAG, "Bad binary sensor component data received for 0x92 event!");
-          ESP_LOGN(TAG, "to_process %s %zu %d", to_process.c_str(), to_process_length, index);
+          ESP_LOGN(TAG, "to_process %s %zu %zu", to_process.c_str(), to_process_length, index);
           break;
         }
 
@@ -736,7 +750,7 @@ void Nextion::process_nextion_commands_() {
                  component->get_component_id(), component->get_wave_channel_id(), buffer_to_send);
 
         component->clear_wave_buffer(buffer_to_send);
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(nb);
         this->waveform_queue_.pop_front();
         break;
       }
@@ -773,10 +787,9 @@ void Nextion::process_nextion_commands_() {
           if (component->get_variable_name() == "sleep_wake") {
             this->is_sleeping_ = false;
           }
-          delete component;  // NOLINT(cppcoreguidelines-owning-memory)
         }
 
-        delete this->nextion_queue_[i];  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(this->nextion_queue_[i]);
 
         this->nextion_queue_.erase(this->nextion_queue_.begin() + i);
         i--;
@@ -942,11 +955,7 @@ uint16_t Nextion::recv_ret_string_(std::string &response, uint32_t timeout, bool
  * @param variable_name Name for the queue
  */
 void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion_queue->component = new nextion::NextionComponentBase;
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_(true);
   nextion_queue->component->set_variable_name(variable_name);
 
   nextion_queue->queue_time = millis();
@@ -966,11 +975,89 @@ void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_n
   if ((!this->is_setup() && !this->ignore_is_setup_) || command.empty())
     return;
 
+  // during setup the commands aren't acknowledged reliably yet, so they are never held back
+  if (this->max_commands_in_flight_ != 0 && this->is_setup() && !this->ignore_is_setup_) {
+    this->add_pending_command_(variable_name, command);
+    this->send_pending_commands_();
+    return;
+  }
+
   if (this->send_command_(command)) {
     this->add_no_result_to_queue_(variable_name);
   }
 }
 
+void Nextion::add_pending_command_(const std::string &variable_name, const std::string &command) {
+  // only plain assignments like `t0.txt="abc"` or `dim=50` can be replaced by a newer command
+  std::string key;
+  size_t assign = command.find('=');
+  if (assign != std::string::npos && assign > 0 && command.find_first_of(" \"", 0) > assign)
+    key = command.substr(0, assign);
+
+  if (!key.empty()) {
+    // search back to the last command that can't be replaced, an older assignment must stay in front of it
+    for (auto it = this->pending_commands_.rbegin(); it != this->pending_commands_.rend() && !it->key.empty(); ++it) {
+      if (it->key == key) {
+        ESP_LOGN(TAG, "Replacing waiting command %s", it->command.c_str());
+        it->variable_name = variable_name;
+        it->command = command;
+        this->superseded_commands_++;
+        return;
+      }
+    }
+  }
+
+  this->pending_commands_.push_back(NextionPendingCommand{variable_name, std::move(key), command});
+  this->max_pending_commands_ = std::max(this->max_pending_commands_, this->pending_commands_.size());
+}
+
+void Nextion::send_pending_commands_() {
+  while (!this->pending_commands_.empty() && this->nextion_queue_.size() < this->max_commands_in_flight_) {
+    auto &pending = this->pending_commands_.front();
+    if (this->send_command_(pending.command))
+      this->add_no_result_to_queue_(pending.variable_name);
+    this->pending_commands_.pop_front();
+  }
+}
+
+NextionQueue *Nextion::acquire_queue_entry_(bool no_result) {
+  NextionQueue *entry;
+  if (this->queue_entry_pool_.empty()) {
+    entry = new nextion::NextionQueue;  // NOLINT(cppcoreguidelines-owning-memory)
+  } else {
+    entry = this->queue_entry_pool_.back();
+    this->queue_entry_pool_.pop_back();
+  }
+  entry->component = nullptr;
+  if (no_result) {
+    if (this->no_result_component_pool_.empty()) {
+      entry->component = new nextion::NextionComponentBase;  // NOLINT(cppcoreguidelines-owning-memory)
+    } else {
+      entry->component = this->no_result_component_pool_.back();
+      this->no_result_component_pool_.pop_back();
+    }
+  }
+  entry->queue_time = 0;
+  return entry;
+}
+
+void Nextion::release_queue_entry_(NextionQueue *entry) {
+  // components of NO_RESULT entries are owned by the entry, all others belong to the sensors
+  NextionComponentBase *component = entry->component;
+  if (component != nullptr && component->get_queue_type() == NextionQueueType::NO_RESULT) {
+    if (this->no_result_component_pool_.size() < MAX_POOLED_QUEUE_ENTRIES) {
+      this->no_result_component_pool_.push_back(component);
+    } else {
+      delete component;  // NOLINT(cppcoreguidelines-owning-memory)
+    }
+  }
+  if (this->queue_entry_pool_.size() < MAX_POOLED_QUEUE_ENTRIES) {
+    this->queue_entry_pool_.push_back(entry);
+  } else {
+    delete entry;  // NOLINT(cppcoreguidelines-owning-memory)
+  }
+}
+
 bool Nextion::add_no_result_to_queue_with_ignore_sleep_printf_(const std::string &variable_name, const char *format,
                                                                ...) {
   if ((!this->is_setup() && !this->ignore_is_setup_))
@@ -1076,8 +1163,7 @@ void Nextion::add_to_get_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->ignore_is_setup_))
     return;
 
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_(false);
 
   nextion_queue->component = component;
   nextion_queue->queue_time = millis();
@@ -1089,6 +1175,8 @@ void Nextion::add_to_get_queue(NextionComponentBase *component) {
 
   if (this->send_command_(command)) {
     this->nextion_queue_.push_back(nextion_queue);
+  } else {
+    this->release_queue_entry_(nextion_queue);
   }
 }
 
@@ -1104,8 +1192,7 @@ void Nextion::add_addt_command_to_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || this->is_sleeping())
     return;
 
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_(false);
 
   nextion_queue->component = component;
   nextion_queue->queue_time = millis();
@@ -1127,7 +1214,7 @@ void Nextion::check_pending_waveform_() {
   std::string command = "addt " + to_string(component->get_component_id()) + "," +
                         to_string(component->get_wave_channel_id()) + "," + to_string(buffer_to_send);
   if (!this->send_command_(command)) {
-    delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+    this->release_queue_entry_(nb);
     this->waveform_queue_.pop_front();
   }
 }
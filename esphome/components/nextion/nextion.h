@@ -1019,6 +1019,26 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    */
   size_t queue_size() { return this->nextion_queue_.size(); }
 
+  /**
+   * @brief Limits the number of commands sent to the display that have not been acknowledged yet.
+   *
+   * Further commands wait until the display acknowledges one. While waiting, a newer command assigning the same
+   * attribute (e.g. `t0.txt` or `n0.val`) replaces the waiting one, so only the latest value is sent. A waiting
+   * assignment queued before another command (e.g. `page 1`) isn't replaced, the display sees the commands in order.
+   * 0 (the default) sends every command right away.
+   *
+   * @param max_commands_in_flight The number of unacknowledged commands.
+   */
+  void set_max_commands_in_flight(uint8_t max_commands_in_flight) {
+    this->max_commands_in_flight_ = max_commands_in_flight;
+  }
+  /// The number of commands waiting to be sent, see set_max_commands_in_flight().
+  size_t pending_queue_size() const { return this->pending_commands_.size(); }
+  /// The highest number of commands that were waiting to be sent at once.
+  size_t get_max_pending_queue_size() const { return this->max_pending_commands_; }
+  /// The number of waiting commands that were dropped because a newer command replaced them.
+  uint32_t get_superseded_commands() const { return this->superseded_commands_; }
+
  protected:
   std::deque<NextionQueue *> nextion_queue_;
   std::deque<NextionQueue *> waveform_queue_;
@@ -1066,6 +1086,15 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
 
   void check_pending_waveform_();
 
+  /// queue a command that doesn't return a result behind the commands that wait for a free slot
+  void add_pending_command_(const std::string &variable_name, const std::string &command);
+  /// send waiting commands while fewer than max_commands_in_flight_ are unacknowledged
+  void send_pending_commands_();
+  /// get a queue entry from the pool, with a component owned by the entry if `no_result` is set
+  NextionQueue *acquire_queue_entry_(bool no_result);
+  /// return a queue entry (and its component, if it's owned by the entry) to the pool
+  void release_queue_entry_(NextionQueue *entry);
+
 #ifdef USE_NEXTION_TFT_UPLOAD
 #ifdef USE_ESP8266
   WiFiClient *wifi_client_{nullptr};
@@ -1162,6 +1191,12 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
   bool is_connected_ = false;
   uint32_t startup_override_ms_ = 8000;
   uint32_t max_q_age_ms_ = 8000;
+  std::deque<NextionPendingCommand> pending_commands_;
+  std::vector<NextionQueue *> queue_entry_pool_;
+  std::vector<NextionComponentBase *> no_result_component_pool_;
+  uint8_t max_commands_in_flight_ = 0;
+  size_t max_pending_commands_ = 0;
+  uint32_t superseded_commands_ = 0;
   uint32_t started_ms_ = 0;
   bool sent_setup_commands_ = false;
 };
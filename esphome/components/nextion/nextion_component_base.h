@@ -1,4 +1,5 @@
 #pragma once
+#include <string>
 #include <utility>
 #include <vector>
 #include "esphome/core/defines.h"
@@ -27,6 +28,14 @@ class NextionQueue {
   uint32_t queue_time = 0;
 };
 
+/// A command waiting for a free slot in the pipeline to the display
+struct NextionPendingCommand {
+  std::string variable_name;
+  /// attribute the command assigns (e.g. "t0.txt"), a newer command for it replaces this one; empty if not replaceable
+  std::string key;
+  std::string command;
+};
+
 class NextionComponentBase {
  public:
   virtual ~NextionComponentBase() = default;
@@ -1,4 +1,5 @@
 #include "number.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -10,6 +11,7 @@ void Number::publish_state(float state) {
   this->has_state_ = true;
   this->state = state;
   ESP_LOGD(TAG, "'%s': Sending state %f", this->get_name().c_str(), state);
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_NUMBER, this->get_entity_index());
   this->state_callback_.call(state);
 }
 
@@ -47,7 +47,7 @@ std::unique_ptr<OTABackend> make_ota_backend() {
 OTAComponent::OTAComponent() { global_ota_component = this; }
 
 void OTAComponent::setup() {
-  server_ = socket::socket_ip(SOCK_STREAM, 0);
+  server_ = socket::socket_ip_loop_monitored(SOCK_STREAM, 0);
   if (server_ == nullptr) {
     ESP_LOGW(TAG, "Could not create socket.");
     this->mark_failed();
@@ -137,6 +137,8 @@ void OTAComponent::handle_() {
 #endif
 
   if (client_ == nullptr) {
+    if (!server_->ready())
+      return;
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
     client_ = server_->accept((struct sockaddr *) &source_addr, &addr_len);
@@ -8,7 +8,7 @@ static const char *const TAG = "output.switch";
 
 void OutputSwitch::dump_config() { LOG_SWITCH("", "Output Switch", this); }
 void OutputSwitch::setup() {
-  ESP_LOGCONFIG(TAG, "Setting up Output Switch '%s'...", this->name_.c_str());
+  ESP_LOGCONFIG(TAG, "Setting up Output Switch '%s'...", this->get_name().c_str());
 
   bool initial_state = this->get_initial_state_with_restore_mode().value_or(false);
 
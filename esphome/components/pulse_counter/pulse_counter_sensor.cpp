@@ -144,7 +144,7 @@ pulse_counter_t HwPulseCounterStorage::read_raw_value() {
 #endif
 
 void PulseCounterSensor::setup() {
-  ESP_LOGCONFIG(TAG, "Setting up pulse counter '%s'...", this->name_.c_str());
+  ESP_LOGCONFIG(TAG, "Setting up pulse counter '%s'...", this->get_name().c_str());
   if (!this->storage_.pulse_counter_setup(this->pin_)) {
     this->mark_failed();
     return;
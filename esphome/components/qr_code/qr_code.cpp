@@ -43,10 +43,18 @@ void QrCode::draw(display::Display *buff, uint16_t x_offset, uint16_t y_offset,
 
   uint8_t qrcode_width = qrcodegen_getSize(this->qr_);
 
-  for (int y = 0; y < qrcode_width * scale; y++) {
-    for (int x = 0; x < qrcode_width * scale; x++) {
-      if (qrcodegen_getModule(this->qr_, x / scale, y / scale)) {
-        buff->draw_pixel_at(x_offset + x, y_offset + y, color);
+  // draw each horizontal run of dark modules as a single span, repeated for every scaled row
+  for (int y = 0; y < qrcode_width; y++) {
+    int run_start = -1;
+    for (int x = 0; x <= qrcode_width; x++) {
+      bool module = x < qrcode_width && qrcodegen_getModule(this->qr_, x, y);
+      if (module && run_start < 0) {
+        run_start = x;
+      } else if (!module && run_start >= 0) {
+        for (int row = 0; row < scale; row++) {
+          buff->fill_row_at(x_offset + run_start * scale, y_offset + y * scale + row, (x - run_start) * scale, color);
+        }
+        run_start = -1;
       }
     }
   }
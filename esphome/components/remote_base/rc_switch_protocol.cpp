@@ -131,13 +131,34 @@ bool RCSwitchBase::decode(RemoteReceiveData &src, uint64_t *out_data, uint8_t *o
   }
   return true;
 }
+bool RCSwitchBase::decode_cached(RemoteReceiveData &src, const void *key, uint64_t *out_data,
+                                 uint8_t *out_nbits) const {
+  RemoteDecodeCache *cache = src.get_decode_cache();
+  if (cache == nullptr || src.get_index() != 0)
+    return this->decode(src, out_data, out_nbits);
+
+  struct Result {
+    bool valid;
+    uint64_t code;
+    uint8_t nbits;
+  };
+  const auto &result = cache->get<Result>(key, [this, &src]() {
+    Result result{};
+    RemoteReceiveData copy = src;
+    result.valid = this->decode(copy, &result.code, &result.nbits);
+    return result;
+  });
+  *out_data = result.code;
+  *out_nbits = result.nbits;
+  return result.valid;
+}
 optional<RCSwitchData> RCSwitchBase::decode(RemoteReceiveData &src) const {
   RCSwitchData out;
   uint8_t out_nbits;
   for (uint8_t i = 1; i <= 8; i++) {
     src.reset();
     const RCSwitchBase *protocol = &RC_SWITCH_PROTOCOLS[i];
-    if (protocol->decode(src, &out.code, &out_nbits) && out_nbits >= 3) {
+    if (protocol->decode_cached(src, protocol, &out.code, &out_nbits) && out_nbits >= 3) {
       out.protocol = i;
       return out;
     }
@@ -238,10 +259,20 @@ uint64_t decode_binary_string_mask(const std::string &data) {
   return ret;
 }
 
+void RCSwitchRawReceiver::set_protocol(const RCSwitchBase &a_protocol) {
+  this->protocol_ = a_protocol;
+  this->cache_key_ = this;
+  for (const auto &protocol : RC_SWITCH_PROTOCOLS) {
+    if (protocol == a_protocol) {
+      this->cache_key_ = &protocol;
+      break;
+    }
+  }
+}
 bool RCSwitchRawReceiver::matches(RemoteReceiveData src) {
   uint64_t decoded_code;
   uint8_t decoded_nbits;
-  if (!this->protocol_.decode(src, &decoded_code, &decoded_nbits))
+  if (!this->protocol_.decode_cached(src, this->cache_key_, &decoded_code, &decoded_nbits))
     return false;
 
   return decoded_nbits == this->nbits_ && (decoded_code & this->mask_) == (this->code_ & this->mask_);
@@ -252,7 +283,7 @@ bool RCSwitchDumper::dump(RemoteReceiveData src) {
     uint64_t out_data;
     uint8_t out_nbits;
     const RCSwitchBase *protocol = &RC_SWITCH_PROTOCOLS[i];
-    if (protocol->decode(src, &out_data, &out_nbits) && out_nbits >= 3) {
+    if (protocol->decode_cached(src, protocol, &out_data, &out_nbits) && out_nbits >= 3) {
       char buffer[65];
       for (uint8_t j = 0; j < out_nbits; j++)
         buffer[j] = (out_data & ((uint64_t) 1 << (out_nbits - j - 1))) ? '1' : '0';
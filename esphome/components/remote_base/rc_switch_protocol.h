@@ -37,6 +37,9 @@ class RCSwitchBase {
 
   bool decode(RemoteReceiveData &src, uint64_t *out_data, uint8_t *out_nbits) const;
 
+  /// Like decode(), but shares the result with other decodes of the same frame that use the same `key`.
+  bool decode_cached(RemoteReceiveData &src, const void *key, uint64_t *out_data, uint8_t *out_nbits) const;
+
   optional<RCSwitchData> decode(RemoteReceiveData &src) const;
 
   static void simple_code_to_tristate(uint16_t code, uint8_t nbits, uint64_t *out_code);
@@ -52,6 +55,12 @@ class RCSwitchBase {
 
   static void type_d_code(uint8_t group, uint8_t device, bool state, uint64_t *out_code, uint8_t *out_nbits);
 
+  bool operator==(const RCSwitchBase &rhs) const {
+    return this->sync_high_ == rhs.sync_high_ && this->sync_low_ == rhs.sync_low_ &&
+           this->zero_high_ == rhs.zero_high_ && this->zero_low_ == rhs.zero_low_ &&
+           this->one_high_ == rhs.one_high_ && this->one_low_ == rhs.one_low_ && this->inverted_ == rhs.inverted_;
+  }
+
  protected:
   uint32_t sync_high_{};
   uint32_t sync_low_{};
@@ -176,7 +185,7 @@ template<typename... Ts> class RCSwitchTypeDAction : public RemoteTransmitterAct
 
 class RCSwitchRawReceiver : public RemoteReceiverBinarySensorBase {
  public:
-  void set_protocol(const RCSwitchBase &a_protocol) { this->protocol_ = a_protocol; }
+  void set_protocol(const RCSwitchBase &a_protocol);
   void set_code(uint64_t code) { this->code_ = code; }
   void set_code(const std::string &code) {
     this->code_ = decode_binary_string(code);
@@ -205,6 +214,8 @@ class RCSwitchRawReceiver : public RemoteReceiverBinarySensorBase {
   bool matches(RemoteReceiveData src) override;
 
   RCSwitchBase protocol_;
+  /// Decode cache key, shared by all receivers using the same predefined protocol
+  const void *cache_key_{this};
   uint64_t code_;
   uint64_t mask_{0xFFFFFFFFFFFFFFFF};
   uint8_t nbits_;
@@ -105,21 +105,34 @@ void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
 
 void RemoteReceiverBase::call_listeners_() {
   for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_));
+    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, &this->decode_cache_));
 }
 
 void RemoteReceiverBase::call_dumpers_() {
   bool success = false;
   for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_)))
+    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, &this->decode_cache_)))
       success = true;
   }
   if (!success) {
     for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_));
+      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, &this->decode_cache_));
   }
 }
 
+void RemoteReceiverBase::call_listeners_dumpers_() {
+  this->decode_cache_.next_frame();
+#ifdef ESPHOME_LOG_HAS_VERBOSE
+  uint32_t start = micros();
+#endif
+  this->call_listeners_();
+  this->call_dumpers_();
+#ifdef ESPHOME_LOG_HAS_VERBOSE
+  ESP_LOGV(TAG, "Dispatched %zu timings in %" PRIu32 "us, %" PRIu32 " decodes, %" PRIu32 " reused", this->temp_.size(),
+           micros() - start, this->decode_cache_.get_decodes(), this->decode_cache_.get_hits());
+#endif
+}
+
 void RemoteReceiverBinarySensorBase::dump_config() { LOG_BINARY_SENSOR("", "Remote Receiver Binary Sensor", this); }
 
 void RemoteTransmitterBase::send_(uint32_t send_times, uint32_t send_wait) {
@@ -1,3 +1,4 @@
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -40,10 +41,71 @@ class RemoteTransmitData {
   uint32_t carrier_frequency_{0};
 };
 
+/** Results of the protocol decoders for the frame that is currently being dispatched.
+ *
+ * Listeners and dumpers of the same protocol share one decode per frame instead of each running the decoder on the
+ * raw timings. Entries are created the first time a protocol is decoded and reused for every following frame.
+ */
+class RemoteDecodeCache {
+ public:
+  /// Invalidate all results, called before a new frame is dispatched.
+  void next_frame() {
+    this->frame_++;
+    this->decodes_ = 0;
+    this->hits_ = 0;
+  }
+
+  /// Result of `decode` for the current frame, keyed by `key`. `decode` only runs if there is no result yet.
+  template<typename T, typename F> const T &get(const void *key, F &&decode) {
+    Entry<T> *entry = nullptr;
+    for (auto &it : this->entries_) {
+      if (it->key == key) {
+        entry = static_cast<Entry<T> *>(it.get());
+        break;
+      }
+    }
+    if (entry == nullptr) {
+      entry = new Entry<T>();  // NOLINT(cppcoreguidelines-owning-memory)
+      entry->key = key;
+      this->entries_.emplace_back(entry);
+    }
+    if (entry->frame != this->frame_) {
+      entry->value = decode();
+      entry->frame = this->frame_;
+      this->decodes_++;
+    } else {
+      this->hits_++;
+    }
+    return entry->value;
+  }
+
+  /// Number of decoder runs for the current frame.
+  uint32_t get_decodes() const { return this->decodes_; }
+  /// Number of decodes of the current frame that were answered from the cache.
+  uint32_t get_hits() const { return this->hits_; }
+
+ protected:
+  struct EntryBase {
+    virtual ~EntryBase() = default;
+    const void *key;
+    uint32_t frame{0};
+  };
+  template<typename T> struct Entry : EntryBase { T value; };
+
+  std::vector<std::unique_ptr<EntryBase>> entries_;
+  uint32_t frame_{0};
+  uint32_t decodes_{0};
+  uint32_t hits_{0};
+};
+
+/// Unique address per protocol type, used as decode cache key.
+template<typename T> struct RemoteProtocolKey { static char key; };  // NOLINT
+template<typename T> char RemoteProtocolKey<T>::key = 0;              // NOLINT
+
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint8_t tolerance)
-      : data_(data), index_(0), tolerance_(tolerance) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint8_t tolerance, RemoteDecodeCache *cache = nullptr)
+      : data_(data), index_(0), tolerance_(tolerance), cache_(cache) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
   uint32_t get_index() const { return index_; }
@@ -65,6 +127,11 @@ class RemoteReceiveData {
   void advance(uint32_t amount = 1) { this->index_ += amount; }
   void reset() { this->index_ = 0; }
 
+  /// Decode the frame with protocol T, reusing the result if it was already decoded with it.
+  template<typename T> optional<typename T::ProtocolData> decode() const;
+  /// Decode cache of the frame, or nullptr when the data is not dispatched by a receiver.
+  RemoteDecodeCache *get_decode_cache() const { return this->cache_; }
+
  protected:
   int32_t lower_bound_(uint32_t length) const { return int32_t(100 - this->tolerance_) * length / 100U; }
   int32_t upper_bound_(uint32_t length) const { return int32_t(100 + this->tolerance_) * length / 100U; }
@@ -72,6 +139,7 @@ class RemoteReceiveData {
   const RawTimings &data_;
   uint32_t index_;
   uint8_t tolerance_;
+  RemoteDecodeCache *cache_;
 };
 
 class RemoteComponentBase {
@@ -166,16 +234,14 @@ class RemoteReceiverBase : public RemoteComponentBase {
  protected:
   void call_listeners_();
   void call_dumpers_();
-  void call_listeners_dumpers_() {
-    this->call_listeners_();
-    this->call_dumpers_();
-  }
+  void call_listeners_dumpers_();
 
   std::vector<RemoteReceiverListener *> listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
   std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
   RawTimings temp_;
   uint8_t tolerance_;
+  RemoteDecodeCache decode_cache_;
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -198,14 +264,24 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const ProtocolData &data) = 0;
 };
 
+template<typename T> optional<typename T::ProtocolData> RemoteReceiveData::decode() const {
+  auto decode = [this]() {
+    // decoders advance the index, so work on a copy
+    RemoteReceiveData src = *this;
+    return T().decode(src);
+  };
+  if (this->cache_ == nullptr || this->index_ != 0)
+    return decode();
+  return this->cache_->get<optional<typename T::ProtocolData>>(&RemoteProtocolKey<T>::key, decode);
+}
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = src.decode<T>();
     return res.has_value() && *res == this->data_;
   }
 
@@ -220,8 +296,7 @@ template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = src.decode<T>();
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -262,11 +337,10 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    auto decoded = src.decode<T>();
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
 };
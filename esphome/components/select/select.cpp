@@ -1,4 +1,5 @@
 #include "select.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -13,6 +14,7 @@ void Select::publish_state(const std::string &state) {
     this->has_state_ = true;
     this->state = state;
     ESP_LOGD(TAG, "'%s': Sending state %s (index %d)", name, state.c_str(), index.value());
+    global_entity_change_bus.mark_changed(ENTITY_TYPE_SELECT, this->get_entity_index());
     this->state_callback_.call(state, index.value());
   } else {
     ESP_LOGE(TAG, "'%s': invalid state for publish_state(): %s", name, state.c_str());
@@ -36,6 +36,7 @@ from esphome.const import (
     CONF_MIN_VALUE,
     CONF_MAX_VALUE,
     CONF_METHOD,
+    CONF_POLLING_DELTA,
     DEVICE_CLASS_APPARENT_POWER,
     DEVICE_CLASS_AQI,
     DEVICE_CLASS_ATMOSPHERIC_PRESSURE,
@@ -90,7 +91,11 @@ from esphome.const import (
 )
 from esphome.core import CORE, coroutine_with_priority
 from esphome.cpp_generator import MockObjClass
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import (
+    ADAPTIVE_POLLING_INVALID_FILTERS,
+    get_adaptive_poller,
+    setup_entity,
+)
 from esphome.util import Registry
 
 CODEOWNERS = ["@esphome/core"]
@@ -159,6 +164,22 @@ validate_state_class = cv.enum(STATE_CLASSES, lower=True, space="_")
 
 IS_PLATFORM_COMPONENT = True
 
+# filters that combine several readings or wait for them, the time they cover would
+# grow with the update interval of adaptive polling, the config validation rejects them
+ADAPTIVE_POLLING_INVALID_FILTERS.update(
+    {
+        "quantile",
+        "median",
+        "skip_initial",
+        "min",
+        "max",
+        "sliding_window_moving_average",
+        "exponential_moving_average",
+        "throttle_average",
+        "timeout",
+    }
+)
+
 
 def validate_send_first_at(value):
     send_first_at = value.get(CONF_SEND_FIRST_AT)
@@ -263,6 +284,7 @@ SENSOR_SCHEMA = cv.ENTITY_BASE_SCHEMA.extend(cv.MQTT_COMPONENT_SCHEMA).extend(
             "last_reset_type has been removed since 2021.9.0. state_class: total_increasing should be used for total values."
         ),
         cv.Optional(CONF_FORCE_UPDATE, default=False): cv.boolean,
+        cv.Optional(CONF_POLLING_DELTA): cv.positive_float,
         cv.Optional(CONF_EXPIRE_AFTER): cv.All(
             cv.requires_component("mqtt"),
             cv.Any(None, cv.positive_time_period_milliseconds),
@@ -727,9 +749,18 @@ async def build_filters(config):
     return await cg.build_registry_list(FILTER_REGISTRY, config)
 
 
+async def _setup_adaptive_polling(var, poller_id, config):
+    poller = await cg.get_variable(poller_id)
+    cg.add(var.set_adaptive_polling(poller, config.get(CONF_POLLING_DELTA, 0.0)))
+
+
 async def setup_sensor_core_(var, config):
     await setup_entity(var, config)
 
+    poller_id = get_adaptive_poller(config)
+    if poller_id is not None:
+        CORE.add_job(_setup_adaptive_polling, var, poller_id, config)
+
     if CONF_DEVICE_CLASS in config:
         cg.add(var.set_device_class(config[CONF_DEVICE_CLASS]))
     if CONF_STATE_CLASS in config:
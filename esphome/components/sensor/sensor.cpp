@@ -1,5 +1,7 @@
 #include "sensor.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
+#include <cmath>
 
 namespace esphome {
 namespace sensor {
@@ -40,7 +42,15 @@ void Sensor::publish_state(float state) {
   this->raw_state = state;
   this->raw_callback_.call(state);
 
-  ESP_LOGV(TAG, "'%s': Received new state %f", this->name_.c_str(), state);
+  if (this->poller_ != nullptr) {
+    const bool changed = std::isnan(state) != std::isnan(this->polling_reference_) ||
+                         std::fabs(state - this->polling_reference_) > this->polling_delta_;
+    if (changed)
+      this->polling_reference_ = state;
+    this->poller_->report_reading(changed);
+  }
+
+  ESP_LOGV(TAG, "'%s': Received new state %f", this->get_name().c_str(), state);
 
   if (this->filter_list_ == nullptr) {
     this->internal_send_state_to_frontend(state);
@@ -50,6 +60,10 @@ void Sensor::publish_state(float state) {
 }
 
 void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
+void Sensor::set_adaptive_polling(PollingComponent *poller, float delta) {
+  this->poller_ = poller;
+  this->polling_delta_ = delta;
+}
 void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
   this->raw_callback_.add(std::move(callback));
 }
@@ -92,6 +106,7 @@ void Sensor::internal_send_state_to_frontend(float state) {
   this->state = state;
   ESP_LOGD(TAG, "'%s': Sending state %.5f %s with %d decimals of accuracy", this->get_name().c_str(), state,
            this->get_unit_of_measurement().c_str(), this->get_accuracy_decimals());
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_SENSOR, this->get_entity_index());
   this->callback_.call(state);
 }
 bool Sensor::has_state() const { return this->has_state_; }
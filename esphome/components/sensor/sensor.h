@@ -121,6 +121,13 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
   /// Add a callback that will be called every time the sensor sends a raw value.
   void add_on_raw_state_callback(std::function<void(float)> &&callback);
 
+  /** Report raw values to `poller` for adaptive polling.
+   *
+   * A value counts as changed if it differs by more than `delta` from the last changed value. The filters still see
+   * every value, only the time between them grows while the values are stable.
+   */
+  void set_adaptive_polling(PollingComponent *poller, float delta);
+
   /** This member variable stores the last state that has passed through all filters.
    *
    * On startup, when no state is available yet, this is NAN (not-a-number) and the validity
@@ -153,6 +160,10 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
 
   Filter *filter_list_{nullptr};  ///< Store all active filters.
 
+  PollingComponent *poller_{nullptr};  ///< Component notified of raw values for adaptive polling.
+  float polling_delta_{0.0f};          ///< Band within which raw values count as unchanged.
+  float polling_reference_{NAN};       ///< Last raw value that counted as changed.
+
   optional<int8_t> accuracy_decimals_;                  ///< Accuracy in decimals override
   optional<StateClass> state_class_{STATE_CLASS_NONE};  ///< State class override
   bool force_update_{false};                            ///< Force update mode
@@ -143,6 +143,11 @@ class LWIPRawImpl : public Socket {
     pcb_ = nullptr;
     return 0;
   }
+  int connect(const struct sockaddr *addr, socklen_t addrlen) override {
+    // only listening sockets are implemented on top of the raw API
+    errno = EOPNOTSUPP;
+    return -1;
+  }
   int shutdown(int how) override {
     if (pcb_ == nullptr) {
       errno = ECONNRESET;
@@ -484,6 +489,11 @@ class LWIPRawImpl : public Socket {
     return 0;
   }
 
+  bool ready() const override {
+    // errors and a closed connection are reported by the next read, so they count as ready as well
+    return pcb_ == nullptr || rx_buf_ != nullptr || rx_closed_ || !accepted_sockets_.empty();
+  }
+
   err_t accept_fn(struct tcp_pcb *newpcb, err_t err) {
     LWIP_LOG("accept(newpcb=%p err=%d)", newpcb, err);
     if (err != ERR_OK || newpcb == nullptr) {
@@ -605,6 +615,11 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{sock};
 }
 
+// the raw TCP callbacks already buffer incoming data, ready() reflects those buffers for every socket
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol) {
+  return socket(domain, type, protocol);
+}
+
 }  // namespace socket
 }  // namespace esphome
 
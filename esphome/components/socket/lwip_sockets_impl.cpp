@@ -1,4 +1,5 @@
 #include "socket.h"
+#include "socket_registry.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
@@ -33,7 +34,12 @@ std::string format_sockaddr(const struct sockaddr_storage &storage) {
 
 class LwIPSocketImpl : public Socket {
  public:
-  LwIPSocketImpl(int fd) : fd_(fd) {}
+  LwIPSocketImpl(int fd, bool monitor_loop = false) : fd_(fd) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (monitor_loop)
+      this->loop_monitored_ = global_socket_registry.register_fd(fd);
+#endif
+  }
   ~LwIPSocketImpl() override {
     if (!closed_) {
       close();  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
@@ -43,14 +49,22 @@ class LwIPSocketImpl : public Socket {
     int fd = lwip_accept(fd_, addr, addrlen);
     if (fd == -1)
       return {};
-    return make_unique<LwIPSocketImpl>(fd);
+    return make_unique<LwIPSocketImpl>(fd, this->loop_monitored_);
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return lwip_bind(fd_, addr, addrlen); }
   int close() override {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (this->loop_monitored_) {
+      global_socket_registry.unregister_fd(this->fd_);
+      this->loop_monitored_ = false;
+      this->write_interest_ = false;
+    }
+#endif
     int ret = lwip_close(fd_);
     closed_ = true;
     return ret;
   }
+  int connect(const struct sockaddr *addr, socklen_t addrlen) override { return lwip_connect(fd_, addr, addrlen); }
   int shutdown(int how) override { return lwip_shutdown(fd_, how); }
 
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override { return lwip_getpeername(fd_, addr, addrlen); }
@@ -97,9 +111,34 @@ class LwIPSocketImpl : public Socket {
     return 0;
   }
 
+  bool ready() const override {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (this->loop_monitored_)
+      return global_socket_registry.is_ready(this->fd_);
+#endif
+    return true;
+  }
+  void set_write_interest(bool interested) override {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (this->loop_monitored_ && interested != this->write_interest_) {
+      global_socket_registry.set_write_interest(this->fd_, interested);
+      this->write_interest_ = interested;
+    }
+#endif
+  }
+  bool writable() const override {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (this->write_interest_)
+      return global_socket_registry.is_writable(this->fd_);
+#endif
+    return true;
+  }
+
  protected:
   int fd_;
   bool closed_ = false;
+  bool loop_monitored_ = false;
+  bool write_interest_ = false;
 };
 
 std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
@@ -109,6 +148,13 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{new LwIPSocketImpl(ret)};
 }
 
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol) {
+  int ret = lwip_socket(domain, type, protocol);
+  if (ret == -1)
+    return nullptr;
+  return std::unique_ptr<Socket>{new LwIPSocketImpl(ret, true)};
+}
+
 }  // namespace socket
 }  // namespace esphome
 
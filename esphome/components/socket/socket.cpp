@@ -17,6 +17,14 @@ std::unique_ptr<Socket> socket_ip(int type, int protocol) {
 #endif
 }
 
+std::unique_ptr<Socket> socket_ip_loop_monitored(int type, int protocol) {
+#if ENABLE_IPV6
+  return socket_loop_monitored(AF_INET6, type, protocol);
+#else
+  return socket_loop_monitored(AF_INET, type, protocol);
+#endif
+}
+
 socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::string &ip_address, uint16_t port) {
 #if ENABLE_IPV6
   if (addrlen < sizeof(sockaddr_in6)) {
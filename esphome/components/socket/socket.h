@@ -18,9 +18,8 @@ class Socket {
   virtual std::unique_ptr<Socket> accept(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual int bind(const struct sockaddr *addr, socklen_t addrlen) = 0;
   virtual int close() = 0;
-  // not supported yet:
-  // virtual int connect(const std::string &address) = 0;
-  // virtual int connect(const struct sockaddr *addr, socklen_t addrlen) = 0;
+  /// Connect to a remote address, non-blocking sockets return -1 with errno EINPROGRESS while connecting.
+  virtual int connect(const struct sockaddr *addr, socklen_t addrlen) = 0;
   virtual int shutdown(int how) = 0;
 
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
@@ -41,6 +40,17 @@ class Socket {
 
   virtual int setblocking(bool blocking) = 0;
   virtual int loop() { return 0; };
+
+  /// Whether a read()/accept() may return data, sockets that aren't monitored by the loop are always ready.
+  virtual bool ready() const { return true; }
+  /** Also wake the loop up when the socket becomes writable, while `interested` is true.
+   *
+   * A connected socket is writable most of the time, so only ask for it while a connect() is in progress or a write()
+   * didn't take all of the data. Sockets that aren't monitored by the loop ignore it.
+   */
+  virtual void set_write_interest(bool interested) {}
+  /// Whether a write() may take data or a connect() finished, always true without write interest.
+  virtual bool writable() const { return true; }
 };
 
 /// Create a socket of the given domain, type and protocol.
@@ -49,6 +59,16 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol);
 /// Create a socket in the newest available IP domain (IPv6 or IPv4) of the given type and protocol.
 std::unique_ptr<Socket> socket_ip(int type, int protocol);
 
+/** Create a socket that is monitored by the loop, the loop wakes up when it becomes readable.
+ *
+ * Components use ready() to skip reading the socket while nothing arrived. Sockets accepted from a monitored socket
+ * are monitored as well.
+ */
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol);
+
+/// Create a socket monitored by the loop in the newest available IP domain, see socket_loop_monitored().
+std::unique_ptr<Socket> socket_ip_loop_monitored(int type, int protocol);
+
 /// Set a sockaddr to the specified address and port for the IP version used by socket_ip().
 socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::string &ip_address, uint16_t port);
 
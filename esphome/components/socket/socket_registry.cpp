@@ -0,0 +1,198 @@
+#include "socket_registry.h"
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+
+#include <algorithm>
+#include <cerrno>
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_SOCKET_REGISTRY_EPOLL
+#include <sys/epoll.h>
+#include <unistd.h>
+#endif
+
+namespace esphome {
+namespace socket {
+
+static const char *const TAG = "socket.registry";
+
+#ifdef USE_SOCKET_REGISTRY_EPOLL
+
+SocketRegistry::SocketRegistry() = default;
+
+bool SocketRegistry::register_fd(int fd) {
+  if (this->epoll_fd_ == -1) {
+    this->epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (this->epoll_fd_ == -1) {
+      ESP_LOGW(TAG, "Failed to create epoll instance: errno %d", errno);
+      return false;
+    }
+  }
+  struct epoll_event event {};
+  event.events = EPOLLIN;
+  event.data.fd = fd;
+  if (epoll_ctl(this->epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0) {
+    ESP_LOGW(TAG, "Failed to monitor socket %d: errno %d", fd, errno);
+    return false;
+  }
+  this->count_++;
+  return true;
+}
+
+void SocketRegistry::unregister_fd(int fd) {
+  epoll_ctl(this->epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+  this->count_--;
+  // the number may be reused by the next socket before the next wait()
+  this->ready_fds_.erase(std::remove(this->ready_fds_.begin(), this->ready_fds_.end(), fd), this->ready_fds_.end());
+  this->writable_fds_.erase(std::remove(this->writable_fds_.begin(), this->writable_fds_.end(), fd),
+                            this->writable_fds_.end());
+}
+
+bool SocketRegistry::is_ready(int fd) const {
+  return std::find(this->ready_fds_.begin(), this->ready_fds_.end(), fd) != this->ready_fds_.end();
+}
+
+void SocketRegistry::set_write_interest(int fd, bool interested) {
+  struct epoll_event event {};
+  event.events = interested ? EPOLLIN | EPOLLOUT : EPOLLIN;
+  event.data.fd = fd;
+  if (epoll_ctl(this->epoll_fd_, EPOLL_CTL_MOD, fd, &event) != 0)
+    ESP_LOGW(TAG, "Failed to monitor socket %d for writing: errno %d", fd, errno);
+  if (!interested) {
+    this->writable_fds_.erase(std::remove(this->writable_fds_.begin(), this->writable_fds_.end(), fd),
+                              this->writable_fds_.end());
+  }
+}
+
+bool SocketRegistry::is_writable(int fd) const {
+  return std::find(this->writable_fds_.begin(), this->writable_fds_.end(), fd) != this->writable_fds_.end();
+}
+
+void SocketRegistry::wait(uint32_t timeout_ms) {
+  this->ready_fds_.clear();
+  this->writable_fds_.clear();
+  if (this->count_ == 0) {
+    delay(timeout_ms);
+    return;
+  }
+  struct epoll_event events[16];
+#ifdef USE_HOST_VIRTUAL_TIME
+  // the simulated clock must not wait for real time, only look at the sockets and let delay() move the clock
+  int ret = epoll_wait(this->epoll_fd_, events, 16, 0);
+  delay(timeout_ms);
+#else
+  int ret = epoll_wait(this->epoll_fd_, events, 16, timeout_ms);
+#endif
+  if (ret < 0) {
+    if (errno != EINTR) {
+      ESP_LOGW(TAG, "epoll_wait failed: errno %d", errno);
+      delay(timeout_ms);
+    }
+    return;
+  }
+  for (int i = 0; i < ret; i++) {
+    // errors and a closed connection are reported by the next read() or write()
+    if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+      this->ready_fds_.push_back(events[i].data.fd);
+    if (events[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+      this->writable_fds_.push_back(events[i].data.fd);
+  }
+}
+
+#else  // !USE_SOCKET_REGISTRY_EPOLL
+
+SocketRegistry::SocketRegistry() {
+  FD_ZERO(&this->monitored_fds_);
+  FD_ZERO(&this->write_fds_);
+  FD_ZERO(&this->ready_fds_);
+  FD_ZERO(&this->writable_fds_);
+}
+
+bool SocketRegistry::register_fd(int fd) {
+  if (fd < 0 || fd >= FD_SETSIZE) {
+    ESP_LOGW(TAG, "Socket %d can't be monitored, FD_SETSIZE is %d", fd, FD_SETSIZE);
+    return false;
+  }
+  this->fds_.push_back(fd);
+  FD_SET(fd, &this->monitored_fds_);
+  this->max_fd_ = std::max(this->max_fd_, fd);
+  return true;
+}
+
+void SocketRegistry::unregister_fd(int fd) {
+  this->set_write_interest(fd, false);
+  this->fds_.erase(std::remove(this->fds_.begin(), this->fds_.end(), fd), this->fds_.end());
+  FD_CLR(fd, &this->monitored_fds_);
+  // the number may be reused by the next socket before the next wait()
+  FD_CLR(fd, &this->ready_fds_);
+  this->max_fd_ = this->fds_.empty() ? -1 : *std::max_element(this->fds_.begin(), this->fds_.end());
+}
+
+bool SocketRegistry::is_ready(int fd) const { return FD_ISSET(fd, &this->ready_fds_); }
+
+void SocketRegistry::set_write_interest(int fd, bool interested) {
+  if (interested == static_cast<bool>(FD_ISSET(fd, &this->write_fds_)))
+    return;
+  if (interested) {
+    FD_SET(fd, &this->write_fds_);
+    this->write_interest_++;
+  } else {
+    FD_CLR(fd, &this->write_fds_);
+    FD_CLR(fd, &this->writable_fds_);
+    this->write_interest_--;
+  }
+}
+
+bool SocketRegistry::is_writable(int fd) const { return FD_ISSET(fd, &this->writable_fds_); }
+
+void SocketRegistry::wait(uint32_t timeout_ms) {
+  FD_ZERO(&this->ready_fds_);
+  FD_ZERO(&this->writable_fds_);
+  if (this->fds_.empty()) {
+    delay(timeout_ms);
+    return;
+  }
+  fd_set read_fds = this->monitored_fds_;
+  fd_set write_fds = this->write_fds_;
+  // without write interest lwIP doesn't need to look at the send buffers
+  fd_set *write_set = this->write_interest_ > 0 ? &write_fds : nullptr;
+  struct timeval tv;
+#ifdef USE_HOST_VIRTUAL_TIME
+  // the simulated clock must not wait for real time, only look at the sockets and let delay() move the clock
+  tv.tv_sec = 0;
+  tv.tv_usec = 0;
+  delay(timeout_ms);
+#else
+  tv.tv_sec = timeout_ms / 1000;
+  tv.tv_usec = (timeout_ms % 1000) * 1000;
+#endif
+#if defined(USE_ESP32) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
+  int ret = lwip_select(this->max_fd_ + 1, &read_fds, write_set, nullptr, &tv);
+#else
+  int ret = ::select(this->max_fd_ + 1, &read_fds, write_set, nullptr, &tv);
+#endif
+  if (ret < 0) {
+    if (errno != EINTR) {
+      ESP_LOGW(TAG, "select failed: errno %d", errno);
+      // don't turn a persistent error into a busy loop
+      delay(timeout_ms);
+    }
+    return;
+  }
+  if (ret > 0) {
+    this->ready_fds_ = read_fds;
+    if (write_set != nullptr)
+      this->writable_fds_ = write_fds;
+  }
+}
+
+#endif  // USE_SOCKET_REGISTRY_EPOLL
+
+SocketRegistry global_socket_registry;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace socket
+}  // namespace esphome
+
+#endif  // USE_SOCKET_SELECT_SUPPORT
@@ -0,0 +1,70 @@
+#pragma once
+#include "esphome/core/defines.h"
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+
+#include <cstdint>
+#include <vector>
+
+#include "headers.h"
+
+#ifdef USE_SOCKET_IMPL_BSD_SOCKETS
+#include <sys/select.h>
+#endif
+
+#if defined(USE_HOST) && defined(__linux__)
+#define USE_SOCKET_REGISTRY_EPOLL
+#endif
+
+namespace esphome {
+namespace socket {
+
+/** Tracks which of the sockets the components registered have data (or a connection) waiting.
+ *
+ * Application::loop() sleeps in wait() instead of delay(), so it wakes up as soon as a registered socket becomes
+ * readable. The components then only call read()/accept() on sockets whose Socket::ready() is true instead of
+ * polling every socket on every loop iteration. Sockets with write interest also wake it up when they become
+ * writable. Uses lwIP select() on the microcontrollers and epoll on Linux hosts.
+ */
+class SocketRegistry {
+ public:
+  SocketRegistry();
+
+  /// Starts monitoring a file descriptor, returns false if it can't be monitored (callers then keep polling it).
+  bool register_fd(int fd);
+  void unregister_fd(int fd);
+
+  /// Whether the file descriptor was readable at the end of the last wait().
+  bool is_ready(int fd) const;
+
+  /// Also wait for a registered file descriptor to become writable, while `interested` is true.
+  void set_write_interest(int fd, bool interested);
+  /// Whether the file descriptor was writable at the end of the last wait(), only tracked with write interest.
+  bool is_writable(int fd) const;
+
+  /// Sleeps until a registered socket becomes readable (or writable) or the timeout expires, 0 only polls.
+  void wait(uint32_t timeout_ms);
+
+ protected:
+#ifdef USE_SOCKET_REGISTRY_EPOLL
+  int epoll_fd_{-1};
+  size_t count_{0};
+  std::vector<int> ready_fds_;
+  std::vector<int> writable_fds_;
+#else
+  std::vector<int> fds_;
+  int max_fd_{-1};
+  size_t write_interest_{0};
+  fd_set monitored_fds_;
+  fd_set write_fds_;
+  fd_set ready_fds_;
+  fd_set writable_fds_;
+#endif
+};
+
+extern SocketRegistry global_socket_registry;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace socket
+}  // namespace esphome
+
+#endif  // USE_SOCKET_SELECT_SUPPORT
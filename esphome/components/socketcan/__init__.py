@@ -0,0 +1 @@
+CODEOWNERS = ["@esphome/core"]
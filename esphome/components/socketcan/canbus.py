@@ -0,0 +1,31 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import canbus
+from esphome.const import CONF_ID, PLATFORM_HOST
+from esphome.components.canbus import CanbusComponent
+
+CODEOWNERS = ["@esphome/core"]
+
+CONF_INTERFACE = "interface"
+
+socketcan_ns = cg.esphome_ns.namespace("socketcan")
+SocketCan = socketcan_ns.class_("SocketCan", CanbusComponent)
+
+CONFIG_SCHEMA = cv.All(
+    canbus.CANBUS_SCHEMA.extend(
+        {
+            cv.GenerateID(): cv.declare_id(SocketCan),
+            cv.Optional(CONF_INTERFACE, default="vcan0"): cv.All(
+                cv.string, cv.Length(min=1, max=15)
+            ),
+        }
+    ),
+    cv.only_on(PLATFORM_HOST),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await canbus.register_canbus(var, config)
+
+    cg.add(var.set_interface(config[CONF_INTERFACE]))
@@ -0,0 +1,122 @@
+#if defined(USE_HOST) && defined(__linux__)
+
+#include "socketcan.h"
+#include "esphome/core/log.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace esphome {
+namespace socketcan {
+
+static const char *const TAG = "socketcan";
+
+bool SocketCan::setup_internal() {
+  this->fd_ = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
+  if (this->fd_ < 0) {
+    ESP_LOGE(TAG, "Could not create a CAN socket: %s", strerror(errno));
+    return false;
+  }
+
+  struct ifreq ifr {};
+  strncpy(ifr.ifr_name, this->interface_.c_str(), IFNAMSIZ - 1);
+  if (::ioctl(this->fd_, SIOCGIFINDEX, &ifr) < 0) {
+    ESP_LOGE(TAG, "Interface %s not found: %s", this->interface_.c_str(), strerror(errno));
+    ::close(this->fd_);
+    this->fd_ = -1;
+    return false;
+  }
+
+  struct sockaddr_can addr {};
+  addr.can_family = AF_CAN;
+  addr.can_ifindex = ifr.ifr_ifindex;
+  if (::bind(this->fd_, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0) {
+    ESP_LOGE(TAG, "Could not bind to %s: %s", this->interface_.c_str(), strerror(errno));
+    ::close(this->fd_);
+    this->fd_ = -1;
+    return false;
+  }
+  ::fcntl(this->fd_, F_SETFL, ::fcntl(this->fd_, F_GETFL) | O_NONBLOCK);
+  return true;
+}
+
+void SocketCan::dump_config() {
+  canbus::Canbus::dump_config();
+  ESP_LOGCONFIG(TAG, "  Interface: %s", this->interface_.c_str());
+  ESP_LOGCONFIG(TAG, "  The bit rate is set on the interface, e.g. with ip link");
+}
+
+canbus::Error SocketCan::send_message(struct canbus::CanFrame *frame) {
+  if (this->fd_ < 0)
+    return canbus::ERROR_FAILTX;
+  if (frame->can_data_length_code > canbus::CAN_MAX_DATA_LENGTH)
+    return canbus::ERROR_FAILTX;
+
+  struct can_frame message {};
+  message.can_id = frame->can_id;
+  if (frame->use_extended_id)
+    message.can_id |= CAN_EFF_FLAG;
+  if (frame->remote_transmission_request)
+    message.can_id |= CAN_RTR_FLAG;
+  message.can_dlc = frame->can_data_length_code;
+  if (!frame->remote_transmission_request)
+    memcpy(message.data, frame->data, frame->can_data_length_code);
+
+  if (::write(this->fd_, &message, sizeof(message)) != sizeof(message)) {
+    // the transmit queue of the interface is full
+    return canbus::ERROR_ALLTXBUSY;
+  }
+  return canbus::ERROR_OK;
+}
+
+canbus::Error SocketCan::read_message(struct canbus::CanFrame *frame) {
+  if (this->fd_ < 0)
+    return canbus::ERROR_NOMSG;
+
+  struct can_frame message;
+  if (::read(this->fd_, &message, sizeof(message)) != sizeof(message))
+    return canbus::ERROR_NOMSG;
+
+  frame->use_extended_id = message.can_id & CAN_EFF_FLAG;
+  frame->remote_transmission_request = message.can_id & CAN_RTR_FLAG;
+  frame->can_id = message.can_id & (frame->use_extended_id ? CAN_EFF_MASK : CAN_SFF_MASK);
+  frame->can_data_length_code = std::min<uint8_t>(message.can_dlc, canbus::CAN_MAX_DATA_LENGTH);
+  if (!frame->remote_transmission_request)
+    memcpy(frame->data, message.data, frame->can_data_length_code);
+  return canbus::ERROR_OK;
+}
+
+void SocketCan::set_filters(const std::vector<canbus::CanFilter> &filters) {
+  if (this->fd_ < 0)
+    return;
+  // the kernel matches every trigger filter exactly, including the frame type
+  std::vector<struct can_filter> raw_filters;
+  raw_filters.reserve(filters.size());
+  for (const auto &filter : filters) {
+    struct can_filter raw {};
+    raw.can_id = filter.id;
+    raw.can_mask = filter.mask & (filter.use_extended_id ? CAN_EFF_MASK : CAN_SFF_MASK);
+    raw.can_mask |= CAN_EFF_FLAG;
+    if (filter.use_extended_id)
+      raw.can_id |= CAN_EFF_FLAG;
+    raw_filters.push_back(raw);
+  }
+  if (::setsockopt(this->fd_, SOL_CAN_RAW, CAN_RAW_FILTER, raw_filters.data(),
+                   raw_filters.size() * sizeof(struct can_filter)) < 0) {
+    ESP_LOGW(TAG, "Setting the acceptance filters failed: %s", strerror(errno));
+    return;
+  }
+  ESP_LOGD(TAG, "Receiving frames matching %u filter(s)", (unsigned) raw_filters.size());
+}
+
+}  // namespace socketcan
+}  // namespace esphome
+
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#if defined(USE_HOST) && defined(__linux__)
+
+#include "esphome/components/canbus/canbus.h"
+#include "esphome/core/component.h"
+
+#include <string>
+
+namespace esphome {
+namespace socketcan {
+
+/// CAN bus backed by a Linux SocketCAN interface of the host, e.g. a virtual `vcan0` or a USB adapter.
+class SocketCan : public canbus::Canbus {
+ public:
+  void set_interface(const std::string &interface) { this->interface_ = interface; }
+  void dump_config() override;
+
+ protected:
+  bool setup_internal() override;
+  canbus::Error send_message(struct canbus::CanFrame *frame) override;
+  canbus::Error read_message(struct canbus::CanFrame *frame) override;
+  void set_filters(const std::vector<canbus::CanFilter> &filters) override;
+
+  std::string interface_;
+  int fd_{-1};
+};
+
+}  // namespace socketcan
+}  // namespace esphome
+
+#endif
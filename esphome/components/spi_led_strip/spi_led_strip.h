@@ -80,6 +80,16 @@ class SpiLedStrip : public light::AddressableLight,
     return {this->buf_ + pos + 2,       this->buf_ + pos + 1, this->buf_ + pos + 0, nullptr,
             this->effect_data_ + index, &this->correction_};
   }
+  bool get_pixel_layout_(light::AddressablePixelLayout &layout) const override {
+    // every LED is a brightness byte followed by blue, green and red
+    layout.pixels = this->buf_ + 5;
+    layout.stride = 4;
+    layout.offsets[0] = 2;
+    layout.offsets[1] = 1;
+    layout.offsets[2] = 0;
+    layout.has_white = false;
+    return true;
+  }
 
   size_t buffer_size_{};
   uint8_t *effect_data_{nullptr};
@@ -148,11 +148,13 @@ void ST7789V::update() {
 
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
-void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+void ST7789V::write_display_data() { this->flush_dirty_regions_(); }
+
+size_t ST7789V::flush_region_internal(const display::Rect &region) {
+  uint16_t x1 = this->offset_height_ + region.x;
+  uint16_t x2 = x1 + region.w - 1;
+  uint16_t y1 = this->offset_width_ + region.y;
+  uint16_t y2 = y1 + region.h - 1;
 
   this->enable();
 
@@ -174,10 +176,11 @@ void ST7789V::write_display_data() {
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (int line = region.y; line < region.y2(); line++) {
+      const uint8_t *row = this->buffer_ + line * this->get_width_internal();
+      for (int index = region.x; index < region.x2(); ++index) {
         auto color = display::ColorUtil::color_to_565(
-            display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
+            display::ColorUtil::to_color(row[index], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
         temp_buffer[temp_index++] = (uint8_t) (color >> 8);
         temp_buffer[temp_index++] = (uint8_t) color;
@@ -189,11 +192,16 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (region.w == this->get_width_internal()) {
+    // full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + region.y * this->get_width_internal() * 2, region.w * region.h * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int line = region.y; line < region.y2(); line++)
+      this->write_array(this->buffer_ + (line * this->get_width_internal() + region.x) * 2, region.w * 2);
   }
 
   this->disable();
+  return size_t(region.w) * region.h * 2;
 }
 
 void ST7789V::init_reset_() {
@@ -296,13 +304,19 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
+    if (this->buffer_[pos] == ((color565 >> 8) & 0xff) && this->buffer_[pos + 1] == (color565 & 0xff))
+      return;
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  // only send what changed on the next update
+  this->mark_dirty_(x, y, x, y);
 }
 
 }  // namespace st7789v
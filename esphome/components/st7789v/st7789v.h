@@ -164,6 +164,7 @@ class ST7789V : public display::DisplayBuffer,
   void draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  size_t flush_region_internal(const display::Rect &region) override;
 
   const char *model_str_;
 };
@@ -1,4 +1,5 @@
 #include "switch.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -52,7 +53,8 @@ void Switch::publish_state(bool state) {
   if (restore_mode & RESTORE_MODE_PERSISTENT_MASK)
     this->rtc_.save(&this->state);
 
-  ESP_LOGD(TAG, "'%s': Sending state %s", this->name_.c_str(), ONOFF(this->state));
+  ESP_LOGD(TAG, "'%s': Sending state %s", this->get_name().c_str(), ONOFF(this->state));
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_SWITCH, this->get_entity_index());
   this->state_callback_.call(this->state);
 }
 bool Switch::assumed_state() { return false; }
@@ -68,7 +68,7 @@ void TemplateAlarmControlPanel::dump_config() {
 }
 
 void TemplateAlarmControlPanel::setup() {
-  ESP_LOGCONFIG(TAG, "Setting up Template AlarmControlPanel '%s'...", this->name_.c_str());
+  ESP_LOGCONFIG(TAG, "Setting up Template AlarmControlPanel '%s'...", this->get_name().c_str());
   switch (this->restore_mode_) {
     case ALARM_CONTROL_PANEL_ALWAYS_DISARMED:
       this->current_state_ = ACP_STATE_DISARMED;
@@ -1,4 +1,5 @@
 #include "text.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -15,6 +16,7 @@ void Text::publish_state(const std::string &state) {
   } else {
     ESP_LOGD(TAG, "'%s': Sending state %s", this->get_name().c_str(), state.c_str());
   }
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_TEXT, this->get_entity_index());
   this->state_callback_.call(state);
 }
 
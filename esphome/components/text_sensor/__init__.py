@@ -17,7 +17,7 @@ from esphome.const import (
 )
 from esphome.core import CORE, coroutine_with_priority
 from esphome.cpp_generator import MockObjClass
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import get_adaptive_poller, setup_entity
 from esphome.util import Registry
 
 
@@ -161,9 +161,18 @@ async def build_filters(config):
     return await cg.build_registry_list(FILTER_REGISTRY, config)
 
 
+async def _setup_adaptive_polling(var, poller_id):
+    poller = await cg.get_variable(poller_id)
+    cg.add(var.set_adaptive_polling(poller))
+
+
 async def setup_text_sensor_core_(var, config):
     await setup_entity(var, config)
 
+    poller_id = get_adaptive_poller(config)
+    if poller_id is not None:
+        CORE.add_job(_setup_adaptive_polling, var, poller_id)
+
     if config.get(CONF_FILTERS):  # must exist and not be empty
         filters = await build_filters(config[CONF_FILTERS])
         cg.add(var.set_filters(filters))
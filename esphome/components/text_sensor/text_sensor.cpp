@@ -1,4 +1,5 @@
 #include "text_sensor.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -7,10 +8,12 @@ namespace text_sensor {
 static const char *const TAG = "text_sensor";
 
 void TextSensor::publish_state(const std::string &state) {
+  if (this->poller_ != nullptr)
+    this->poller_->report_reading(state != this->raw_state);
   this->raw_state = state;
   this->raw_callback_.call(state);
 
-  ESP_LOGV(TAG, "'%s': Received new state %s", this->name_.c_str(), state.c_str());
+  ESP_LOGV(TAG, "'%s': Received new state %s", this->get_name().c_str(), state.c_str());
 
   if (this->filter_list_ == nullptr) {
     this->internal_send_state_to_frontend(state);
@@ -61,7 +64,8 @@ std::string TextSensor::get_raw_state() const { return this->raw_state; }
 void TextSensor::internal_send_state_to_frontend(const std::string &state) {
   this->state = state;
   this->has_state_ = true;
-  ESP_LOGD(TAG, "'%s': Sending state '%s'", this->name_.c_str(), state.c_str());
+  ESP_LOGD(TAG, "'%s': Sending state '%s'", this->get_name().c_str(), state.c_str());
+  global_entity_change_bus.mark_changed(ENTITY_TYPE_TEXT_SENSOR, this->get_entity_index());
   this->callback_.call(state);
 }
 
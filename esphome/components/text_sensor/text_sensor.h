@@ -53,6 +53,9 @@ class TextSensor : public EntityBase {
   /// Add a callback that will be called every time the sensor sends a raw value.
   void add_on_raw_state_callback(std::function<void(std::string)> callback);
 
+  /// Report raw values to `poller` for adaptive polling, a value that differs from the previous one counts as changed.
+  void set_adaptive_polling(PollingComponent *poller) { this->poller_ = poller; }
+
   std::string state;
   std::string raw_state;
 
@@ -74,6 +77,8 @@ class TextSensor : public EntityBase {
 
   Filter *filter_list_{nullptr};  ///< Store all active filters.
 
+  PollingComponent *poller_{nullptr};  ///< Component notified of raw values for adaptive polling.
+
   bool has_state_{false};
 };
 
@@ -24,6 +24,11 @@ void RealTimeClock::call_setup() {
   PollingComponent::call_setup();
 }
 void RealTimeClock::synchronize_epoch_(uint32_t epoch) {
+#ifdef USE_HOST_VIRTUAL_TIME
+  // the simulation keeps running from the synchronized time
+  arch_set_epoch(epoch);
+  int ret = 0;
+#else
   // Update UTC epoch time.
   struct timeval timev {
     .tv_sec = static_cast<time_t>(epoch), .tv_usec = 0,
@@ -36,6 +41,7 @@ void RealTimeClock::synchronize_epoch_(uint32_t epoch) {
     // while ESP32 expects it not to be NULL
     ret = settimeofday(&timev, nullptr);
   }
+#endif
 
   // Move timezone back to local timezone.
   this->apply_timezone_();
@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/time.h"
 
@@ -33,7 +34,13 @@ class RealTimeClock : public PollingComponent {
   ESPTime utcnow() { return ESPTime::from_epoch_utc(this->timestamp_now()); }
 
   /// Get the current time as the UTC epoch since January 1st 1970.
-  time_t timestamp_now() { return ::time(nullptr); }
+  time_t timestamp_now() {
+#ifdef USE_HOST_VIRTUAL_TIME
+    return arch_get_epoch();
+#else
+    return ::time(nullptr);
+#endif
+  }
 
   void call_setup() override;
 
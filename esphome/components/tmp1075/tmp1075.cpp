@@ -20,12 +20,12 @@ static float regvalue2temp(uint16_t regvalue);
 void TMP1075Sensor::setup() {
   uint8_t die_id;
   if (!this->read_byte(REG_DIEID, &die_id)) {
-    ESP_LOGW(TAG, "'%s' - unable to read ID", this->name_.c_str());
+    ESP_LOGW(TAG, "'%s' - unable to read ID", this->get_name().c_str());
     this->mark_failed();
     return;
   }
   if (die_id != EXPECT_DIEID) {
-    ESP_LOGW(TAG, "'%s' - unexpected ID 0x%x found, expected 0x%x", this->name_.c_str(), die_id, EXPECT_DIEID);
+    ESP_LOGW(TAG, "'%s' - unexpected ID 0x%x found, expected 0x%x", this->get_name().c_str(), die_id, EXPECT_DIEID);
     this->mark_failed();
     return;
   }
@@ -36,7 +36,7 @@ void TMP1075Sensor::setup() {
 void TMP1075Sensor::update() {
   uint16_t regvalue;
   if (!read_byte_16(REG_TEMP, &regvalue)) {
-    ESP_LOGW(TAG, "'%s' - unable to read temperature register", this->name_.c_str());
+    ESP_LOGW(TAG, "'%s' - unable to read temperature register", this->get_name().c_str());
     this->status_set_warning();
     return;
   }
@@ -63,11 +63,11 @@ void TMP1075Sensor::dump_config() {
 
 void TMP1075Sensor::set_fault_count(const int faults) {
   if (faults < 1) {
-    ESP_LOGE(TAG, "'%s' - fault_count too low: %d", this->name_.c_str(), faults);
+    ESP_LOGE(TAG, "'%s' - fault_count too low: %d", this->get_name().c_str(), faults);
     return;
   }
   if (faults > 4) {
-    ESP_LOGE(TAG, "'%s' - fault_count too high: %d", this->name_.c_str(), faults);
+    ESP_LOGE(TAG, "'%s' - fault_count too high: %d", this->get_name().c_str(), faults);
     return;
   }
   config_.fields.faults = faults - 1;
@@ -89,28 +89,28 @@ void TMP1075Sensor::write_config() {
 }
 
 void TMP1075Sensor::send_config_() {
-  ESP_LOGV(TAG, "'%s' - sending configuration %04x", this->name_.c_str(), config_.regvalue);
+  ESP_LOGV(TAG, "'%s' - sending configuration %04x", this->get_name().c_str(), config_.regvalue);
   log_config_();
   if (!this->write_byte_16(REG_CFGR, config_.regvalue)) {
-    ESP_LOGW(TAG, "'%s' - unable to write configuration register", this->name_.c_str());
+    ESP_LOGW(TAG, "'%s' - unable to write configuration register", this->get_name().c_str());
     return;
   }
 }
 
 void TMP1075Sensor::send_alert_limit_low_() {
-  ESP_LOGV(TAG, "'%s' - sending alert limit low %.3f °C", this->name_.c_str(), alert_limit_low_);
+  ESP_LOGV(TAG, "'%s' - sending alert limit low %.3f °C", this->get_name().c_str(), alert_limit_low_);
   const uint16_t regvalue = temp2regvalue(alert_limit_low_);
   if (!this->write_byte_16(REG_LLIM, regvalue)) {
-    ESP_LOGW(TAG, "'%s' - unable to write low limit register", this->name_.c_str());
+    ESP_LOGW(TAG, "'%s' - unable to write low limit register", this->get_name().c_str());
     return;
   }
 }
 
 void TMP1075Sensor::send_alert_limit_high_() {
-  ESP_LOGV(TAG, "'%s' - sending alert limit high %.3f °C", this->name_.c_str(), alert_limit_high_);
+  ESP_LOGV(TAG, "'%s' - sending alert limit high %.3f °C", this->get_name().c_str(), alert_limit_high_);
   const uint16_t regvalue = temp2regvalue(alert_limit_high_);
   if (!this->write_byte_16(REG_HLIM, regvalue)) {
-    ESP_LOGW(TAG, "'%s' - unable to write high limit register", this->name_.c_str());
+    ESP_LOGW(TAG, "'%s' - unable to write high limit register", this->get_name().c_str());
     return;
   }
 }
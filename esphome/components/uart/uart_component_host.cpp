@@ -0,0 +1,171 @@
+#ifdef USE_HOST
+
+#include "uart_component_host.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace esphome {
+namespace uart {
+
+static const char *const TAG = "uart.host";
+
+static speed_t baud_rate_to_speed(uint32_t baud_rate) {
+  switch (baud_rate) {
+    case 1200:
+      return B1200;
+    case 2400:
+      return B2400;
+    case 4800:
+      return B4800;
+    case 9600:
+      return B9600;
+    case 19200:
+      return B19200;
+    case 38400:
+      return B38400;
+    case 57600:
+      return B57600;
+    case 115200:
+      return B115200;
+    case 230400:
+      return B230400;
+    default:
+      return B0;
+  }
+}
+
+void HostUartComponent::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up UART %s...", this->port_.c_str());
+  this->fd_ = ::open(this->port_.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (this->fd_ < 0) {
+    ESP_LOGE(TAG, "Could not open %s: %s", this->port_.c_str(), strerror(errno));
+    this->mark_failed();
+    return;
+  }
+
+  struct termios tty;
+  if (tcgetattr(this->fd_, &tty) != 0) {
+    // not a terminal (e.g. a fifo), there is nothing to configure
+    return;
+  }
+  cfmakeraw(&tty);
+  speed_t speed = baud_rate_to_speed(this->baud_rate_);
+  if (speed == B0) {
+    ESP_LOGW(TAG, "Baud rate %" PRIu32 " is not supported, using 9600", this->baud_rate_);
+    speed = B9600;
+  }
+  cfsetispeed(&tty, speed);
+  cfsetospeed(&tty, speed);
+
+  tty.c_cflag &= ~(CSIZE | PARENB | PARODD | CSTOPB);
+  switch (this->data_bits_) {
+    case 5:
+      tty.c_cflag |= CS5;
+      break;
+    case 6:
+      tty.c_cflag |= CS6;
+      break;
+    case 7:
+      tty.c_cflag |= CS7;
+      break;
+    default:
+      tty.c_cflag |= CS8;
+      break;
+  }
+  if (this->parity_ == UART_CONFIG_PARITY_EVEN) {
+    tty.c_cflag |= PARENB;
+  } else if (this->parity_ == UART_CONFIG_PARITY_ODD) {
+    tty.c_cflag |= PARENB | PARODD;
+  }
+  if (this->stop_bits_ == 2)
+    tty.c_cflag |= CSTOPB;
+  tty.c_cflag |= CREAD | CLOCAL;
+
+  if (tcsetattr(this->fd_, TCSANOW, &tty) != 0)
+    ESP_LOGW(TAG, "Could not configure %s: %s", this->port_.c_str(), strerror(errno));
+}
+
+void HostUartComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "UART Bus:");
+  ESP_LOGCONFIG(TAG, "  Port: %s", this->port_.c_str());
+  ESP_LOGCONFIG(TAG, "  Baud Rate: %" PRIu32 " baud", this->baud_rate_);
+  ESP_LOGCONFIG(TAG, "  Data Bits: %u", this->data_bits_);
+  ESP_LOGCONFIG(TAG, "  Parity: %s", LOG_STR_ARG(parity_to_str(this->parity_)));
+  ESP_LOGCONFIG(TAG, "  Stop bits: %u", this->stop_bits_);
+  if (this->is_failed())
+    ESP_LOGE(TAG, "  Could not open the port!");
+}
+
+void HostUartComponent::write_array(const uint8_t *data, size_t len) {
+  if (this->fd_ < 0)
+    return;
+  size_t written = 0;
+  while (written < len) {
+    ssize_t ret = ::write(this->fd_, data + written, len - written);
+    if (ret < 0) {
+      if (errno == EAGAIN || errno == EINTR)
+        continue;
+      ESP_LOGW(TAG, "Writing to %s failed: %s", this->port_.c_str(), strerror(errno));
+      return;
+    }
+    written += ret;
+  }
+#ifdef USE_UART_DEBUGGER
+  for (size_t i = 0; i < len; i++) {
+    this->debug_callback_.call(UART_DIRECTION_TX, data[i]);
+  }
+#endif
+}
+
+void HostUartComponent::read_port_() {
+  if (this->fd_ < 0)
+    return;
+  uint8_t buffer[64];
+  ssize_t ret;
+  while ((ret = ::read(this->fd_, buffer, sizeof(buffer))) > 0) {
+    this->rx_buffer_.insert(this->rx_buffer_.end(), buffer, buffer + ret);
+  }
+}
+
+bool HostUartComponent::peek_byte(uint8_t *data) {
+  if (!this->check_read_timeout_())
+    return false;
+  *data = this->rx_buffer_.front();
+  return true;
+}
+
+bool HostUartComponent::read_array(uint8_t *data, size_t len) {
+  if (!this->check_read_timeout_(len))
+    return false;
+  std::copy(this->rx_buffer_.begin(), this->rx_buffer_.begin() + len, data);
+  this->rx_buffer_.erase(this->rx_buffer_.begin(), this->rx_buffer_.begin() + len);
+#ifdef USE_UART_DEBUGGER
+  for (size_t i = 0; i < len; i++) {
+    this->debug_callback_.call(UART_DIRECTION_RX, data[i]);
+  }
+#endif
+  return true;
+}
+
+int HostUartComponent::available() {
+  this->read_port_();
+  return this->rx_buffer_.size();
+}
+
+void HostUartComponent::flush() {
+  ESP_LOGVV(TAG, "    Flushing...");
+  if (this->fd_ >= 0)
+    tcdrain(this->fd_);
+}
+
+}  // namespace uart
+}  // namespace esphome
+
+#endif  // USE_HOST
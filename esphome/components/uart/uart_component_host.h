@@ -0,0 +1,45 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include <deque>
+#include <string>
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "uart_component.h"
+
+namespace esphome {
+namespace uart {
+
+/// UART bus backed by a serial device or pseudo-terminal of the host, e.g. `/dev/ttyUSB0` or `/dev/pts/3`.
+class HostUartComponent : public UARTComponent, public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  void write_array(const uint8_t *data, size_t len) override;
+
+  bool peek_byte(uint8_t *data) override;
+  bool read_array(uint8_t *data, size_t len) override;
+
+  int available() override;
+  void flush() override;
+
+  void set_port(const std::string &port) { this->port_ = port; }
+
+ protected:
+  void check_logger_conflict() override {}
+  /// move everything the port has received into rx_buffer_
+  void read_port_();
+
+  std::string port_;
+  int fd_{-1};
+  std::deque<uint8_t> rx_buffer_;
+};
+
+}  // namespace uart
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -29,7 +29,7 @@ void VoiceAssistant::setup() {
 
   global_voice_assistant = this;
 
-  this->socket_ = socket::socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+  this->socket_ = socket::socket_loop_monitored(AF_INET, SOCK_DGRAM, IPPROTO_IP);
   if (socket_ == nullptr) {
     ESP_LOGW(TAG, "Could not create socket");
     this->mark_failed();
@@ -264,7 +264,10 @@ void VoiceAssistant::loop() {
 #ifdef USE_SPEAKER
       if (this->speaker_ != nullptr) {
         ssize_t received_len = 0;
-        if (this->speaker_buffer_index_ + RECEIVE_SIZE < SPEAKER_BUFFER_SIZE) {
+        if (!this->socket_->ready()) {
+          // nothing arrived, same as a read returning EAGAIN
+          received_len = -1;
+        } else if (this->speaker_buffer_index_ + RECEIVE_SIZE < SPEAKER_BUFFER_SIZE) {
           received_len = this->socket_->read(this->speaker_buffer_ + this->speaker_buffer_index_, RECEIVE_SIZE);
           if (received_len > 0) {
             this->speaker_buffer_index_ += received_len;
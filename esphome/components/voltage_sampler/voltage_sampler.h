@@ -2,6 +2,8 @@
 
 #include "esphome/core/component.h"
 
+#include <cstddef>
+
 namespace esphome {
 namespace voltage_sampler {
 
@@ -10,6 +12,17 @@ class VoltageSampler {
  public:
   /// Get a voltage reading, in V.
   virtual float sample() = 0;
+
+  /** Take up to `count` consecutive voltage readings in V as fast as the source allows them.
+   *
+   * Returns the number of readings written to `buffer`. The default implementation calls sample() in a tight loop,
+   * sources with a faster path for consecutive readings can override it.
+   */
+  virtual size_t sample_block(float *buffer, size_t count) {
+    for (size_t i = 0; i < count; i++)
+      buffer[i] = this->sample();
+    return count;
+  }
 };
 
 }  // namespace voltage_sampler
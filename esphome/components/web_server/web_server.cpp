@@ -146,6 +146,7 @@ void WebServer::setup() {
   this->set_interval(10000, [this]() { this->events_.send("", "ping", millis(), 30000); });
 }
 void WebServer::loop() {
+  this->process_entity_updates();
 #ifdef USE_ESP32
   if (xSemaphoreTake(this->to_schedule_lock_, 0L)) {
     std::function<void()> fn;
@@ -25,6 +25,7 @@ from esphome.const import (
     CONF_ICON,
     CONF_ID,
     CONF_INTERNAL,
+    CONF_MAX_UPDATE_INTERVAL,
     CONF_NAME,
     CONF_PAYLOAD_AVAILABLE,
     CONF_PAYLOAD_NOT_AVAILABLE,
@@ -1827,6 +1828,7 @@ def polling_component_schema(default_update_interval):
         return COMPONENT_SCHEMA.extend(
             {
                 Required(CONF_UPDATE_INTERVAL): default_update_interval,
+                Optional(CONF_MAX_UPDATE_INTERVAL): positive_time_period_milliseconds,
             }
         )
     assert isinstance(default_update_interval, str)
@@ -1835,6 +1837,7 @@ def polling_component_schema(default_update_interval):
             Optional(
                 CONF_UPDATE_INTERVAL, default=default_update_interval
             ): update_interval,
+            Optional(CONF_MAX_UPDATE_INTERVAL): positive_time_period_milliseconds,
         }
     )
 
@@ -429,6 +429,7 @@ CONF_MAX_RANGE = "max_range"
 CONF_MAX_REFRESH_RATE = "max_refresh_rate"
 CONF_MAX_SPEED = "max_speed"
 CONF_MAX_TEMPERATURE = "max_temperature"
+CONF_MAX_UPDATE_INTERVAL = "max_update_interval"
 CONF_MAX_VALUE = "max_value"
 CONF_MAX_VOLTAGE = "max_voltage"
 CONF_MDNS = "mdns"
@@ -603,6 +604,7 @@ CONF_PMC_1_0 = "pmc_1_0"
 CONF_PMC_10_0 = "pmc_10_0"
 CONF_PMC_2_5 = "pmc_2_5"
 CONF_PMC_4_0 = "pmc_4_0"
+CONF_POLLING_DELTA = "polling_delta"
 CONF_PORT = "port"
 CONF_POSITION = "position"
 CONF_POSITION_ACTION = "position_action"
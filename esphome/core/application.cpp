@@ -3,10 +3,17 @@
 #include "esphome/core/version.h"
 #include "esphome/core/hal.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 #ifdef USE_STATUS_LED
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+#include "esphome/components/socket/socket_registry.h"
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
@@ -32,35 +39,120 @@ void Application::setup() {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
   });
 
-  for (uint32_t i = 0; i < this->components_.size(); i++) {
-    Component *component = this->components_[i];
+  struct SetupTiming {
+    Component *component;
+    uint32_t started;  ///< ms since the start of setup()
+    uint32_t duration;
+    uint32_t ready;  ///< ms since the start of setup() until the component could proceed
+  };
+  const uint32_t setup_start = millis();
+  std::vector<Component *> pending = this->components_;
+  // components that are set up, but can't proceed yet
+  std::vector<Component *> waiting;
+  std::vector<SetupTiming> timings;
+  timings.reserve(pending.size());
+  // the components that are set up, in the order they loop
+  std::vector<Component *> running;
+  running.reserve(pending.size());
+  auto by_loop_priority = [](const Component *a, const Component *b) {
+    return a->get_loop_priority() > b->get_loop_priority();
+  };
 
-    component->call();
-    this->scheduler.process_to_add();
-    this->feed_wdt();
-    if (component->can_proceed())
-      continue;
+  auto contains = [](const std::vector<Component *> &components, Component *component) {
+    return std::find(components.begin(), components.end(), component) != components.end();
+  };
+  auto is_blocked = [&](Component *component) {
+    if (!this->parallel_setup_)
+      return !waiting.empty();
+    for (auto &dependency : this->setup_dependencies_) {
+      if (dependency.first != component)
+        continue;
+      if (contains(pending, dependency.second) || contains(waiting, dependency.second))
+        return true;
+    }
+    return false;
+  };
+  auto update_waiting = [&]() {
+    for (auto it = waiting.begin(); it != waiting.end();) {
+      if (!(*it)->can_proceed()) {
+        it++;
+        continue;
+      }
+      for (auto &timing : timings) {
+        if (timing.component == *it)
+          timing.ready = millis() - setup_start;
+      }
+      it = waiting.erase(it);
+    }
+  };
 
-    std::stable_sort(this->components_.begin(), this->components_.begin() + i + 1,
-                     [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); });
+  bool force = false;
+  while (true) {
+    bool started = false;
+    for (auto it = pending.begin(); it != pending.end();) {
+      Component *component = *it;
+      if (!force && is_blocked(component)) {
+        // without dependencies the components are set up strictly in order
+        if (!this->parallel_setup_)
+          break;
+        it++;
+        continue;
+      }
+      it = pending.erase(it);
+      force = false;
+      started = true;
 
-    do {
-      uint32_t new_app_state = STATUS_LED_WARNING;
-      this->scheduler.call();
+      uint32_t start = millis();
+      component->call();
+      this->scheduler.process_to_add();
       this->feed_wdt();
-      for (uint32_t j = 0; j <= i; j++) {
-        this->components_[j]->call();
-        new_app_state |= this->components_[j]->get_component_state();
-        this->app_state_ |= new_app_state;
-        this->feed_wdt();
+      uint32_t now = millis();
+      timings.push_back({component, start - setup_start, now - start, now - setup_start});
+      running.insert(std::upper_bound(running.begin(), running.end(), component, by_loop_priority), component);
+      if (!component->can_proceed())
+        waiting.push_back(component);
+    }
+    if (pending.empty() && waiting.empty())
+      break;
+    if (waiting.empty()) {
+      // a component may depend on one that comes later in the setup order
+      if (!started) {
+        // nothing to wait for, but the remaining components all depend on each other
+        ESP_LOGW(TAG, "Setup dependency cycle, setting up %s anyway", pending.front()->get_component_source());
+        force = true;
       }
-      this->app_state_ = new_app_state;
-      yield();
-    } while (!component->can_proceed());
+      continue;
+    }
+
+    // run the components that are set up while the others wait
+    uint32_t new_app_state = STATUS_LED_WARNING;
+    this->scheduler.call();
+    this->feed_wdt();
+    for (auto *component : running) {
+      component->call();
+      new_app_state |= component->get_component_state();
+      this->app_state_ |= new_app_state;
+      this->feed_wdt();
+    }
+    this->app_state_ = new_app_state;
+    yield();
+    update_waiting();
   }
+  this->setup_dependencies_.clear();
+  this->setup_dependencies_.shrink_to_fit();
 
-  ESP_LOGI(TAG, "setup() finished successfully!");
+  ESP_LOGI(TAG, "setup() finished successfully in %" PRIu32 " ms!", millis() - setup_start);
+  for (auto &timing : timings) {
+    // only the components that took a while are of interest
+    if (timing.duration == 0 && timing.ready == timing.started) {
+      ESP_LOGV(TAG, "  %s: set up at %" PRIu32 " ms", timing.component->get_component_source(), timing.started);
+      continue;
+    }
+    ESP_LOGD(TAG, "  %s: set up at %" PRIu32 " ms, setup took %" PRIu32 " ms, ready at %" PRIu32 " ms",
+             timing.component->get_component_source(), timing.started, timing.duration, timing.ready);
+  }
   this->schedule_dump_config();
+  std::stable_sort(this->components_.begin(), this->components_.end(), by_loop_priority);
   this->calculate_looping_components_();
 }
 void Application::loop() {
@@ -82,8 +174,22 @@ void Application::loop() {
   const uint32_t now = millis();
 
   if (HighFrequencyLoopRequester::is_high_frequency()) {
+#ifdef USE_HOST_VIRTUAL_TIME
+    // the components that requested the high frequency loop poll for something to happen, the simulated clock must not
+    // jump past it and moves by 1 ms per iteration
+    delay(1);
+#else
     yield();
+#endif
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    // only poll, so the sockets that became readable are serviced in the next iteration
+    socket::global_socket_registry.wait(0);
+#endif
   } else {
+#ifdef USE_HOST_VIRTUAL_TIME
+    // simulated time jumps straight to the next timer, the loops in between would only see the same state
+    uint32_t delay_time = std::max<uint32_t>(this->scheduler.next_schedule_in().value_or(this->loop_interval_), 1);
+#else
     uint32_t delay_time = this->loop_interval_;
     if (now - this->last_loop_ < this->loop_interval_)
       delay_time = this->loop_interval_ - (now - this->last_loop_);
@@ -93,7 +199,13 @@ void Application::loop() {
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
+#endif
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    // wake up early when a monitored socket becomes readable
+    socket::global_socket_registry.wait(delay_time);
+#else
     delay(delay_time);
+#endif
   }
   this->last_loop_ = now;
 
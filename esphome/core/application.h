@@ -1,9 +1,11 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
+#include "esphome/core/entity_change_bus.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/preferences.h"
@@ -81,16 +83,23 @@ class Application {
 
 #ifdef USE_BINARY_SENSOR
   void register_binary_sensor(binary_sensor::BinarySensor *binary_sensor) {
+    binary_sensor->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_BINARY_SENSOR));
     this->binary_sensors_.push_back(binary_sensor);
   }
 #endif
 
 #ifdef USE_SENSOR
-  void register_sensor(sensor::Sensor *sensor) { this->sensors_.push_back(sensor); }
+  void register_sensor(sensor::Sensor *sensor) {
+    sensor->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_SENSOR));
+    this->sensors_.push_back(sensor);
+  }
 #endif
 
 #ifdef USE_SWITCH
-  void register_switch(switch_::Switch *a_switch) { this->switches_.push_back(a_switch); }
+  void register_switch(switch_::Switch *a_switch) {
+    a_switch->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_SWITCH));
+    this->switches_.push_back(a_switch);
+  }
 #endif
 
 #ifdef USE_BUTTON
@@ -98,47 +107,78 @@ class Application {
 #endif
 
 #ifdef USE_TEXT_SENSOR
-  void register_text_sensor(text_sensor::TextSensor *sensor) { this->text_sensors_.push_back(sensor); }
+  void register_text_sensor(text_sensor::TextSensor *sensor) {
+    sensor->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_TEXT_SENSOR));
+    this->text_sensors_.push_back(sensor);
+  }
 #endif
 
 #ifdef USE_FAN
-  void register_fan(fan::Fan *state) { this->fans_.push_back(state); }
+  void register_fan(fan::Fan *state) {
+    state->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_FAN));
+    this->fans_.push_back(state);
+  }
 #endif
 
 #ifdef USE_COVER
-  void register_cover(cover::Cover *cover) { this->covers_.push_back(cover); }
+  void register_cover(cover::Cover *cover) {
+    cover->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_COVER));
+    this->covers_.push_back(cover);
+  }
 #endif
 
 #ifdef USE_CLIMATE
-  void register_climate(climate::Climate *climate) { this->climates_.push_back(climate); }
+  void register_climate(climate::Climate *climate) {
+    climate->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_CLIMATE));
+    this->climates_.push_back(climate);
+  }
 #endif
 
 #ifdef USE_LIGHT
-  void register_light(light::LightState *light) { this->lights_.push_back(light); }
+  void register_light(light::LightState *light) {
+    light->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_LIGHT));
+    this->lights_.push_back(light);
+  }
 #endif
 
 #ifdef USE_NUMBER
-  void register_number(number::Number *number) { this->numbers_.push_back(number); }
+  void register_number(number::Number *number) {
+    number->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_NUMBER));
+    this->numbers_.push_back(number);
+  }
 #endif
 
 #ifdef USE_TEXT
-  void register_text(text::Text *text) { this->texts_.push_back(text); }
+  void register_text(text::Text *text) {
+    text->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_TEXT));
+    this->texts_.push_back(text);
+  }
 #endif
 
 #ifdef USE_SELECT
-  void register_select(select::Select *select) { this->selects_.push_back(select); }
+  void register_select(select::Select *select) {
+    select->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_SELECT));
+    this->selects_.push_back(select);
+  }
 #endif
 
 #ifdef USE_LOCK
-  void register_lock(lock::Lock *a_lock) { this->locks_.push_back(a_lock); }
+  void register_lock(lock::Lock *a_lock) {
+    a_lock->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_LOCK));
+    this->locks_.push_back(a_lock);
+  }
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-  void register_media_player(media_player::MediaPlayer *media_player) { this->media_players_.push_back(media_player); }
+  void register_media_player(media_player::MediaPlayer *media_player) {
+    media_player->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_MEDIA_PLAYER));
+    this->media_players_.push_back(media_player);
+  }
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
   void register_alarm_control_panel(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
+    a_alarm_control_panel->set_entity_index(global_entity_change_bus.register_entity(ENTITY_TYPE_ALARM_CONTROL_PANEL));
     this->alarm_control_panels_.push_back(a_alarm_control_panel);
   }
 #endif
@@ -150,6 +190,17 @@ class Application {
     return c;
   }
 
+  /** Declare that a component may only be set up once another component can proceed.
+   *
+   * With parallel setup enabled, a component that can't proceed yet (e.g. WiFi while it connects) only holds back the
+   * components that depend on it, the others are set up in the meantime. Without it all components wait for every
+   * component set up before them.
+   */
+  void add_setup_dependency(Component *component, Component *dependency) {
+    this->setup_dependencies_.emplace_back(component, dependency);
+  }
+  void set_parallel_setup(bool parallel_setup) { this->parallel_setup_ = parallel_setup; }
+
   /// Set up all the registered components. Call this at the end of your setup() function.
   void setup();
 
@@ -186,6 +237,9 @@ class Application {
    * @param loop_interval The interval in milliseconds to run the core loop at. Defaults to 16 milliseconds.
    */
   void set_loop_interval(uint32_t loop_interval) { this->loop_interval_ = loop_interval; }
+  uint32_t get_loop_interval() const { return this->loop_interval_; }
+
+  const std::vector<Component *> &get_components() const { return this->components_; }
 
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
@@ -351,6 +405,8 @@ class Application {
 
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
+  /// (component, dependency) pairs, only used during setup()
+  std::vector<std::pair<Component *, Component *>> setup_dependencies_{};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
@@ -404,6 +460,7 @@ class Application {
   const char *comment_{nullptr};
   const char *compilation_time_{nullptr};
   bool name_add_mac_suffix_;
+  bool parallel_setup_{false};
   uint32_t last_loop_{0};
   uint32_t loop_interval_{16};
   size_t dump_config_at_{SIZE_MAX};
@@ -4,6 +4,7 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include <cinttypes>
 #include <utility>
 
 namespace esphome {
@@ -79,6 +80,9 @@ void Component::call_dump_config() { this->dump_config(); }
 
 uint32_t Component::get_component_state() const { return this->component_state_; }
 void Component::call() {
+#ifdef USE_HEAP_TRACKING
+  HeapTrackingScope heap_scope{this};
+#endif
   uint32_t state = this->component_state_ & COMPONENT_STATE_MASK;
   switch (state) {
     case COMPONENT_STATE_CONSTRUCTION:
@@ -193,6 +197,16 @@ void PollingComponent::call_setup() {
 }
 
 void PollingComponent::start_poller() {
+  if (this->is_adaptive_()) {
+    // Adaptive polls reschedule themselves, starting at the configured rate.
+    this->current_update_interval_ = this->get_update_interval();
+    this->readings_reported_ = false;
+    this->readings_changed_ = false;
+    this->last_poll_ = millis();
+    this->set_timeout("update", random_uint32() % (this->current_update_interval_ / 2 + 1),
+                      [this]() { this->adaptive_poll_(); });
+    return;
+  }
   // Register interval.
   this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
 }
@@ -200,6 +214,54 @@ void PollingComponent::start_poller() {
 void PollingComponent::stop_poller() {
   // Clear the interval to suspend component
   this->cancel_interval("update");
+  this->cancel_timeout("update");
+}
+
+bool PollingComponent::is_adaptive_() const {
+  const uint32_t update_interval = this->get_update_interval();
+  return update_interval != 0 && update_interval != SCHEDULER_DONT_RUN &&
+         this->max_update_interval_ > update_interval;
+}
+
+void PollingComponent::adaptive_poll_() {
+  const uint32_t update_interval = this->get_update_interval();
+  const uint32_t now = millis();
+  const uint32_t elapsed_polls = (now - this->last_poll_) / update_interval;
+  if (elapsed_polls > 1)
+    this->saved_polls_ += elapsed_polls - 1;
+  this->last_poll_ = now;
+
+  // only back off if readings were reported since the previous poll and none of them changed
+  if (this->readings_reported_ && !this->readings_changed_ &&
+      this->current_update_interval_ < this->max_update_interval_) {
+    this->current_update_interval_ = this->current_update_interval_ >= this->max_update_interval_ / 2
+                                         ? this->max_update_interval_
+                                         : this->current_update_interval_ * 2;
+    ESP_LOGV(TAG, "Readings of %s are stable, update interval %.1fs (%" PRIu32 " polls saved)",
+             this->get_component_source(), this->current_update_interval_ / 1000.0f, this->saved_polls_);
+  }
+  this->readings_reported_ = false;
+  this->readings_changed_ = false;
+
+  this->set_timeout("update", this->current_update_interval_, [this]() { this->adaptive_poll_(); });
+  this->update();
+}
+
+void PollingComponent::report_reading(bool changed) {
+  if (!this->is_adaptive_())
+    return;
+  this->readings_reported_ = true;
+  if (!changed)
+    return;
+  this->readings_changed_ = true;
+  const uint32_t update_interval = this->get_update_interval();
+  if (this->current_update_interval_ != update_interval) {
+    // snap back to the configured rate right away
+    ESP_LOGV(TAG, "Readings of %s changed, update interval %.1fs", this->get_component_source(),
+             update_interval / 1000.0f);
+    this->current_update_interval_ = update_interval;
+    this->set_timeout("update", update_interval, [this]() { this->adaptive_poll_(); });
+  }
 }
 
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
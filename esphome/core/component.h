@@ -4,6 +4,8 @@
 #include <functional>
 #include <cmath>
 
+#include "esphome/core/defines.h"
+#include "esphome/core/heap_tracker.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -50,6 +52,9 @@ static const uint32_t SCHEDULER_DONT_RUN = 4294967295UL;
     ESP_LOGCONFIG(TAG, "  Update Interval: %.3fs", this->get_update_interval() / 1000.0f); \
   } else { \
     ESP_LOGCONFIG(TAG, "  Update Interval: %.1fs", this->get_update_interval() / 1000.0f); \
+  } \
+  if (this->get_max_update_interval() != 0) { \
+    ESP_LOGCONFIG(TAG, "  Max Update Interval: %.1fs", this->get_max_update_interval() / 1000.0f); \
   }
 
 extern const uint32_t COMPONENT_STATE_MASK;
@@ -271,6 +276,10 @@ class Component {
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
+#ifdef USE_HEAP_TRACKING
+  friend class HeapTracker;
+  HeapStats heap_stats_;
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -314,8 +323,36 @@ class PollingComponent : public Component {
   // Stop the poller, used for component.suspend
   void stop_poller();
 
+  /** Enable adaptive polling: let the update interval grow up to `max_update_interval` while readings are stable.
+   *
+   * Every poll after which all reported readings stayed within their band doubles the interval. A reading outside of
+   * its band restores the configured update interval right away. Readings are reported with report_reading(), the
+   * sensors, binary sensors and text sensors declared in the config of the component do that on their own. Without
+   * reported readings the interval doesn't grow. Filters that work on a number of readings would cover more time while
+   * the interval is longer, the config validation rejects them on the entities of the component.
+   */
+  void set_max_update_interval(uint32_t max_update_interval) { this->max_update_interval_ = max_update_interval; }
+  /// Get the maximum update interval in ms for adaptive polling, 0 if it is disabled.
+  uint32_t get_max_update_interval() const { return this->max_update_interval_; }
+  /// Report a reading of this component for adaptive polling, `changed` tells whether it left its band.
+  void report_reading(bool changed);
+  /// Number of polls saved by adaptive polling compared to polling at the configured update interval.
+  uint32_t get_saved_polls() const { return this->saved_polls_; }
+
  protected:
+  /// Whether adaptive polling is active, see set_max_update_interval().
+  bool is_adaptive_() const;
+  /// Run an adaptive poll and schedule the next one.
+  void adaptive_poll_();
+
   uint32_t update_interval_;
+  uint32_t max_update_interval_{0};
+  /// The interval the next adaptive poll is scheduled with.
+  uint32_t current_update_interval_{0};
+  uint32_t last_poll_{0};
+  uint32_t saved_polls_{0};
+  bool readings_reported_{false};
+  bool readings_changed_{false};
 };
 
 class WarnIfComponentBlockingGuard {
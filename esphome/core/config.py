@@ -6,6 +6,7 @@ import re
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import automation
+import esphome.final_validate as fv
 from esphome.const import (
     CONF_ARDUINO_VERSION,
     CONF_AREA,
@@ -15,6 +16,7 @@ from esphome.const import (
     CONF_COMMENT,
     CONF_COMPILE_PROCESS_LIMIT,
     CONF_ESPHOME,
+    CONF_FILTERS,
     CONF_FRAMEWORK,
     CONF_INCLUDES,
     CONF_LIBRARIES,
@@ -26,6 +28,7 @@ from esphome.const import (
     CONF_ON_SHUTDOWN,
     CONF_PLATFORM,
     CONF_PLATFORMIO_OPTIONS,
+    CONF_POLLING_DELTA,
     CONF_PRIORITY,
     CONF_PROJECT,
     CONF_SOURCE,
@@ -38,6 +41,11 @@ from esphome.const import (
     __version__ as ESPHOME_VERSION,
 )
 from esphome.core import CORE, coroutine_with_priority
+from esphome.cpp_helpers import (
+    ADAPTIVE_POLLING_INVALID_FILTERS,
+    add_setup_dependencies,
+    walk_adaptive_polling,
+)
 from esphome.helpers import copy_file_if_changed, walk_files
 
 _LOGGER = logging.getLogger(__name__)
@@ -56,6 +64,7 @@ LoopTrigger = cg.esphome_ns.class_(
 VERSION_REGEX = re.compile(r"^[0-9]+\.[0-9]+\.[0-9]+(?:[ab]\d+)?$")
 
 CONF_NAME_ADD_MAC_SUFFIX = "name_add_mac_suffix"
+CONF_PARALLEL_SETUP = "parallel_setup"
 
 
 VALID_INCLUDE_EXTS = {".h", ".hpp", ".tcc", ".ino", ".cpp", ".c"}
@@ -155,6 +164,9 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_INCLUDES, default=[]): cv.ensure_list(valid_include),
             cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
             cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
+            # opt-in, a component that holds back the setup of the later ones with
+            # can_proceed() only does so for the components that depend on it
+            cv.Optional(CONF_PARALLEL_SETUP, default=False): cv.boolean,
             cv.Optional(CONF_PROJECT): cv.Schema(
                 {
                     cv.Required(CONF_NAME): cv.All(
@@ -174,6 +186,34 @@ CONFIG_SCHEMA = cv.All(
     validate_hostname,
 )
 
+def _final_validate(config):
+    # the band of an entity is only used by a polling component with adaptive polling
+    for path, conf, poller in walk_adaptive_polling(fv.full_config.get()):
+        if CONF_POLLING_DELTA in conf and poller is None:
+            with cv.prepend_path([cv.ROOT_CONFIG_PATH] + path):
+                raise cv.Invalid(
+                    f"{CONF_POLLING_DELTA} requires max_update_interval on the "
+                    "component that provides the entity",
+                    [CONF_POLLING_DELTA],
+                )
+        if poller is None or not isinstance(conf.get(CONF_FILTERS), list):
+            continue
+        # the filters would cover more time while the interval is longer
+        for i, filter_ in enumerate(conf[CONF_FILTERS]):
+            for key in filter_:
+                if key not in ADAPTIVE_POLLING_INVALID_FILTERS:
+                    continue
+                with cv.prepend_path([cv.ROOT_CONFIG_PATH] + path):
+                    raise cv.Invalid(
+                        f"The {key} filter combines readings that max_update_interval "
+                        "spaces further apart, remove one of them",
+                        [CONF_FILTERS, i, key],
+                    )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
 PRELOAD_CONFIG_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_NAME): cv.valid_name,
@@ -361,6 +401,9 @@ async def to_code(config):
 
     CORE.add_job(_add_automations, config)
 
+    if config[CONF_PARALLEL_SETUP]:
+        CORE.add_job(add_setup_dependencies)
+
     cg.add_build_flag("-fno-exceptions")
 
     # Libraries
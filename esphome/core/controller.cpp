@@ -1,96 +1,136 @@
 #include "controller.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include "esphome/core/entity_change_bus.h"
 
 namespace esphome {
 
 void Controller::setup_controller(bool include_internal) {
+  this->include_internal_entities_ = include_internal;
+  this->subscriber_id_ = global_entity_change_bus.subscribe(
+      [this](EntityType type, uint16_t index) { this->on_entity_change_(type, index); });
+}
+
+void Controller::process_entity_updates() { global_entity_change_bus.drain(this->subscriber_id_); }
+
+void Controller::on_entity_change_(EntityType type, uint16_t index) {
+  switch (type) {
 #ifdef USE_BINARY_SENSOR
-  for (auto *obj : App.get_binary_sensors()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](bool state) { this->on_binary_sensor_update(obj, state); });
-  }
+    case ENTITY_TYPE_BINARY_SENSOR: {
+      auto *obj = App.get_binary_sensors()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_binary_sensor_update(obj, obj->state);
+      break;
+    }
 #endif
 #ifdef USE_FAN
-  for (auto *obj : App.get_fans()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_fan_update(obj); });
-  }
+    case ENTITY_TYPE_FAN: {
+      auto *obj = App.get_fans()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_fan_update(obj);
+      break;
+    }
 #endif
 #ifdef USE_LIGHT
-  for (auto *obj : App.get_lights()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_new_remote_values_callback([this, obj]() { this->on_light_update(obj); });
-  }
+    case ENTITY_TYPE_LIGHT: {
+      auto *obj = App.get_lights()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_light_update(obj);
+      break;
+    }
 #endif
 #ifdef USE_SENSOR
-  for (auto *obj : App.get_sensors()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](float state) { this->on_sensor_update(obj, state); });
-  }
+    case ENTITY_TYPE_SENSOR: {
+      auto *obj = App.get_sensors()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_sensor_update(obj, obj->state);
+      break;
+    }
 #endif
 #ifdef USE_SWITCH
-  for (auto *obj : App.get_switches()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](bool state) { this->on_switch_update(obj, state); });
-  }
+    case ENTITY_TYPE_SWITCH: {
+      auto *obj = App.get_switches()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_switch_update(obj, obj->state);
+      break;
+    }
 #endif
 #ifdef USE_COVER
-  for (auto *obj : App.get_covers()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_cover_update(obj); });
-  }
+    case ENTITY_TYPE_COVER: {
+      auto *obj = App.get_covers()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_cover_update(obj);
+      break;
+    }
 #endif
 #ifdef USE_TEXT_SENSOR
-  for (auto *obj : App.get_text_sensors()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](const std::string &state) { this->on_text_sensor_update(obj, state); });
-  }
+    case ENTITY_TYPE_TEXT_SENSOR: {
+      auto *obj = App.get_text_sensors()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_text_sensor_update(obj, obj->state);
+      break;
+    }
 #endif
 #ifdef USE_CLIMATE
-  for (auto *obj : App.get_climates()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](climate::Climate & /*unused*/) { this->on_climate_update(obj); });
-  }
+    case ENTITY_TYPE_CLIMATE: {
+      auto *obj = App.get_climates()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_climate_update(obj);
+      break;
+    }
 #endif
 #ifdef USE_NUMBER
-  for (auto *obj : App.get_numbers()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](float state) { this->on_number_update(obj, state); });
-  }
+    case ENTITY_TYPE_NUMBER: {
+      auto *obj = App.get_numbers()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_number_update(obj, obj->state);
+      break;
+    }
 #endif
 #ifdef USE_TEXT
-  for (auto *obj : App.get_texts()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](const std::string &state) { this->on_text_update(obj, state); });
-  }
+    case ENTITY_TYPE_TEXT: {
+      auto *obj = App.get_texts()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_text_update(obj, obj->state);
+      break;
+    }
 #endif
 #ifdef USE_SELECT
-  for (auto *obj : App.get_selects()) {
-    if (include_internal || !obj->is_internal()) {
-      obj->add_on_state_callback(
-          [this, obj](const std::string &state, size_t index) { this->on_select_update(obj, state, index); });
+    case ENTITY_TYPE_SELECT: {
+      auto *obj = App.get_selects()[index];
+      auto active_index = obj->active_index();
+      if ((this->include_internal_entities_ || !obj->is_internal()) && active_index.has_value())
+        this->on_select_update(obj, obj->state, active_index.value());
+      break;
     }
-  }
 #endif
 #ifdef USE_LOCK
-  for (auto *obj : App.get_locks()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_lock_update(obj); });
-  }
+    case ENTITY_TYPE_LOCK: {
+      auto *obj = App.get_locks()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_lock_update(obj);
+      break;
+    }
 #endif
 #ifdef USE_MEDIA_PLAYER
-  for (auto *obj : App.get_media_players()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_media_player_update(obj); });
-  }
+    case ENTITY_TYPE_MEDIA_PLAYER: {
+      auto *obj = App.get_media_players()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_media_player_update(obj);
+      break;
+    }
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
-  for (auto *obj : App.get_alarm_control_panels()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_alarm_control_panel_update(obj); });
-  }
+    case ENTITY_TYPE_ALARM_CONTROL_PANEL: {
+      auto *obj = App.get_alarm_control_panels()[index];
+      if (this->include_internal_entities_ || !obj->is_internal())
+        this->on_alarm_control_panel_update(obj);
+      break;
+    }
 #endif
+    default:
+      break;
+  }
 }
 
 }  // namespace esphome
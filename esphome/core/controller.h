@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/defines.h"
+#include "esphome/core/entity_change_bus.h"
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -49,9 +50,16 @@
 
 namespace esphome {
 
+/** Base class of the components that report the entity states to the outside (api, web_server).
+ *
+ * The controller subscribes to the entity change bus in setup_controller() and has to call process_entity_updates()
+ * from its loop, which calls the on_*_update() methods once for every entity that changed since the last call.
+ */
 class Controller {
  public:
   void setup_controller(bool include_internal = false);
+  /// Calls the on_*_update() methods for the entities changed since the last call, with their current state.
+  void process_entity_updates();
 #ifdef USE_BINARY_SENSOR
   virtual void on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state){};
 #endif
@@ -94,6 +102,12 @@ class Controller {
 #ifdef USE_ALARM_CONTROL_PANEL
   virtual void on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj){};
 #endif
+
+ protected:
+  void on_entity_change_(EntityType type, uint16_t index);
+
+  uint8_t subscriber_id_{0};
+  bool include_internal_entities_{false};
 };
 
 }  // namespace esphome
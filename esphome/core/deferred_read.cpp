@@ -0,0 +1,76 @@
+#include "esphome/core/deferred_read.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+/// Request the high frequency loop until the last copy of the returned pointer is destroyed.
+static std::shared_ptr<HighFrequencyLoopRequester> request_high_frequency_loop() {
+  auto *requester = new HighFrequencyLoopRequester;  // NOLINT(cppcoreguidelines-owning-memory)
+  requester->start();
+  return std::shared_ptr<HighFrequencyLoopRequester>(requester, [](HighFrequencyLoopRequester *requester) {
+    requester->stop();
+    delete requester;  // NOLINT(cppcoreguidelines-owning-memory)
+  });
+}
+
+void DeferredRead::read_after(uint32_t ms, std::function<void()> &&callback) {
+  this->cancel();
+  this->pending_ = true;
+  // Loop continuously while a short wait is pending, so the read isn't delayed by a whole loop interval. The request
+  // belongs to the scheduler item: the scheduler drops the items of a failed component without running them, the
+  // request ends when the item is destroyed then.
+  std::shared_ptr<HighFrequencyLoopRequester> high_freq;
+  if (ms < App.get_loop_interval())
+    high_freq = request_high_frequency_loop();
+  // the scheduler counts whole milliseconds, one more makes sure the full time passed
+  App.scheduler.set_timeout(this->component_, this->name_, ms + 1, [this, high_freq, callback = std::move(callback)]() {
+    if (high_freq != nullptr)
+      high_freq->stop();
+    this->pending_ = false;
+    if (!this->component_->is_failed())
+      callback();
+  });
+}
+
+void DeferredRead::read_when(GPIOPin *pin, bool level, uint32_t timeout, std::function<void(bool)> &&callback) {
+  this->cancel();
+  if (pin->digital_read() == level) {
+    callback(true);
+    return;
+  }
+  this->pending_ = true;
+  this->pin_ = pin;
+  this->level_ = level;
+  this->timeout_ = timeout;
+  this->started_ = millis();
+  this->callback_ = std::move(callback);
+  // an interval of 1 ms is due on every loop iteration
+  App.scheduler.set_interval(this->component_, this->name_, 1, [this]() { this->check_pin_(); });
+}
+
+void DeferredRead::check_pin_() {
+  if (this->component_->is_failed()) {
+    this->cancel();
+    return;
+  }
+  bool ready = this->pin_->digital_read() == this->level_;
+  if (!ready && millis() - this->started_ < this->timeout_)
+    return;
+  App.scheduler.cancel_interval(this->component_, this->name_);
+  this->pending_ = false;
+  // the callback may start the next read
+  auto callback = std::move(this->callback_);
+  callback(ready);
+}
+
+void DeferredRead::cancel() {
+  if (!this->pending_)
+    return;
+  App.scheduler.cancel_timeout(this->component_, this->name_);
+  App.scheduler.cancel_interval(this->component_, this->name_);
+  this->pending_ = false;
+}
+
+}  // namespace esphome
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "esphome/core/component.h"
+#include "esphome/core/gpio.h"
+
+namespace esphome {
+
+/** Helper for drivers that have to wait between starting a measurement and reading its result.
+ *
+ * Instead of blocking in update() until a conversion finished, the driver starts the measurement and hands the rest to
+ * this helper, which calls it back from the main loop either after the conversion time or once the data ready pin of
+ * the device reached its active level. The other components keep running in the meantime.
+ *
+ * @code
+ * this->write_command(CMD_START_CONVERSION);
+ * this->deferred_read_.read_after(20, [this]() { this->publish_state(this->read_result_()); });
+ * @endcode
+ */
+class DeferredRead {
+ public:
+  /// @param component the component the read belongs to, the callbacks are not called once it failed
+  /// @param name name of the read, used for the scheduler items
+  DeferredRead(Component *component, const std::string &name)
+      : component_(component), name_(name) {}
+
+  /// Call `callback` once at least `ms` milliseconds passed, replacing a pending read.
+  void read_after(uint32_t ms, std::function<void()> &&callback);
+  /** Call `callback` once `pin` reads `level`, replacing a pending read.
+   *
+   * The pin is checked right away and then on every loop iteration. The callback gets false if the pin didn't reach the
+   * level within `timeout` ms.
+   */
+  void read_when(GPIOPin *pin, bool level, uint32_t timeout, std::function<void(bool)> &&callback);
+  /// Abort a pending read without calling back.
+  void cancel();
+
+  bool is_pending() const { return this->pending_ && !this->component_->is_failed(); }
+
+ protected:
+  void check_pin_();
+
+  Component *component_;
+  std::string name_;
+  std::function<void(bool)> callback_;
+  GPIOPin *pin_{nullptr};
+  uint32_t started_{0};
+  uint32_t timeout_{0};
+  bool level_{false};
+  bool pending_{false};
+};
+
+}  // namespace esphome
@@ -1,79 +1,134 @@
 #include "esphome/core/entity_base.h"
 #include "esphome/core/application.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
 
 static const char *const TAG = "entity_base";
 
+const EntityDescriptor EntityBase::EMPTY_DESCRIPTOR PROGMEM = {"", 0, nullptr, 0, nullptr, 0};
+
+// Entity Descriptor
+void EntityBase::set_descriptor(const EntityDescriptor *descriptor) {
+  if (this->owns_descriptor_) {
+    delete this->descriptor_;  // NOLINT(cppcoreguidelines-owning-memory)
+    this->owns_descriptor_ = false;
+  }
+  this->descriptor_ = descriptor;
+  // the object id of an entity without own name depends on the MAC address, so its hash can't be generated
+  if (!this->has_own_name() && App.is_name_add_mac_suffix_enabled())
+    this->calc_object_id_();
+}
+
+EntityDescriptor *EntityBase::mutable_descriptor_() {
+  if (!this->owns_descriptor_) {
+    const EntityDescriptor *d = this->descriptor_;
+    // copied field by field, the descriptor may be in flash where only 32 bit reads are allowed
+    this->descriptor_ = new EntityDescriptor{d->name, d->name_len, d->object_id,  // NOLINT
+                                             d->object_id_hash, d->icon, d->flags};
+    this->owns_descriptor_ = true;
+  }
+  return const_cast<EntityDescriptor *>(this->descriptor_);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+}
+
+void EntityBase::set_flag_(uint32_t flag, bool value) {
+  if (((this->descriptor_->flags & flag) != 0) == value)
+    return;
+  EntityDescriptor *descriptor = this->mutable_descriptor_();
+  if (value) {
+    descriptor->flags |= flag;
+  } else {
+    descriptor->flags &= ~flag;
+  }
+}
+
 // Entity Name
-const StringRef &EntityBase::get_name() const { return this->name_; }
+StringRef EntityBase::get_name() const {
+  if (!this->has_own_name())
+    return StringRef(App.get_friendly_name());
+  return StringRef(this->descriptor_->name, this->descriptor_->name_len);
+}
 void EntityBase::set_name(const char *name) {
-  this->name_ = StringRef(name);
-  if (this->name_.empty()) {
-    this->name_ = StringRef(App.get_friendly_name());
-    this->has_own_name_ = false;
+  EntityDescriptor *descriptor = this->mutable_descriptor_();
+  descriptor->name = name;
+  descriptor->name_len = strlen(name);
+  if (descriptor->name_len == 0) {
+    descriptor->flags &= ~ENTITY_FLAG_HAS_OWN_NAME;
   } else {
-    this->has_own_name_ = true;
+    descriptor->flags |= ENTITY_FLAG_HAS_OWN_NAME;
   }
 }
 
 // Entity Internal
-bool EntityBase::is_internal() const { return this->internal_; }
-void EntityBase::set_internal(bool internal) { this->internal_ = internal; }
+bool EntityBase::is_internal() const { return this->descriptor_->flags & ENTITY_FLAG_INTERNAL; }
+void EntityBase::set_internal(bool internal) { this->set_flag_(ENTITY_FLAG_INTERNAL, internal); }
 
 // Entity Disabled by Default
-bool EntityBase::is_disabled_by_default() const { return this->disabled_by_default_; }
-void EntityBase::set_disabled_by_default(bool disabled_by_default) { this->disabled_by_default_ = disabled_by_default; }
+bool EntityBase::is_disabled_by_default() const { return this->descriptor_->flags & ENTITY_FLAG_DISABLED_BY_DEFAULT; }
+void EntityBase::set_disabled_by_default(bool disabled_by_default) {
+  this->set_flag_(ENTITY_FLAG_DISABLED_BY_DEFAULT, disabled_by_default);
+}
 
 // Entity Icon
 std::string EntityBase::get_icon() const {
-  if (this->icon_c_str_ == nullptr) {
+  if (this->descriptor_->icon == nullptr) {
     return "";
   }
-  return this->icon_c_str_;
+  return this->descriptor_->icon;
 }
-void EntityBase::set_icon(const char *icon) { this->icon_c_str_ = icon; }
+void EntityBase::set_icon(const char *icon) { this->mutable_descriptor_()->icon = icon; }
 
 // Entity Category
-EntityCategory EntityBase::get_entity_category() const { return this->entity_category_; }
-void EntityBase::set_entity_category(EntityCategory entity_category) { this->entity_category_ = entity_category; }
+EntityCategory EntityBase::get_entity_category() const {
+  return static_cast<EntityCategory>(this->descriptor_->flags >> ENTITY_FLAG_CATEGORY_SHIFT);
+}
+void EntityBase::set_entity_category(EntityCategory entity_category) {
+  if (entity_category == this->get_entity_category())
+    return;
+  EntityDescriptor *descriptor = this->mutable_descriptor_();
+  descriptor->flags &= (1u << ENTITY_FLAG_CATEGORY_SHIFT) - 1;
+  descriptor->flags |= static_cast<uint32_t>(entity_category) << ENTITY_FLAG_CATEGORY_SHIFT;
+}
 
 // Entity Object ID
 std::string EntityBase::get_object_id() const {
   // Check if `App.get_friendly_name()` is constant or dynamic.
-  if (!this->has_own_name_ && App.is_name_add_mac_suffix_enabled()) {
+  if (!this->has_own_name() && App.is_name_add_mac_suffix_enabled()) {
     // `App.get_friendly_name()` is dynamic.
     return str_sanitize(str_snake_case(App.get_friendly_name()));
   } else {
     // `App.get_friendly_name()` is constant.
-    if (this->object_id_c_str_ == nullptr) {
+    if (this->descriptor_->object_id == nullptr) {
       return "";
     }
-    return this->object_id_c_str_;
+    return this->descriptor_->object_id;
   }
 }
 void EntityBase::set_object_id(const char *object_id) {
-  this->object_id_c_str_ = object_id;
+  this->mutable_descriptor_()->object_id = object_id;
   this->calc_object_id_();
 }
 
 // Calculate Object ID Hash from Entity Name
 void EntityBase::calc_object_id_() {
+  uint32_t hash;
   // Check if `App.get_friendly_name()` is constant or dynamic.
-  if (!this->has_own_name_ && App.is_name_add_mac_suffix_enabled()) {
+  if (!this->has_own_name() && App.is_name_add_mac_suffix_enabled()) {
     // `App.get_friendly_name()` is dynamic.
     const auto object_id = str_sanitize(str_snake_case(App.get_friendly_name()));
     // FNV-1 hash
-    this->object_id_hash_ = fnv1_hash(object_id);
+    hash = fnv1_hash(object_id);
   } else {
     // `App.get_friendly_name()` is constant.
     // FNV-1 hash
-    this->object_id_hash_ = fnv1_hash(this->object_id_c_str_);
+    hash = fnv1_hash(this->descriptor_->object_id);
   }
+  if (hash != this->descriptor_->object_id_hash)
+    this->mutable_descriptor_()->object_id_hash = hash;
 }
 
-uint32_t EntityBase::get_object_id_hash() { return this->object_id_hash_; }
+uint32_t EntityBase::get_object_id_hash() { return this->descriptor_->object_id_hash; }
 
 std::string EntityBase_DeviceClass::get_device_class() {
   if (this->device_class_ == nullptr) {
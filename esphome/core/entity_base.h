@@ -3,6 +3,7 @@
 #include <string>
 #include <cstdint>
 #include "string_ref.h"
+#include "entity_change_bus.h"
 
 namespace esphome {
 
@@ -12,15 +13,41 @@ enum EntityCategory : uint8_t {
   ENTITY_CATEGORY_DIAGNOSTIC = 2,
 };
 
+enum EntityFlags : uint32_t {
+  ENTITY_FLAG_HAS_OWN_NAME = 1 << 0,
+  ENTITY_FLAG_INTERNAL = 1 << 1,
+  ENTITY_FLAG_DISABLED_BY_DEFAULT = 1 << 2,
+  /// the entity category is stored in the bits above this shift
+  ENTITY_FLAG_CATEGORY_SHIFT = 8,
+};
+
+/** The static metadata of an entity, generated by the code generation as a constant in flash.
+ *
+ * All fields are 32 bit wide so that they can be read directly from flash on the ESP8266, which only allows aligned
+ * 32 bit reads there. The strings themselves are regular string literals.
+ */
+struct EntityDescriptor {
+  const char *name;
+  uint32_t name_len;
+  const char *object_id;
+  uint32_t object_id_hash;
+  const char *icon;
+  uint32_t flags;
+};
+
 // The generic Entity base class that provides an interface common to all Entities.
 class EntityBase {
  public:
+  // Get/set the static metadata of this Entity, the descriptor must stay valid for the lifetime of the entity.
+  const EntityDescriptor *get_descriptor() const { return this->descriptor_; }
+  void set_descriptor(const EntityDescriptor *descriptor);
+
   // Get/set the name of this Entity
-  const StringRef &get_name() const;
+  StringRef get_name() const;
   void set_name(const char *name);
 
   // Get whether this Entity has its own name or it should use the device friendly_name.
-  bool has_own_name() const { return this->has_own_name_; }
+  bool has_own_name() const { return this->descriptor_->flags & ENTITY_FLAG_HAS_OWN_NAME; }
 
   // Get the sanitized name of this Entity as an ID.
   std::string get_object_id() const;
@@ -47,20 +74,25 @@ class EntityBase {
   std::string get_icon() const;
   void set_icon(const char *icon);
 
+  // Get/set the index of this Entity among the entities of its type, used by the entity change bus.
+  // Entities that are not registered with the application keep ENTITY_INDEX_UNREGISTERED.
+  uint16_t get_entity_index() const { return this->entity_index_; }
+  void set_entity_index(uint16_t entity_index) { this->entity_index_ = entity_index; }
+
  protected:
   /// The hash_base() function has been deprecated. It is kept in this
   /// class for now, to prevent external components from not compiling.
   virtual uint32_t hash_base() { return 0L; }
   void calc_object_id_();
+  /// Returns a copy of the descriptor in RAM that the setters can modify, only entities changed at runtime need one.
+  EntityDescriptor *mutable_descriptor_();
+  void set_flag_(uint32_t flag, bool value);
+
+  static const EntityDescriptor EMPTY_DESCRIPTOR;
 
-  StringRef name_;
-  const char *object_id_c_str_{nullptr};
-  const char *icon_c_str_{nullptr};
-  uint32_t object_id_hash_;
-  bool has_own_name_{false};
-  bool internal_{false};
-  bool disabled_by_default_{false};
-  EntityCategory entity_category_{ENTITY_CATEGORY_NONE};
+  const EntityDescriptor *descriptor_{&EMPTY_DESCRIPTOR};
+  uint16_t entity_index_{ENTITY_INDEX_UNREGISTERED};
+  bool owns_descriptor_{false};
 };
 
 class EntityBase_DeviceClass {
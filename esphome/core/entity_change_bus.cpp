@@ -0,0 +1,60 @@
+#include "entity_change_bus.h"
+
+#include <utility>
+
+namespace esphome {
+
+uint16_t EntityChangeBus::register_entity(EntityType type) {
+  uint16_t index = this->counts_[type]++;
+  size_t words = (this->counts_[type] + 31) / 32;
+  for (auto &subscriber : this->subscribers_)
+    subscriber.dirty[type].resize(words, 0);
+  return index;
+}
+
+uint8_t EntityChangeBus::subscribe(Handler &&handler) {
+  Subscriber subscriber;
+  subscriber.handler = std::move(handler);
+  for (uint8_t type = 0; type < ENTITY_TYPE_COUNT; type++)
+    subscriber.dirty[type].resize((this->counts_[type] + 31) / 32, 0);
+  this->subscribers_.push_back(std::move(subscriber));
+  return this->subscribers_.size() - 1;
+}
+
+void EntityChangeBus::flush(EntityType type, uint16_t index) {
+  if (index >= this->counts_[type])
+    return;
+  const uint32_t mask = 1u << (index % 32);
+  for (auto &subscriber : this->subscribers_) {
+    uint32_t &word = subscriber.dirty[type][index / 32];
+    if (word & mask) {
+      word &= ~mask;
+      subscriber.handler(type, index);
+    }
+  }
+}
+
+void EntityChangeBus::drain(uint8_t subscriber_id) {
+  Subscriber &subscriber = this->subscribers_[subscriber_id];
+  uint32_t types = subscriber.pending_types;
+  subscriber.pending_types = 0;
+  while (types != 0) {
+    uint8_t type = __builtin_ctz(types);
+    types &= types - 1;
+    auto &dirty = subscriber.dirty[type];
+    for (size_t i = 0; i < dirty.size(); i++) {
+      // the bits are cleared before the handler runs, so changes published from the handler are kept for the next drain
+      uint32_t word = dirty[i];
+      dirty[i] = 0;
+      while (word != 0) {
+        uint8_t bit = __builtin_ctz(word);
+        word &= word - 1;
+        subscriber.handler(static_cast<EntityType>(type), i * 32 + bit);
+      }
+    }
+  }
+}
+
+EntityChangeBus global_entity_change_bus;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace esphome {
+
+enum EntityType : uint8_t {
+  ENTITY_TYPE_BINARY_SENSOR = 0,
+  ENTITY_TYPE_FAN,
+  ENTITY_TYPE_LIGHT,
+  ENTITY_TYPE_SENSOR,
+  ENTITY_TYPE_SWITCH,
+  ENTITY_TYPE_COVER,
+  ENTITY_TYPE_TEXT_SENSOR,
+  ENTITY_TYPE_CLIMATE,
+  ENTITY_TYPE_NUMBER,
+  ENTITY_TYPE_TEXT,
+  ENTITY_TYPE_SELECT,
+  ENTITY_TYPE_LOCK,
+  ENTITY_TYPE_MEDIA_PLAYER,
+  ENTITY_TYPE_ALARM_CONTROL_PANEL,
+  ENTITY_TYPE_COUNT,
+};
+
+/// The index of an entity that was not registered with the application, its changes are not delivered.
+static const uint16_t ENTITY_INDEX_UNREGISTERED = UINT16_MAX;
+
+/** Collects the state changes of all entities for the controllers (api, web_server, ...).
+ *
+ * Publishing a state only sets the bit of the entity in a dirty bitset of every subscriber, the subscribers drain the
+ * changed entities from their loop and read the current state from the entity. Several changes of an entity between
+ * two drains are delivered once, so a slow subscriber only sees the latest state.
+ */
+class EntityChangeBus {
+ public:
+  using Handler = std::function<void(EntityType type, uint16_t index)>;
+
+  /// Assigns the next index of the given type to an entity, called from Application::register_*().
+  uint16_t register_entity(EntityType type);
+  /// Adds a subscriber, the handler is called for every changed entity from drain() and flush().
+  uint8_t subscribe(Handler &&handler);
+
+  /// Marks the state of an entity as changed for all subscribers.
+  void mark_changed(EntityType type, uint16_t index) {
+    // also skips ENTITY_INDEX_UNREGISTERED, the dirty bitsets only have room for the registered entities
+    if (this->subscribers_.empty() || index >= this->counts_[type])
+      return;
+    const uint32_t mask = 1u << (index % 32);
+    for (auto &subscriber : this->subscribers_) {
+      subscriber.dirty[type][index / 32] |= mask;
+      subscriber.pending_types |= 1u << type;
+    }
+  }
+  /// Delivers a not yet delivered change of the entity right away, used before a change that must not be coalesced.
+  void flush(EntityType type, uint16_t index);
+  /// Calls the handler of the subscriber for every entity that changed since the last drain.
+  void drain(uint8_t subscriber);
+
+ protected:
+  struct Subscriber {
+    Handler handler;
+    std::vector<uint32_t> dirty[ENTITY_TYPE_COUNT];
+    uint16_t pending_types{0};
+  };
+
+  std::vector<Subscriber> subscribers_;
+  uint16_t counts_[ENTITY_TYPE_COUNT]{};
+};
+
+extern EntityChangeBus global_entity_change_bus;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
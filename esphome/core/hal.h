@@ -1,7 +1,9 @@
 #pragma once
 #include <string>
 #include <cstdint>
+#include <ctime>
 #include "gpio.h"
+#include "esphome/core/defines.h"
 
 #if defined(USE_ESP32_FRAMEWORK_ESP_IDF)
 #include <esp_attr.h>
@@ -44,5 +46,10 @@ void arch_feed_wdt();
 uint32_t arch_get_cpu_cycle_count();
 uint32_t arch_get_cpu_freq_hz();
 uint8_t progmem_read_byte(const uint8_t *addr);
+#ifdef USE_HOST_VIRTUAL_TIME
+/// UNIX time of a platform whose clock isn't the system clock, in place of time() and settimeofday()
+time_t arch_get_epoch();
+void arch_set_epoch(time_t epoch);
+#endif
 
 }  // namespace esphome
@@ -0,0 +1,131 @@
+#include "esphome/core/heap_tracker.h"
+
+#ifdef USE_HEAP_TRACKING
+
+#include "esphome/core/application.h"
+#include "esphome/core/component.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+
+namespace {
+
+/// Stored in front of every tracked block.
+struct BlockHeader {
+  HeapStats *stats;
+  uint32_t size;
+};
+
+/// Keeps the block after the header aligned like malloc does.
+constexpr size_t HEADER_SIZE =
+    (sizeof(BlockHeader) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+}  // namespace
+
+void HeapTracker::set_current(Component *component) {
+#ifdef USE_ESP32
+  // only the main loop sets the current component
+  this->loop_task_ = xTaskGetCurrentTaskHandle();
+#endif
+  this->current_ = component;
+}
+
+HeapStats *HeapTracker::current_stats_() {
+#ifdef USE_ESP32
+  if (this->loop_task_ != nullptr && xTaskGetCurrentTaskHandle() != this->loop_task_)
+    return &this->other_tasks_;
+#endif
+  return this->current_ == nullptr ? &this->core_ : &this->current_->heap_stats_;
+}
+
+void *HeapTracker::allocate(size_t size) {
+  auto *header = static_cast<BlockHeader *>(malloc(HEADER_SIZE + size));  // NOLINT(cppcoreguidelines-no-malloc)
+  if (header == nullptr)
+    return nullptr;
+  HeapStats *stats = this->current_stats_();
+  header->stats = stats;
+  header->size = size;
+#ifdef USE_ESP32
+  portENTER_CRITICAL(&this->lock_);
+#endif
+  stats->live_bytes += size;
+  stats->live_allocations++;
+  stats->allocations++;
+  stats->peak_bytes = std::max(stats->peak_bytes, stats->live_bytes);
+#ifdef USE_ESP32
+  portEXIT_CRITICAL(&this->lock_);
+#endif
+  return reinterpret_cast<uint8_t *>(header) + HEADER_SIZE;
+}
+
+void HeapTracker::release(void *ptr) {
+  if (ptr == nullptr)
+    return;
+  auto *header = reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(ptr) - HEADER_SIZE);
+  HeapStats *stats = header->stats;
+#ifdef USE_ESP32
+  portENTER_CRITICAL(&this->lock_);
+#endif
+  stats->live_bytes -= header->size;
+  stats->live_allocations--;
+#ifdef USE_ESP32
+  portEXIT_CRITICAL(&this->lock_);
+#endif
+  free(header);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+const HeapStats &HeapTracker::get_stats(const Component *component) const { return component->heap_stats_; }
+
+void HeapTracker::for_each(const std::function<void(const char *source, const HeapStats &stats)> &callback) const {
+  std::vector<std::pair<const char *, HeapStats>> entries;
+  entries.reserve(App.get_components().size() + 2);
+  // copies, so the report does not change while it is being made
+  entries.emplace_back("<core>", this->core_);
+#ifdef USE_ESP32
+  entries.emplace_back("<other tasks>", this->other_tasks_);
+#endif
+  for (auto *component : App.get_components())
+    entries.emplace_back(component->get_component_source(), component->heap_stats_);
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const auto &a, const auto &b) { return a.second.live_bytes > b.second.live_bytes; });
+  for (auto &entry : entries)
+    callback(entry.first, entry.second);
+}
+
+HeapTracker global_heap_tracker;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+// Every `new` of the firmware goes through the tracker. Blocks from malloc() are not tracked, they can't be told
+// apart from tracked blocks when they are freed.
+void *operator new(size_t size) {
+  void *ptr = esphome::global_heap_tracker.allocate(size);
+  if (ptr == nullptr) {
+#if __cpp_exceptions
+    throw std::bad_alloc();
+#else
+    abort();
+#endif
+  }
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  return esphome::global_heap_tracker.allocate(size);
+}
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+  return esphome::global_heap_tracker.allocate(size);
+}
+void operator delete(void *ptr) noexcept { esphome::global_heap_tracker.release(ptr); }
+void operator delete[](void *ptr) noexcept { esphome::global_heap_tracker.release(ptr); }
+void operator delete(void *ptr, size_t) noexcept { esphome::global_heap_tracker.release(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { esphome::global_heap_tracker.release(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { esphome::global_heap_tracker.release(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { esphome::global_heap_tracker.release(ptr); }
+
+#endif  // USE_HEAP_TRACKING
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_HEAP_TRACKING
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace esphome {
+
+class Component;
+
+/// Heap usage of the allocations made by one component.
+struct HeapStats {
+  /// Bytes allocated by the component that were not freed yet.
+  uint32_t live_bytes{0};
+  /// The highest value live_bytes had so far.
+  uint32_t peak_bytes{0};
+  /// Allocations by the component that were not freed yet.
+  uint32_t live_allocations{0};
+  /// All allocations by the component so far, a count that grows fast compared to live_allocations means churn.
+  uint32_t allocations{0};
+};
+
+/** Attributes heap allocations made with `new` to the component that is running when they are made.
+ *
+ * Every tracked block gets a small header in front of it that records the size and the stats it was counted in, so
+ * a block freed by another component (or much later) is still taken off the component that allocated it. The
+ * running component is set around setup()/loop() by Component::call() and around scheduler callbacks, allocations
+ * made outside of those (constructors, the core) are counted as core allocations.
+ *
+ * Enabled with `heap_tracking: true` in the debug component.
+ */
+class HeapTracker {
+ public:
+  /// The component new allocations are attributed to, see HeapTrackingScope.
+  Component *get_current() const { return this->current_; }
+  void set_current(Component *component);
+
+  /// Allocates a tracked block of the given size with malloc, returns nullptr when out of memory.
+  void *allocate(size_t size);
+  /// Frees a block returned by allocate().
+  void release(void *ptr);
+
+  /// Stats of allocations that were made outside of any component.
+  const HeapStats &get_core_stats() const { return this->core_; }
+  /// Stats of allocations that were made by other tasks than the main loop.
+  const HeapStats &get_other_task_stats() const { return this->other_tasks_; }
+  /// Stats of the allocations of a component.
+  const HeapStats &get_stats(const Component *component) const;
+
+  /// Calls the callback for the core, the other tasks and every component, ordered by live bytes.
+  void for_each(const std::function<void(const char *source, const HeapStats &stats)> &callback) const;
+
+ protected:
+  HeapStats *current_stats_();
+
+  Component *current_{nullptr};
+  HeapStats core_;
+  HeapStats other_tasks_;
+#ifdef USE_ESP32
+  TaskHandle_t loop_task_{nullptr};
+  portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+#endif
+};
+
+extern HeapTracker global_heap_tracker;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Attributes the allocations made during its lifetime to a component.
+class HeapTrackingScope {
+ public:
+  explicit HeapTrackingScope(Component *component) : previous_(global_heap_tracker.get_current()) {
+    global_heap_tracker.set_current(component);
+  }
+  ~HeapTrackingScope() { global_heap_tracker.set_current(this->previous_); }
+
+ protected:
+  Component *previous_;
+};
+
+}  // namespace esphome
+
+#endif  // USE_HEAP_TRACKING
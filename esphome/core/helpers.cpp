@@ -533,6 +533,10 @@ IRAM_ATTR InterruptLock::~InterruptLock() { portENABLE_INTERRUPTS(); }
 #elif defined(USE_RP2040)
 IRAM_ATTR InterruptLock::InterruptLock() { state_ = save_and_disable_interrupts(); }
 IRAM_ATTR InterruptLock::~InterruptLock() { restore_interrupts(state_); }
+#elif defined(USE_HOST)
+// there are no interrupts to disable on the host
+InterruptLock::InterruptLock() {}
+InterruptLock::~InterruptLock() {}
 #endif
 
 uint8_t HighFrequencyLoopRequester::num_requests = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -569,6 +573,9 @@ void get_mac_address_raw(uint8_t *mac) {  // NOLINT(readability-non-const-parame
   WiFi.macAddress(mac);
 #elif defined(USE_LIBRETINY)
   WiFi.macAddress(mac);
+#elif defined(USE_HOST)
+  // the host platform has no network interface of its own
+  memset(mac, 0, 6);
 #endif
 }
 std::string get_mac_address() {
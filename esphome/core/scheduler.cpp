@@ -231,6 +231,9 @@ void HOT Scheduler::call() {
       //  - timeouts/intervals get cancelled
       {
         WarnIfComponentBlockingGuard guard{item->component};
+#ifdef USE_HEAP_TRACKING
+        HeapTrackingScope heap_scope{item->component};
+#endif
         item->callback();
       }
     }
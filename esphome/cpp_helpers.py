@@ -4,7 +4,9 @@ from esphome.const import (
     CONF_DISABLED_BY_DEFAULT,
     CONF_ENTITY_CATEGORY,
     CONF_ICON,
+    CONF_ID,
     CONF_INTERNAL,
+    CONF_MAX_UPDATE_INTERVAL,
     CONF_NAME,
     CONF_SETUP_PRIORITY,
     CONF_UPDATE_INTERVAL,
@@ -15,16 +17,40 @@ from esphome.const import (
 )
 
 from esphome.core import coroutine, ID, CORE
-from esphome.coroutine import FakeAwaitable
+from esphome.coroutine import FakeAwaitable, coroutine_with_priority
 from esphome.types import ConfigType, ConfigFragmentType
-from esphome.cpp_generator import add, get_variable
-from esphome.cpp_types import App
+from esphome.cpp_generator import (
+    MockObjClass,
+    RawExpression,
+    RawStatement,
+    add,
+    add_global,
+    get_variable,
+    safe_exp,
+)
+from esphome.cpp_types import (
+    App,
+    EntityBase,
+    EntityDescriptor,
+    EntityFlags,
+    nullptr,
+)
 from esphome.util import Registry, RegistryEntry
 from esphome.helpers import snake_case, sanitize
 
 
 _LOGGER = logging.getLogger(__name__)
 
+KEY_SETUP_GRAPH = "setup_graph"
+KEY_ADAPTIVE_POLLERS = "adaptive_pollers"
+# domains that have no component of their own and the domains that provide them
+SETUP_DEPENDENCY_PROVIDERS = {
+    "network": ["wifi", "ethernet"],
+}
+# filters of entities that can't be used with adaptive polling, the entity domains
+# add theirs when they are loaded
+ADAPTIVE_POLLING_INVALID_FILTERS = set()
+
 
 async def gpio_pin_expression(conf):
     """Generate an expression for the given pin option.
@@ -41,6 +67,45 @@ async def gpio_pin_expression(conf):
     return await coroutine(pins.PIN_SCHEMA_REGISTRY[CORE.target_platform][0])(conf)
 
 
+def walk_adaptive_polling(config, path=None, poller=None):
+    """Yield (path, config, poller) for every mapping in the given config.
+
+    poller is the config of the closest enclosing polling component with a
+    max_update_interval, or None.
+    """
+    path = path or []
+    if isinstance(config, list):
+        for i, item in enumerate(config):
+            yield from walk_adaptive_polling(item, path + [i], poller)
+        return
+    if not isinstance(config, dict):
+        return
+    if CONF_MAX_UPDATE_INTERVAL in config:
+        poller = config
+    yield path, config, poller
+    for key, value in config.items():
+        yield from walk_adaptive_polling(value, path + [key], poller)
+
+
+def get_adaptive_poller(config):
+    """Get the ID of the polling component with a max_update_interval that declares
+    the entity of the given config, or None.
+
+    Entities report their readings to it, see PollingComponent::report_reading().
+    """
+    pollers = CORE.data.get(KEY_ADAPTIVE_POLLERS)
+    if pollers is None:
+        pollers = {
+            conf[CONF_ID].id: poller[CONF_ID]
+            for _, conf, poller in walk_adaptive_polling(CORE.config)
+            if poller is not None
+            and isinstance(conf.get(CONF_ID), ID)
+            and conf[CONF_ID].is_declaration
+        }
+        CORE.data[KEY_ADAPTIVE_POLLERS] = pollers
+    return pollers.get(config[CONF_ID].id)
+
+
 async def register_component(var, config):
     """Register the given obj as a component.
 
@@ -61,6 +126,8 @@ async def register_component(var, config):
         add(var.set_setup_priority(config[CONF_SETUP_PRIORITY]))
     if CONF_UPDATE_INTERVAL in config:
         add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
+    if CONF_MAX_UPDATE_INTERVAL in config:
+        add(var.set_max_update_interval(config[CONF_MAX_UPDATE_INTERVAL]))
 
     # Set component source by inspecting the stack and getting the callee module
     # https://stackoverflow.com/a/1095621
@@ -88,9 +155,66 @@ async def register_component(var, config):
         add(var.set_component_source(name))
 
     add(App.register_component(var))
+
+    CORE.data.setdefault(KEY_SETUP_GRAPH, []).append((var, name))
     return var
 
 
+def _component_dependencies(source: str) -> list[str]:
+    """The DEPENDENCIES and AUTO_LOAD of the module a component was registered from"""
+    from esphome.loader import get_component, get_platform
+
+    parts = source.split(".")
+    manifests = [get_component(parts[0])]
+    if len(parts) == 2:
+        manifests.append(get_platform(parts[1], parts[0]))
+    dependencies = []
+    for manifest in manifests:
+        if manifest is not None:
+            dependencies += manifest.dependencies + manifest.auto_load
+    return dependencies
+
+
+@coroutine_with_priority(-1000.0)
+async def add_setup_dependencies():
+    """Emit the setup dependency graph and enable parallel setup
+
+    A component depends on the components of the domains in its DEPENDENCIES and
+    AUTO_LOAD. Domains without a component of their own (like network) are resolved
+    to their providers or their own dependencies. The components that don't depend on
+    a component that is still waiting (e.g. WiFi while it connects) are set up in the
+    meantime.
+    """
+    components = CORE.data.get(KEY_SETUP_GRAPH, [])
+    by_domain = {}
+    for var, source in components:
+        if source is not None:
+            by_domain.setdefault(source, []).append(var)
+
+    for var, source in components:
+        if source is None:
+            continue
+        todo = _component_dependencies(source)
+        seen = set()
+        while todo:
+            domain = todo.pop()
+            if domain in seen:
+                continue
+            seen.add(domain)
+            if domain in by_domain:
+                for dependency in by_domain[domain]:
+                    if dependency is not var:
+                        add(App.add_setup_dependency(var, dependency))
+            elif domain in SETUP_DEPENDENCY_PROVIDERS:
+                # the providers themselves load the domain they provide
+                providers = SETUP_DEPENDENCY_PROVIDERS[domain]
+                if source.split(".")[0] not in providers:
+                    todo += providers
+            else:
+                todo += _component_dependencies(domain)
+    add(App.set_parallel_setup(True))
+
+
 async def register_parented(var, value):
     if isinstance(value, ID):
         paren = await get_variable(value)
@@ -99,20 +223,96 @@ async def register_parented(var, value):
     add(var.set_parent(paren))
 
 
+# RAM a 32 bit target saves per entity: the name, object id, icon, hash and flags
+# move to the descriptor in flash, the entity keeps a pointer to it
+ENTITY_DESCRIPTOR_RAM_SAVED = 20
+KEY_ENTITY_DESCRIPTORS = "entity_descriptors"
+
+
+def fnv1_hash(string: str) -> int:
+    """FNV-1 hash as calculated by esphome::fnv1_hash()"""
+    hash_ = 2166136261
+    for byte in string.encode("utf-8"):
+        hash_ = (hash_ * 16777619) & 0xFFFFFFFF
+        hash_ ^= byte
+    return hash_
+
+
+def _entity_type_name(config) -> str:
+    if CONF_ID not in config or not isinstance(config[CONF_ID].type, MockObjClass):
+        return "other"
+    type_ = config[CONF_ID].type
+    # the entity class is the class that directly inherits from EntityBase
+    candidates = [
+        cls
+        for cls in [type_] + type_._parents  # pylint: disable=protected-access
+        if str(cls) != str(EntityBase) and cls.inherits_from(EntityBase)
+    ]
+    if not candidates:
+        return str(type_)
+    # pylint: disable=protected-access
+    return str(min(candidates, key=lambda cls: len(cls._parents)))
+
+
+@coroutine_with_priority(-1000.0)
+async def _report_entity_descriptors():
+    counts = CORE.data[KEY_ENTITY_DESCRIPTORS]
+    total = sum(counts.values()) * ENTITY_DESCRIPTOR_RAM_SAVED
+    _LOGGER.info("Entity metadata in flash saves %s bytes of RAM:", total)
+    for type_, count in sorted(counts.items()):
+        _LOGGER.info(
+            "  %s: %s entities, %s bytes",
+            type_,
+            count,
+            count * ENTITY_DESCRIPTOR_RAM_SAVED,
+        )
+
+
 async def setup_entity(var, config):
-    """Set up generic properties of an Entity"""
-    add(var.set_name(config[CONF_NAME]))
-    if not config[CONF_NAME]:
-        add(var.set_object_id(sanitize(snake_case(CORE.friendly_name))))
+    """Set up generic properties of an Entity
+
+    The properties are emitted as a constant EntityDescriptor, which is placed in flash,
+    the entity only holds a pointer to it.
+    """
+    name = config[CONF_NAME]
+    if not name:
+        object_id = sanitize(snake_case(CORE.friendly_name))
     else:
-        add(var.set_object_id(sanitize(snake_case(config[CONF_NAME]))))
-    add(var.set_disabled_by_default(config[CONF_DISABLED_BY_DEFAULT]))
-    if CONF_INTERNAL in config:
-        add(var.set_internal(config[CONF_INTERNAL]))
-    if CONF_ICON in config:
-        add(var.set_icon(config[CONF_ICON]))
+        object_id = sanitize(snake_case(name))
+    flags = []
+    if name:
+        flags.append(EntityFlags.ENTITY_FLAG_HAS_OWN_NAME)
+    if config.get(CONF_INTERNAL, False):
+        flags.append(EntityFlags.ENTITY_FLAG_INTERNAL)
+    if config[CONF_DISABLED_BY_DEFAULT]:
+        flags.append(EntityFlags.ENTITY_FLAG_DISABLED_BY_DEFAULT)
     if CONF_ENTITY_CATEGORY in config:
-        add(var.set_entity_category(config[CONF_ENTITY_CATEGORY]))
+        shift = EntityFlags.ENTITY_FLAG_CATEGORY_SHIFT
+        flags.append(f"({config[CONF_ENTITY_CATEGORY]} << {shift})")
+    icon = safe_exp(config[CONF_ICON]) if CONF_ICON in config else nullptr
+    fields = [
+        safe_exp(name),
+        len(name.encode("utf-8")),
+        safe_exp(object_id),
+        f"0x{fnv1_hash(object_id):08X}UL",
+        icon,
+        " | ".join(str(flag) for flag in flags) if flags else 0,
+    ]
+    descriptor = f"{var}_descriptor"
+    add_global(
+        RawStatement(
+            f"static const {EntityDescriptor} {descriptor} PROGMEM = "
+            f"{{{', '.join(str(field) for field in fields)}}};"
+        )
+    )
+    add(var.set_descriptor(RawExpression(f"&{descriptor}")))
+
+    if KEY_ENTITY_DESCRIPTORS not in CORE.data:
+        CORE.data[KEY_ENTITY_DESCRIPTORS] = {}
+        CORE.add_job(_report_entity_descriptors)
+    counts = CORE.data[KEY_ENTITY_DESCRIPTORS]
+    type_ = _entity_type_name(config)
+    counts[type_] = counts.get(type_, 0) + 1
 
 
 def extract_registry_entry_config(
@@ -37,4 +37,6 @@ InternalGPIOPin = esphome_ns.class_("InternalGPIOPin", GPIOPin)
 gpio_ns = esphome_ns.namespace("gpio")
 gpio_Flags = gpio_ns.enum("Flags", is_class=True)
 EntityCategory = esphome_ns.enum("EntityCategory")
+EntityDescriptor = esphome_ns.struct("EntityDescriptor")
+EntityFlags = esphome_ns.enum("EntityFlags")
 Parented = esphome_ns.class_("Parented")
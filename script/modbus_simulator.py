@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Simulate Modbus RTU slaves on a pseudo-terminal.
+
+Point the `port` of a host `uart:` at the printed (or linked) device to test
+modbus_controller configurations without hardware, e.g.
+
+    script/modbus_simulator.py --link /tmp/modbus 1 2:40 3:offline
+
+Every slave answers reads with the register address as value and acknowledges
+writes. A slave may be given a response delay in ms or be marked offline.
+"""
+
+import argparse
+import os
+import select
+import sys
+import time
+import tty
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0xA001 if crc & 1 else crc >> 1
+    return crc
+
+
+def with_crc(frame):
+    crc = crc16(frame)
+    return frame + bytes([crc & 0xFF, crc >> 8])
+
+
+def request_length(buffer):
+    """Length of the request at the start of buffer, None if it is incomplete."""
+    if len(buffer) < 2:
+        return None
+    function = buffer[1]
+    if function in (0x01, 0x02, 0x03, 0x04, 0x05, 0x06):
+        return 8
+    if function in (0x0F, 0x10):
+        if len(buffer) < 7:
+            return None
+        return 9 + buffer[6]
+    # unknown function, the whole buffer is assumed to be the request
+    return len(buffer)
+
+
+def respond(request):
+    address, function = request[0], request[1]
+    start = int.from_bytes(request[2:4], "big")
+    count = int.from_bytes(request[4:6], "big")
+    if function in (0x01, 0x02):
+        bits = [(start + i) & 1 for i in range(count)]
+        data = bytearray((count + 7) // 8)
+        for i, bit in enumerate(bits):
+            data[i // 8] |= bit << (i % 8)
+        return with_crc(bytes([address, function, len(data)]) + bytes(data))
+    if function in (0x03, 0x04):
+        data = b"".join(((start + i) & 0xFFFF).to_bytes(2, "big") for i in range(count))
+        return with_crc(bytes([address, function, len(data)]) + data)
+    if function in (0x05, 0x06, 0x0F, 0x10):
+        return with_crc(request[:6])
+    # illegal function
+    return with_crc(bytes([address, function | 0x80, 0x01]))
+
+
+def parse_slave(value):
+    address, _, option = value.partition(":")
+    slave = {"address": int(address, 0), "delay": 0.0, "offline": False}
+    if option == "offline":
+        slave["offline"] = True
+    elif option:
+        slave["delay"] = int(option) / 1000
+    return slave
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "slaves",
+        nargs="+",
+        type=parse_slave,
+        help="slave address, optionally followed by :<delay ms> or :offline",
+    )
+    parser.add_argument("--link", help="create a symlink to the pseudo-terminal")
+    args = parser.parse_args()
+    slaves = {slave["address"]: slave for slave in args.slaves}
+
+    master, slave_fd = os.openpty()
+    tty.setraw(slave_fd)
+    path = os.ttyname(slave_fd)
+    if args.link:
+        if os.path.lexists(args.link):
+            os.unlink(args.link)
+        os.symlink(path, args.link)
+        path = args.link
+    print(f"Simulating {len(slaves)} slave(s) on {path}", flush=True)
+
+    buffer = b""
+    stats = {address: 0 for address in slaves}
+    try:
+        while True:
+            readable, _, _ = select.select([master], [], [], 0.05)
+            if not readable:
+                # a gap ends the frame, drop incomplete garbage
+                buffer = b""
+                continue
+            buffer += os.read(master, 256)
+            length = request_length(buffer)
+            while length is not None and len(buffer) >= length:
+                request, buffer = buffer[:length], buffer[length:]
+                if crc16(request[:-2]) != int.from_bytes(request[-2:], "little"):
+                    print(f"CRC error: {request.hex(' ')}", file=sys.stderr)
+                    buffer = b""
+                    break
+                slave = slaves.get(request[0])
+                if slave is not None and not slave["offline"]:
+                    time.sleep(slave["delay"])
+                    os.write(master, respond(request))
+                    stats[request[0]] += 1
+                length = request_length(buffer)
+    except KeyboardInterrupt:
+        for address, count in stats.items():
+            print(f"Slave 0x{address:02X}: {count} requests answered")
+    finally:
+        if args.link and os.path.islink(args.link):
+            os.unlink(args.link)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,37 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import display, font, image, qr_code
+from esphome.const import CONF_ID, PLATFORM_HOST
+
+DEPENDENCIES = ["api", "font", "image", "qr_code"]
+AUTO_LOAD = ["canbus", "json", "light", "remote_base", "sensor"]
+
+CONF_DISPLAY_ID = "display_id"
+CONF_FONT_ID = "font_id"
+CONF_IMAGE_ID = "image_id"
+CONF_QR_CODE_ID = "qr_code_id"
+
+benchmark_ns = cg.esphome_ns.namespace("benchmark")
+BenchmarkComponent = benchmark_ns.class_("BenchmarkComponent", cg.Component)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(BenchmarkComponent),
+            cv.Required(CONF_DISPLAY_ID): cv.use_id(display.DisplayBuffer),
+            cv.Required(CONF_FONT_ID): cv.use_id(font.Font),
+            cv.Required(CONF_IMAGE_ID): cv.use_id(image.Image_),
+            cv.Required(CONF_QR_CODE_ID): cv.use_id(qr_code.QRCode),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.only_on(PLATFORM_HOST),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_display(await cg.get_variable(config[CONF_DISPLAY_ID])))
+    cg.add(var.set_font(await cg.get_variable(config[CONF_FONT_ID])))
+    cg.add(var.set_image(await cg.get_variable(config[CONF_IMAGE_ID])))
+    cg.add(var.set_qr_code(await cg.get_variable(config[CONF_QR_CODE_ID])))
@@ -0,0 +1,90 @@
+#ifdef USE_HOST
+
+#include "benchmark.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "esphome/core/version.h"
+
+#ifdef __GLIBC__
+extern "C" {
+void *__libc_malloc(size_t size);    // NOLINT(bugprone-reserved-identifier)
+void *__libc_calloc(size_t n, size_t size);    // NOLINT(bugprone-reserved-identifier)
+void *__libc_realloc(void *ptr, size_t size);  // NOLINT(bugprone-reserved-identifier)
+}
+#endif
+
+namespace esphome {
+namespace benchmark {
+
+AllocationCounter global_allocations{0, 0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void BenchmarkComponent::setup() {
+  this->filter_ = getenv("BENCHMARK_FILTER");
+  if (this->filter_ != nullptr && this->filter_[0] == '\0')
+    this->filter_ = nullptr;
+  const char *min_time_ms = getenv("BENCHMARK_TIME_MS");
+  if (min_time_ms != nullptr && strtoull(min_time_ms, nullptr, 10) > 0)
+    this->min_time_ns_ = strtoull(min_time_ms, nullptr, 10) * 1000000ULL;
+
+  printf("goos: host\n");
+  printf("pkg: esphome " ESPHOME_VERSION "\n");
+#ifndef __GLIBC__
+  printf("note: only operator new is counted in B/op and allocs/op\n");
+#endif
+  this->bench_scheduler_();
+  this->bench_proto_();
+  this->bench_sensor_filters_();
+  this->bench_json_();
+  this->bench_color_();
+  this->bench_addressable_light_();
+  this->bench_font_();
+  this->bench_display_();
+  this->bench_remote_();
+  this->bench_canbus_();
+  printf("PASS\n");
+  fflush(stdout);
+  exit(0);
+}
+
+bool BenchmarkComponent::selected_(const char *name) const {
+  return this->filter_ == nullptr || strstr(name, this->filter_) != nullptr;
+}
+
+}  // namespace benchmark
+}  // namespace esphome
+
+// Count every allocation of the process. With glibc the malloc family is wrapped, which covers operator new and C
+// libraries like ArduinoJson. Elsewhere only operator new can be replaced portably.
+#ifdef __GLIBC__
+extern "C" {
+void *malloc(size_t size) {
+  esphome::benchmark::global_allocations.count++;
+  esphome::benchmark::global_allocations.bytes += size;
+  return __libc_malloc(size);
+}
+void *calloc(size_t n, size_t size) {
+  esphome::benchmark::global_allocations.count++;
+  esphome::benchmark::global_allocations.bytes += n * size;
+  return __libc_calloc(n, size);
+}
+void *realloc(void *ptr, size_t size) {
+  esphome::benchmark::global_allocations.count++;
+  esphome::benchmark::global_allocations.bytes += size;
+  return __libc_realloc(ptr, size);
+}
+}
+#else
+void *operator new(size_t size) {
+  esphome::benchmark::global_allocations.count++;
+  esphome::benchmark::global_allocations.bytes += size;
+  void *ptr = malloc(size);
+  if (ptr == nullptr)
+    abort();
+  return ptr;
+}
+void operator delete(void *ptr) noexcept { free(ptr); }
+#endif
+
+#endif  // USE_HOST
@@ -0,0 +1,108 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace display {
+class DisplayBuffer;
+}  // namespace display
+namespace font {
+class Font;
+}  // namespace font
+namespace image {
+class Image;
+}  // namespace image
+namespace qr_code {
+class QrCode;
+}  // namespace qr_code
+
+namespace benchmark {
+
+/// Allocations since the start of the program, counted by the malloc hooks in benchmark.cpp.
+struct AllocationCounter {
+  uint64_t count;
+  uint64_t bytes;
+};
+extern AllocationCounter global_allocations;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+inline uint64_t now_ns() {
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  return uint64_t(spec.tv_sec) * 1000000000ULL + spec.tv_nsec;
+}
+
+/** Runs the micro-benchmarks of the core hot paths on the host and exits.
+ *
+ * Every result is printed as one line in the format of Go benchmarks (name, iterations, ns/op, B/op, allocs/op), so
+ * runs of two releases can be compared with benchstat. BENCHMARK_FILTER selects benchmarks by substring and
+ * BENCHMARK_TIME_MS sets the minimum time per benchmark (default 200 ms).
+ */
+class BenchmarkComponent : public Component {
+ public:
+  void setup() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_display(display::DisplayBuffer *display) { this->display_ = display; }
+  void set_font(font::Font *font) { this->font_ = font; }
+  void set_image(image::Image *image) { this->image_ = image; }
+  void set_qr_code(qr_code::QrCode *qr_code) { this->qr_code_ = qr_code; }
+
+ protected:
+  template<typename F> void run_(const char *name, F &&op) {
+    if (!this->selected_(name))
+      return;
+    // warm up, lazily allocated buffers shouldn't count as per-op allocations
+    op();
+    uint64_t n = 1;
+    while (true) {
+      const AllocationCounter before = global_allocations;
+      const uint64_t start = now_ns();
+      for (uint64_t i = 0; i < n; i++)
+        op();
+      const uint64_t elapsed = now_ns() - start;
+      if (elapsed >= this->min_time_ns_ || n >= 1000000000ULL) {
+        const double bytes = double(global_allocations.bytes - before.bytes) / n;
+        const double allocs = double(global_allocations.count - before.count) / n;
+        printf("Benchmark%s\t%" PRIu64 "\t%.1f ns/op\t%.1f B/op\t%.2f allocs/op\n", name, n, double(elapsed) / n,
+               bytes, allocs);
+        fflush(stdout);
+        return;
+      }
+      // aim 20% over the minimum time like Go's testing.B, growing by at most 100x per round
+      const uint64_t next = elapsed == 0 ? n * 100 : n * this->min_time_ns_ * 6 / 5 / elapsed;
+      n = std::min(std::max(next, n + 1), n * 100);
+    }
+  }
+  bool selected_(const char *name) const;
+
+  void bench_scheduler_();
+  void bench_proto_();
+  void bench_sensor_filters_();
+  void bench_json_();
+  void bench_color_();
+  void bench_addressable_light_();
+  void bench_font_();
+  void bench_display_();
+  void bench_remote_();
+  void bench_canbus_();
+
+  display::DisplayBuffer *display_{nullptr};
+  font::Font *font_{nullptr};
+  image::Image *image_{nullptr};
+  qr_code::QrCode *qr_code_{nullptr};
+  const char *filter_{nullptr};
+  uint64_t min_time_ns_{200000000ULL};
+};
+
+}  // namespace benchmark
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -0,0 +1,378 @@
+#ifdef USE_HOST
+
+#include "benchmark.h"
+
+#include <string>
+#include <vector>
+
+#include "esphome/core/application.h"
+#include "esphome/core/base_automation.h"
+#include "esphome/core/color.h"
+#include "esphome/core/helpers.h"
+#include "esphome/components/api/api_pb2.h"
+#include "esphome/components/canbus/canbus.h"
+#include "esphome/components/display/display_buffer.h"
+#include "esphome/components/font/font.h"
+#include "esphome/components/image/image.h"
+#include "esphome/components/json/json_util.h"
+#include "esphome/components/light/addressable_light.h"
+#include "esphome/components/qr_code/qr_code.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/remote_base.h"
+#include "esphome/components/remote_base/samsung_protocol.h"
+#include "esphome/components/sensor/filter.h"
+#include "esphome/components/sensor/sensor.h"
+
+namespace esphome {
+namespace benchmark {
+
+/// Keeps the compiler from optimizing away a result that is never used.
+template<typename T> inline void keep(const T &value) { asm volatile("" : : "g"(&value) : "memory"); }
+
+/// Addressable light with its pixels in memory, optionally without exposing them to the span operations.
+class MemoryLight : public light::AddressableLight {
+ public:
+  MemoryLight(int32_t size, bool expose_layout)
+      : pixels_(size * 3), effect_data_(size), expose_layout_(expose_layout) {
+    this->correction_.set_max_brightness(Color(200, 200, 200, 200));
+    this->correction_.calculate_gamma_table(2.8f);
+  }
+  int32_t size() const override { return this->effect_data_.size(); }
+  void clear_effect_data() override { std::fill(this->effect_data_.begin(), this->effect_data_.end(), 0); }
+  light::LightTraits get_traits() override {
+    auto traits = light::LightTraits();
+    traits.set_supported_color_modes({light::ColorMode::RGB});
+    return traits;
+  }
+  void write_state(light::LightState *state) override {}
+
+ protected:
+  light::ESPColorView get_view_internal(int32_t index) const override {
+    uint8_t *pixel = &this->pixels_[index * 3];
+    return {pixel, pixel + 1, pixel + 2, nullptr, &this->effect_data_[index], &this->correction_};
+  }
+  bool get_pixel_layout_(light::AddressablePixelLayout &layout) const override {
+    if (!this->expose_layout_)
+      return false;
+    layout.pixels = this->pixels_.data();
+    layout.stride = 3;
+    layout.offsets[0] = 0;
+    layout.offsets[1] = 1;
+    layout.offsets[2] = 2;
+    layout.has_white = false;
+    return true;
+  }
+
+  mutable std::vector<uint8_t> pixels_;
+  mutable std::vector<uint8_t> effect_data_;
+  bool expose_layout_;
+};
+
+/// CAN bus that receives the same batch of frames on every loop.
+class ReplayCanbus : public canbus::Canbus {
+ public:
+  void set_frames(std::vector<canbus::CanFrame> frames) { this->frames_ = std::move(frames); }
+
+ protected:
+  bool setup_internal() override { return true; }
+  canbus::Error send_message(canbus::CanFrame *frame) override { return canbus::ERROR_OK; }
+  canbus::Error read_message(canbus::CanFrame *frame) override {
+    if (this->next_ == this->frames_.size()) {
+      this->next_ = 0;
+      return canbus::ERROR_NOMSG;
+    }
+    *frame = this->frames_[this->next_++];
+    return canbus::ERROR_OK;
+  }
+
+  std::vector<canbus::CanFrame> frames_;
+  size_t next_{0};
+};
+
+/// Receiver that dispatches recorded frames instead of captured ones.
+class ReplayReceiver : public remote_base::RemoteReceiverBase {
+ public:
+  ReplayReceiver() : RemoteReceiverBase(nullptr) { this->set_tolerance(25); }
+  void replay(const remote_base::RawTimings &timings) {
+    this->temp_ = timings;
+    this->call_listeners_dumpers_();
+  }
+};
+
+void BenchmarkComponent::bench_scheduler_() {
+  // a named timeout that is replaced before it fires, e.g. a debounce, and the loop's call() that cleans it up
+  this->run_("SchedulerReplaceTimeout", [this]() {
+    this->set_timeout("debounce", 1000, []() {});
+    App.scheduler.call();
+  });
+  this->run_("SchedulerFireTimeout", [this]() {
+    this->set_timeout(0, []() {});
+    App.scheduler.call();
+  });
+  this->cancel_timeout("debounce");
+
+  // what every loop iteration pays with a typical number of polling components
+  for (int i = 0; i < 50; i++)
+    this->set_interval(to_string(i), 3600000 + i, []() {});
+  this->run_("SchedulerIdleCall/50intervals", []() { App.scheduler.call(); });
+  for (int i = 0; i < 50; i++)
+    this->cancel_interval(to_string(i));
+  App.scheduler.call();
+}
+
+void BenchmarkComponent::bench_proto_() {
+  std::vector<uint8_t> buffer;
+  buffer.reserve(256);
+
+  api::SensorStateResponse state;
+  state.key = 0x12345678;
+  state.state = 21.5f;
+  this->run_("ProtoEncodeSensorState", [&]() {
+    buffer.clear();
+    state.encode(api::ProtoWriteBuffer(&buffer));
+    keep(buffer);
+  });
+
+  api::ListEntitiesSensorResponse info;
+  info.object_id = "living_room_temperature";
+  info.key = 0x12345678;
+  info.name = "Living Room Temperature";
+  info.unique_id = "livingroomtemperaturesensor";
+  info.icon = "mdi:thermometer";
+  info.unit_of_measurement = "°C";
+  info.accuracy_decimals = 1;
+  info.device_class = "temperature";
+  info.state_class = api::enums::STATE_CLASS_MEASUREMENT;
+  this->run_("ProtoEncodeListEntitiesSensor", [&]() {
+    buffer.clear();
+    info.encode(api::ProtoWriteBuffer(&buffer));
+    keep(buffer);
+  });
+}
+
+void BenchmarkComponent::bench_sensor_filters_() {
+  auto *plain = new sensor::Sensor();  // NOLINT(cppcoreguidelines-owning-memory)
+  App.register_sensor(plain);
+  uint32_t i = 0;
+  this->run_("SensorPublish/nofilters", [&]() { plain->publish_state(20.0f + (i++ % 64) * 0.125f); });
+
+  auto *filtered = new sensor::Sensor();  // NOLINT(cppcoreguidelines-owning-memory)
+  App.register_sensor(filtered);
+  filtered->add_filters({
+      new sensor::SlidingWindowMovingAverageFilter(15, 5, 1),  // NOLINT(cppcoreguidelines-owning-memory)
+      new sensor::OffsetFilter(-1.5f),                          // NOLINT(cppcoreguidelines-owning-memory)
+      new sensor::MultiplyFilter(1.8f),                         // NOLINT(cppcoreguidelines-owning-memory)
+      new sensor::DeltaFilter(0.1f, false),                     // NOLINT(cppcoreguidelines-owning-memory)
+      new sensor::RoundFilter(1),                               // NOLINT(cppcoreguidelines-owning-memory)
+  });
+  i = 0;
+  this->run_("SensorPublish/5filters", [&]() { filtered->publish_state(20.0f + (i++ % 64) * 0.125f); });
+
+  auto *median = new sensor::Sensor();  // NOLINT(cppcoreguidelines-owning-memory)
+  App.register_sensor(median);
+  median->add_filter(new sensor::MedianFilter(15, 1, 1));  // NOLINT(cppcoreguidelines-owning-memory)
+  i = 0;
+  this->run_("SensorPublish/median15", [&]() { median->publish_state(20.0f + (i++ % 64) * 0.125f); });
+}
+
+void BenchmarkComponent::bench_json_() {
+  this->run_("JsonBuildSensorState", []() {
+    std::string json = json::build_json([](JsonObject root) {
+      root["id"] = "sensor-living_room_temperature";
+      root["value"] = 21.5f;
+      root["state"] = "21.5 °C";
+    });
+    keep(json);
+  });
+  this->run_("JsonBuildLightState", []() {
+    std::string json = json::build_json([](JsonObject root) {
+      root["id"] = "light-living_room";
+      root["state"] = "ON";
+      root["color_mode"] = "rgb";
+      root["brightness"] = 180;
+      JsonObject color = root.createNestedObject("color");
+      color["r"] = 255;
+      color["g"] = 180;
+      color["b"] = 20;
+      JsonArray effects = root.createNestedArray("effects");
+      for (const char *effect : {"None", "Rainbow", "Color Wipe", "Scan", "Twinkle", "Random Twinkle", "Fireworks",
+                                 "Flicker", "Pulse", "Strobe"})
+        effects.add(effect);
+    });
+    keep(json);
+  });
+}
+
+void BenchmarkComponent::bench_color_() {
+  const Color from(200, 100, 50, 0);
+  const Color to(10, 20, 30, 40);
+  uint8_t amnt = 0;
+  this->run_("ColorGradient", [&]() {
+    Color color = Color(from).gradient(to, amnt++);
+    keep(color);
+  });
+  this->run_("ColorScale", [&]() {
+    Color color = from * amnt++;
+    keep(color);
+  });
+  this->run_("ColorAddSaturating", [&]() {
+    Color color = from + Color(amnt, amnt, amnt, 0);
+    amnt++;
+    keep(color);
+  });
+
+  MemoryLight light(300, false);
+  this->run_("ESPColorViewSet/300leds", [&]() {
+    for (int32_t i = 0; i < 300; i++)
+      light[i] = Color(i, amnt, 255 - i);
+    amnt++;
+  });
+  this->run_("ESPColorViewFadeToBlack/300leds", [&]() {
+    for (int32_t i = 0; i < 300; i++)
+      light[i].fade_to_black(16);
+  });
+}
+
+void BenchmarkComponent::bench_addressable_light_() {
+  // raw: the span operations on the pixel buffer, view: the ESPColorView fallback of drivers without a layout
+  for (bool raw : {true, false}) {
+    MemoryLight light(300, raw);
+    std::string suffix = raw ? "/raw" : "/view";
+    uint8_t amnt = 0;
+    this->run_(("AddressableFill" + suffix).c_str(), [&]() { light.fill(0, 300, Color(amnt++, 128, 64)); });
+    this->run_(("AddressableBlend" + suffix).c_str(), [&]() { light.blend(0, 300, Color::WHITE, amnt++); });
+    this->run_(("AddressableScale" + suffix).c_str(), [&]() { light.scale(0, 300, 250); });
+    this->run_(("AddressableShift" + suffix).c_str(), [&]() { light.copy(1, 0, 299); });
+
+    std::vector<uint8_t> frame(300 * 3);
+    for (size_t i = 0; i < frame.size(); i++)
+      frame[i] = i * 7;
+    this->run_(("AddressableSetFromBytes" + suffix).c_str(),
+               [&]() { light.set_from_bytes(0, frame.data(), 300); });
+  }
+}
+
+void BenchmarkComponent::bench_font_() {
+  if (this->font_ == nullptr)
+    return;
+  static const char *const TEXT = "Living Room: 21.5 °C, 45 % — Küche: 19.0 °C";
+  this->run_("FontMatchGlyphs", [this]() {
+    const char *str = TEXT;
+    while (*str != '\0') {
+      int match_length;
+      int glyph = this->font_->match_next_glyph(str, &match_length);
+      keep(glyph);
+      str += match_length > 0 ? match_length : 1;
+    }
+  });
+}
+
+void BenchmarkComponent::bench_display_() {
+  if (this->display_ == nullptr)
+    return;
+  auto *display = this->display_;
+  auto *font = this->font_;
+  auto *logo = this->image_;
+  auto *qr_code = this->qr_code_;
+
+  // the page of the host display test with a bar that follows a value, every update redraws all of it
+  static int value = 0;
+  display->set_writer([font, logo, qr_code](display::Display &it) {
+    it.rectangle(0, 0, it.get_width(), it.get_height(), Color(0, 0, 255));
+    it.filled_rectangle(4, 4, 150, 30, Color(40, 40, 40));
+    it.print(8, 8, font, Color(255, 255, 0), "ESPHome");
+    it.print(8, 40, font, "Living Room: 21.5 °C");
+    it.image(250, 4, logo);
+    it.qr_code(8, 80, qr_code, Color(255, 255, 255), 3);
+    it.filled_circle(240, 160, 40, Color(255, 0, 0));
+    it.filled_rectangle(160, 220, value, 12, Color(0, 255, 0));
+  });
+  this->run_("DisplayUpdate/320x240", [display]() {
+    value = (value + 1) % 150;
+    display->update();
+  });
+
+  this->run_("DisplayImage/64x64", [display, logo]() { display->image(250, 4, logo); });
+  // how images were drawn before the row primitives, one clipped and rotated pixel at a time
+  this->run_("DisplayImagePerPixel/64x64", [display, logo]() {
+    for (int y = 0; y < logo->get_height(); y++) {
+      for (int x = 0; x < logo->get_width(); x++)
+        display->draw_pixel_at(250 + x, 4 + y, logo->get_pixel(x, y));
+    }
+  });
+  this->run_("DisplayPrint", [display, font]() { display->print(8, 40, font, "Living Room: 21.5 °C"); });
+  this->run_("DisplayQrCode/scale3", [display, qr_code]() { display->qr_code(8, 80, qr_code, Color::WHITE, 3); });
+}
+
+void BenchmarkComponent::bench_remote_() {
+  // 40 NEC codes and 4 Samsung codes of a typical remote, a frame only matches the last NEC code
+  auto *receiver = new ReplayReceiver();  // NOLINT(cppcoreguidelines-owning-memory)
+  for (uint16_t command = 0; command < 40; command++) {
+    auto *code = new remote_base::RemoteReceiverBinarySensor<remote_base::NECProtocol>();  // NOLINT
+    code->set_data({0x1234, command, 1});
+    App.register_binary_sensor(code);
+    receiver->register_listener(code);
+  }
+  for (uint32_t command = 0; command < 4; command++) {
+    auto *code = new remote_base::RemoteReceiverBinarySensor<remote_base::SamsungProtocol>();  // NOLINT
+    code->set_data({0xE0E040BFULL + command, 32});
+    App.register_binary_sensor(code);
+    receiver->register_listener(code);
+  }
+
+  remote_base::RemoteTransmitData nec;
+  remote_base::NECProtocol().encode(&nec, {0x1234, 39, 1});
+  this->run_("RemoteDispatch/nec44listeners", [&]() { receiver->replay(nec.get_data()); });
+
+  remote_base::RemoteTransmitData samsung;
+  remote_base::SamsungProtocol().encode(&samsung, {0x12345678ULL, 32});
+  this->run_("RemoteDispatch/nomatch44listeners", [&]() { receiver->replay(samsung.get_data()); });
+}
+
+void BenchmarkComponent::bench_canbus_() {
+  using CanbusArgs = std::vector<uint8_t>;
+  // the triggers of a vehicle gateway: 48 single ids and 16 id ranges, on standard and extended ids
+  auto *bus = new ReplayCanbus();  // NOLINT(cppcoreguidelines-owning-memory)
+  uint32_t fired = 0;
+  auto add_trigger = [&](uint32_t can_id, uint32_t can_id_mask, bool use_extended_id) {
+    auto *trigger = new canbus::CanbusTrigger(bus, can_id, can_id_mask, use_extended_id);  // NOLINT
+    auto *automation = new Automation<CanbusArgs, uint32_t, bool>(trigger);                   // NOLINT
+    automation->add_actions({new LambdaAction<CanbusArgs, uint32_t, bool>(                   // NOLINT
+        [&fired](CanbusArgs data, uint32_t can_id, bool rtr) { fired += data.size(); })});
+    trigger->setup();
+  };
+  for (uint32_t i = 0; i < 32; i++)
+    add_trigger(0x100 + i * 8, 0x7FF, false);
+  for (uint32_t i = 0; i < 16; i++)
+    add_trigger(0x18FEF000 + i * 0x100 + 0x17, 0x1FFFFFFF, true);
+  for (uint32_t i = 0; i < 8; i++)
+    add_trigger(0x600 + i * 0x10, 0x7F0, false);
+  for (uint32_t i = 0; i < 8; i++)
+    add_trigger(0x0CF00000 + i * 0x10000, 0x1FFF0000, true);
+  // the filters are pushed down on the first loop
+  bus->loop();
+
+  // a batch of 32 frames, half of them match a trigger
+  std::vector<canbus::CanFrame> frames;
+  for (uint32_t i = 0; i < 32; i++) {
+    canbus::CanFrame frame{};
+    frame.use_extended_id = i % 4 >= 2;
+    if (frame.use_extended_id) {
+      frame.can_id = i % 2 == 0 ? 0x18FEF017 + (i % 16) * 0x100 : 0x18DA00F1 + i;
+    } else {
+      frame.can_id = i % 2 == 0 ? 0x100 + (i % 32) * 8 : 0x7E8 - i;
+    }
+    frame.can_data_length_code = 8;
+    for (uint8_t j = 0; j < 8; j++)
+      frame.data[j] = i + j;
+    frames.push_back(frame);
+  }
+  bus->set_frames(std::move(frames));
+  this->run_("CanbusDispatch/32frames64triggers", [&]() { bus->loop(); });
+  keep(fired);
+}
+
+}  // namespace benchmark
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -0,0 +1,138 @@
+#include "esphome/components/bluetooth_proxy/advertisement_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace bluetooth_proxy {
+
+/// One received advertisement.
+struct Advertisement {
+  uint32_t time;
+  uint64_t address;
+  std::vector<uint8_t> data;
+};
+
+/// Feeds a trace of advertisements to the cache and returns the ones that were forwarded.
+static std::vector<Advertisement> replay(AdvertisementCache &cache, const std::vector<Advertisement> &trace) {
+  std::vector<Advertisement> forwarded;
+  for (const auto &advertisement : trace) {
+    if (cache.should_forward(advertisement.address, advertisement.data.data(), advertisement.data.size(),
+                             advertisement.time))
+      forwarded.push_back(advertisement);
+  }
+  return forwarded;
+}
+
+static const uint64_t BEACON = 0xAC233F000001ULL;
+static const uint64_t THERMOMETER = 0xA4C138000002ULL;
+static const uint64_t TRACKER = 0xD0C5D3000003ULL;
+
+/// A minute of a typical scan: an iBeacon that repeats itself every 100 ms, a thermometer that advertises every
+/// second and changes its reading every 5 s, and a device in an active scan that alternates between its advertisement
+/// and its scan response every 200 ms.
+static std::vector<Advertisement> scan_trace() {
+  std::vector<Advertisement> trace;
+  for (uint32_t time = 0; time < 60000; time += 100) {
+    trace.push_back({time, BEACON, {0x02, 0x01, 0x06, 0x1A, 0xFF, 0x4C, 0x00, 0x02, 0x15}});
+    if (time % 1000 == 0)
+      trace.push_back({time, THERMOMETER, {0x0E, 0x16, 0x1A, 0x18, static_cast<uint8_t>(time / 5000)}});
+    if (time % 200 == 0) {
+      trace.push_back({time, TRACKER, {0x02, 0x01, 0x06}});
+    } else if (time % 200 == 100) {
+      trace.push_back({time, TRACKER, {0x09, 0x09, 'T', 'r', 'a', 'c', 'k', 'e', 'r'}});
+    }
+  }
+  return trace;
+}
+
+static size_t count(const std::vector<Advertisement> &advertisements, uint64_t address) {
+  size_t result = 0;
+  for (const auto &advertisement : advertisements)
+    result += advertisement.address == address;
+  return result;
+}
+
+TEST(AdvertisementCacheTest, SuppressesRepeatedAdvertisements) {
+  AdvertisementCache cache(16, 10000);
+  std::vector<Advertisement> trace = scan_trace();
+
+  std::vector<Advertisement> forwarded = replay(cache, trace);
+
+  // the beacon once per window
+  EXPECT_EQ(count(forwarded, BEACON), 6u);
+  // every new reading of the thermometer
+  EXPECT_EQ(count(forwarded, THERMOMETER), 12u);
+  // both payloads of the tracker once per window, they don't push each other out
+  EXPECT_EQ(count(forwarded, TRACKER), 12u);
+  const AdvertisementCacheStats &stats = cache.get_stats();
+  EXPECT_EQ(stats.forwarded, forwarded.size());
+  EXPECT_EQ(stats.suppressed, trace.size() - forwarded.size());
+  EXPECT_EQ(stats.evicted, 0u);
+}
+
+TEST(AdvertisementCacheTest, ForwardsAgainAfterTheWindow) {
+  AdvertisementCache cache(16, 100);
+  const uint8_t data[] = {0x02, 0x01, 0x06};
+  // starts just before millis() wraps around
+  const uint32_t start = UINT32_MAX - 50;
+
+  EXPECT_TRUE(cache.should_forward(BEACON, data, sizeof(data), start));
+  EXPECT_FALSE(cache.should_forward(BEACON, data, sizeof(data), start + 99));
+  EXPECT_TRUE(cache.should_forward(BEACON, data, sizeof(data), start + 100));
+  EXPECT_FALSE(cache.should_forward(BEACON, data, sizeof(data), start + 150));
+}
+
+TEST(AdvertisementCacheTest, ForwardsSamePayloadOfOtherAddresses) {
+  AdvertisementCache cache(16, 10000);
+  const uint8_t data[] = {0x02, 0x01, 0x06};
+
+  EXPECT_TRUE(cache.should_forward(BEACON, data, sizeof(data), 0));
+  EXPECT_TRUE(cache.should_forward(THERMOMETER, data, sizeof(data), 0));
+  EXPECT_TRUE(cache.should_forward(TRACKER, data, sizeof(data), 0));
+  EXPECT_FALSE(cache.should_forward(THERMOMETER, data, sizeof(data), 1));
+  // the address 0 isn't cached
+  EXPECT_TRUE(cache.should_forward(0, data, sizeof(data), 0));
+  EXPECT_TRUE(cache.should_forward(0, data, sizeof(data), 1));
+}
+
+TEST(AdvertisementCacheTest, EvictsLeastRecentlyForwardedOnCollision) {
+  // all addresses start probing at the same slot, the cache has room for four of them
+  AdvertisementCache cache(8, 10000);
+  const uint8_t data[] = {0x02, 0x01, 0x06};
+  std::vector<uint64_t> addresses;
+  for (uint64_t i = 1; i <= 5; i++)
+    addresses.push_back(i * 8);
+
+  for (size_t i = 0; i < 4; i++)
+    EXPECT_TRUE(cache.should_forward(addresses[i], data, sizeof(data), i));
+  for (size_t i = 0; i < 4; i++)
+    EXPECT_FALSE(cache.should_forward(addresses[i], data, sizeof(data), 10));
+  EXPECT_EQ(cache.get_stats().evicted, 0u);
+
+  // takes the slot of the first address, which was forwarded longest ago
+  EXPECT_TRUE(cache.should_forward(addresses[4], data, sizeof(data), 20));
+  EXPECT_EQ(cache.get_stats().evicted, 1u);
+  EXPECT_FALSE(cache.should_forward(addresses[4], data, sizeof(data), 21));
+  EXPECT_FALSE(cache.should_forward(addresses[1], data, sizeof(data), 21));
+  // the evicted address is forwarded again inside its window
+  EXPECT_TRUE(cache.should_forward(addresses[0], data, sizeof(data), 22));
+  EXPECT_EQ(cache.get_stats().evicted, 2u);
+}
+
+TEST(AdvertisementCacheTest, ReplacesExpiredEntriesWithoutCountingEvictions) {
+  AdvertisementCache cache(8, 100);
+  const uint8_t data[] = {0x02, 0x01, 0x06};
+
+  for (uint64_t i = 1; i <= 4; i++)
+    EXPECT_TRUE(cache.should_forward(i * 8, data, sizeof(data), 0));
+  // the window of all entries passed
+  EXPECT_TRUE(cache.should_forward(5 * 8, data, sizeof(data), 100));
+
+  EXPECT_EQ(cache.get_stats().evicted, 0u);
+}
+
+}  // namespace bluetooth_proxy
+}  // namespace esphome
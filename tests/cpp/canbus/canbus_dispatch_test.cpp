@@ -0,0 +1,97 @@
+#include "esphome/components/canbus/canbus.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/base_automation.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace canbus {
+
+/// A bus that receives the frames queued by the test.
+class QueueCanbus : public Canbus {
+ public:
+  void receive(uint32_t can_id, bool use_extended_id, const std::vector<uint8_t> &data) {
+    CanFrame frame{};
+    frame.can_id = can_id;
+    frame.use_extended_id = use_extended_id;
+    frame.can_data_length_code = data.size();
+    std::copy(data.begin(), data.end(), frame.data);
+    this->frames_.push_back(frame);
+  }
+
+ protected:
+  bool setup_internal() override { return true; }
+  Error send_message(CanFrame *frame) override { return ERROR_OK; }
+  Error read_message(CanFrame *frame) override {
+    if (this->frames_.empty())
+      return ERROR_NOMSG;
+    *frame = this->frames_.front();
+    this->frames_.pop_front();
+    return ERROR_OK;
+  }
+
+  std::deque<CanFrame> frames_;
+};
+
+using CanbusAutomation = Automation<std::vector<uint8_t>, uint32_t, bool>;
+using CanbusLambda = LambdaAction<std::vector<uint8_t>, uint32_t, bool>;
+
+/// Triggers that record their name and the data they fired with.
+class CanbusDispatchTest : public testing::Test {
+ protected:
+  void add_trigger(const std::string &name, uint32_t can_id, uint32_t can_id_mask, bool use_extended_id = false) {
+    this->triggers_.emplace_back(new CanbusTrigger(&this->bus_, can_id, can_id_mask, use_extended_id));  // NOLINT
+    auto *trigger = this->triggers_.back().get();
+    this->automations_.emplace_back(new CanbusAutomation(trigger));  // NOLINT
+    this->actions_.emplace_back(new CanbusLambda([this, name](std::vector<uint8_t> data, uint32_t can_id, bool rtr) {
+      this->fired.push_back(name);
+      this->data.push_back(data);
+    }));
+    this->automations_.back()->add_actions({this->actions_.back().get()});
+    trigger->setup();
+  }
+
+  QueueCanbus bus_;
+  std::vector<std::unique_ptr<CanbusTrigger>> triggers_;
+  std::vector<std::unique_ptr<CanbusAutomation>> automations_;
+  std::vector<std::unique_ptr<CanbusLambda>> actions_;
+  std::vector<std::string> fired;
+  std::vector<std::vector<uint8_t>> data;
+};
+
+TEST_F(CanbusDispatchTest, FiresInTheOrderTheTriggersWereAdded) {
+  this->add_trigger("range", 0x100, 0x700);
+  this->add_trigger("exact", 0x123, 0x7FF);
+  this->add_trigger("group", 0x120, 0x7F0);
+  this->add_trigger("exact again", 0x123, 0x7FF);
+  this->add_trigger("other", 0x124, 0x7FF);
+  this->add_trigger("extended", 0x123, 0x1FFFFFFF, true);
+
+  this->bus_.receive(0x123, false, {1, 2, 3});
+  this->bus_.loop();
+
+  EXPECT_EQ(this->fired, (std::vector<std::string>{"range", "exact", "group", "exact again"}));
+  for (const auto &data : this->data)
+    EXPECT_EQ(data, (std::vector<uint8_t>{1, 2, 3}));
+}
+
+TEST_F(CanbusDispatchTest, SeparatesStandardAndExtendedIds) {
+  this->add_trigger("standard", 0x123, 0x7FF);
+  this->add_trigger("extended", 0x123, 0x1FFFFFFF, true);
+  this->add_trigger("extended range", 0x18FEF100, 0x1FFFFF00, true);
+
+  this->bus_.receive(0x123, true, {});
+  this->bus_.receive(0x18FEF1AB, true, {0xFF});
+  this->bus_.receive(0x7FF, false, {});
+  this->bus_.loop();
+
+  EXPECT_EQ(this->fired, (std::vector<std::string>{"extended", "extended range"}));
+}
+
+}  // namespace canbus
+}  // namespace esphome
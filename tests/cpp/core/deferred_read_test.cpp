@@ -0,0 +1,113 @@
+#include "esphome/core/application.h"
+#include "esphome/core/deferred_read.h"
+#include "esphome/core/hal.h"
+
+#include <gtest/gtest.h>
+
+namespace esphome {
+
+class FakePin : public GPIOPin {
+ public:
+  void setup() override {}
+  void pin_mode(gpio::Flags flags) override {}
+  bool digital_read() override { return this->level; }
+  void digital_write(bool value) override { this->level = value; }
+  std::string dump_summary() const override { return "fake"; }
+
+  bool level{false};
+};
+
+/// Runs the scheduler for the given time.
+static void run_for(uint32_t ms) {
+  const uint32_t start = millis();
+  while (millis() - start < ms) {
+    App.scheduler.call();
+    delay(1);
+  }
+}
+
+TEST(DeferredReadTest, ReadsAfterTheTime) {
+  Component component;
+  DeferredRead read(&component, "read");
+  bool called = false;
+
+  read.read_after(5, [&called]() { called = true; });
+  EXPECT_TRUE(HighFrequencyLoopRequester::is_high_frequency());
+  run_for(20);
+
+  EXPECT_TRUE(called);
+  EXPECT_FALSE(read.is_pending());
+  EXPECT_FALSE(HighFrequencyLoopRequester::is_high_frequency());
+}
+
+TEST(DeferredReadTest, StopsHighFrequencyLoopWhenComponentFails) {
+  Component component;
+  DeferredRead read(&component, "read");
+  bool called = false;
+
+  read.read_after(5, [&called]() { called = true; });
+  component.mark_failed();
+  run_for(20);
+
+  EXPECT_FALSE(called);
+  EXPECT_FALSE(read.is_pending());
+  EXPECT_FALSE(HighFrequencyLoopRequester::is_high_frequency());
+}
+
+TEST(DeferredReadTest, StopsWaitingForPinWhenComponentFails) {
+  Component component;
+  DeferredRead read(&component, "read");
+  FakePin pin;
+  bool called = false;
+
+  read.read_when(&pin, true, 1000, [&called](bool ready) { called = true; });
+  run_for(5);
+  EXPECT_TRUE(read.is_pending());
+  component.mark_failed();
+  pin.level = true;
+  run_for(5);
+
+  EXPECT_FALSE(called);
+  EXPECT_FALSE(read.is_pending());
+}
+
+TEST(DeferredReadTest, ReadsOfComponentsDontReplaceEachOther) {
+  Component first, second;
+  DeferredRead first_read(&first, "read");
+  DeferredRead second_read(&second, "read");
+  int calls = 0;
+
+  first_read.read_after(5, [&calls]() { calls++; });
+  second_read.read_after(5, [&calls]() { calls++; });
+  run_for(20);
+
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(DeferredReadTest, RunsAsItsComponent) {
+  Component component;
+  DeferredRead read(&component, "read");
+  bool called = false;
+
+  read.read_after(5, [&called]() { called = true; });
+  // the timeout belongs to the component, so blocking warnings and heap accounting name it
+  EXPECT_TRUE(App.scheduler.cancel_timeout(&component, "read"));
+  run_for(20);
+
+  EXPECT_FALSE(called);
+  EXPECT_FALSE(HighFrequencyLoopRequester::is_high_frequency());
+}
+
+TEST(DeferredReadTest, StopsHighFrequencyLoopWhenCancelled) {
+  Component component;
+  DeferredRead read(&component, "read");
+
+  read.read_after(5, []() {});
+  read.cancel();
+  run_for(1);
+
+  EXPECT_FALSE(read.is_pending());
+  EXPECT_FALSE(HighFrequencyLoopRequester::is_high_frequency());
+}
+
+}  // namespace esphome
@@ -0,0 +1,60 @@
+#include "esphome/core/entity_change_bus.h"
+#include "esphome/components/sensor/sensor.h"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+namespace esphome {
+
+using Change = std::pair<EntityType, uint16_t>;
+
+TEST(EntityChangeBusTest, DeliversChangesOnce) {
+  EntityChangeBus bus;
+  std::vector<Change> changes;
+  bus.subscribe([&changes](EntityType type, uint16_t index) { changes.emplace_back(type, index); });
+  for (int i = 0; i < 40; i++)
+    bus.register_entity(ENTITY_TYPE_SENSOR);
+  bus.register_entity(ENTITY_TYPE_SWITCH);
+
+  bus.mark_changed(ENTITY_TYPE_SENSOR, 35);
+  bus.mark_changed(ENTITY_TYPE_SENSOR, 35);
+  bus.mark_changed(ENTITY_TYPE_SWITCH, 0);
+  bus.drain(0);
+  bus.drain(0);
+
+  EXPECT_EQ(changes, (std::vector<Change>{{ENTITY_TYPE_SENSOR, 35}, {ENTITY_TYPE_SWITCH, 0}}));
+}
+
+TEST(EntityChangeBusTest, IgnoresUnregisteredEntities) {
+  EntityChangeBus bus;
+  std::vector<Change> changes;
+  bus.subscribe([&changes](EntityType type, uint16_t index) { changes.emplace_back(type, index); });
+  bus.register_entity(ENTITY_TYPE_SENSOR);
+
+  // no switch was registered, so its bitset is empty
+  bus.mark_changed(ENTITY_TYPE_SWITCH, 0);
+  bus.mark_changed(ENTITY_TYPE_SENSOR, 1);
+  bus.mark_changed(ENTITY_TYPE_SENSOR, ENTITY_INDEX_UNREGISTERED);
+  bus.flush(ENTITY_TYPE_SENSOR, ENTITY_INDEX_UNREGISTERED);
+  bus.drain(0);
+
+  EXPECT_TRUE(changes.empty());
+}
+
+TEST(EntityChangeBusTest, SensorCreatedInCodeIsNotDelivered) {
+  std::vector<Change> changes;
+  uint8_t subscriber = global_entity_change_bus.subscribe(
+      [&changes](EntityType type, uint16_t index) { changes.emplace_back(type, index); });
+  // like the sensors that components create themselves, without App.register_sensor()
+  sensor::Sensor sensor;
+  EXPECT_EQ(sensor.get_entity_index(), ENTITY_INDEX_UNREGISTERED);
+
+  sensor.publish_state(1.0f);
+  global_entity_change_bus.drain(subscriber);
+
+  EXPECT_TRUE(changes.empty());
+}
+
+}  // namespace esphome
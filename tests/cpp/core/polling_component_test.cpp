@@ -0,0 +1,74 @@
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/application.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+namespace esphome {
+
+/// Publishes the given values one per update() and records the interval the next poll is scheduled with.
+class FakePoller : public PollingComponent {
+ public:
+  FakePoller(std::vector<float> values) : PollingComponent(10), values_(std::move(values)) {
+    this->set_max_update_interval(80);
+    this->sensor.set_adaptive_polling(this, 0.5f);
+  }
+
+  void update() override {
+    this->intervals.push_back(this->current_update_interval_);
+    if (this->intervals.size() <= this->values_.size())
+      this->sensor.publish_state(this->values_[this->intervals.size() - 1]);
+  }
+  uint32_t get_current_update_interval() const { return this->current_update_interval_; }
+
+  sensor::Sensor sensor;
+  std::vector<uint32_t> intervals;
+
+ protected:
+  std::vector<float> values_;
+};
+
+static void run_polls(FakePoller &poller, size_t polls) {
+  poller.start_poller();
+  const uint32_t start = millis();
+  while (poller.intervals.size() < polls && millis() - start < 2000) {
+    App.scheduler.call();
+    delay(1);
+  }
+  poller.stop_poller();
+}
+
+TEST(PollingComponentTest, BacksOffWhileReadingsAreStable) {
+  // the first reading is a change, the next ones stay within 0.5 of it until 25.0
+  FakePoller poller({20.0f, 20.1f, 20.2f, 20.1f, 20.3f, 25.0f, 25.1f});
+
+  run_polls(poller, 7);
+
+  EXPECT_EQ(poller.intervals, (std::vector<uint32_t>{10, 10, 20, 40, 80, 80, 10}));
+  EXPECT_GT(poller.get_saved_polls(), 0u);
+}
+
+TEST(PollingComponentTest, ResetsAsSoonAsAReadingChanges) {
+  FakePoller poller({20.0f, 20.0f, 20.0f, 20.0f, 30.0f});
+
+  run_polls(poller, 5);
+
+  ASSERT_EQ(poller.intervals, (std::vector<uint32_t>{10, 10, 20, 40, 80}));
+  // the change in the last poll rescheduled the next poll at the configured interval
+  EXPECT_EQ(poller.get_current_update_interval(), 10u);
+}
+
+TEST(PollingComponentTest, KeepsIntervalWithoutReadings) {
+  FakePoller poller({});
+
+  run_polls(poller, 4);
+
+  EXPECT_EQ(poller.intervals, (std::vector<uint32_t>{10, 10, 10, 10}));
+  EXPECT_EQ(poller.get_saved_polls(), 0u);
+}
+
+}  // namespace esphome
@@ -0,0 +1,98 @@
+#include "esphome/components/ct_clamp/ct_clamp_sensor.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/components/host/virtual_clock.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace esphome {
+namespace ct_clamp {
+
+// the clock only moves when the code waits, so the readings and the loop timing are the same in every run
+static host::VirtualClock virtual_clock;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// A mains frequency sine on a DC offset, read by a 12 bit ADC with a 3.3 V range.
+class SineSampler : public voltage_sampler::VoltageSampler {
+ public:
+  SineSampler(float amplitude, uint32_t delay_us, float frequency = 50.0f)
+      : amplitude_(amplitude), delay_us_(delay_us), frequency_(frequency) {}
+
+  float sample() override {
+    delayMicroseconds(this->delay_us_);
+    const float t = micros() / 1e6f;
+    const float volts = 1.65f + this->amplitude_ * std::sin(2.0f * float(M_PI) * this->frequency_ * t);
+    return std::round(volts / 3.3f * 4095.0f) * 3.3f / 4095.0f;
+  }
+
+ protected:
+  float amplitude_;
+  uint32_t delay_us_;
+  float frequency_;
+};
+
+struct Measurement {
+  float value;
+  uint32_t longest_loop_us;
+  bool high_frequency;
+};
+
+static Measurement measure(SineSampler &sampler) {
+  CTClampSensor sensor;
+  sensor.set_source(&sampler);
+  sensor.set_sample_duration(1000);
+  sensor.update();
+
+  Measurement measurement{NAN, 0, false};
+  const uint32_t start = millis();
+  uint32_t random = 1;
+  while (!sensor.has_state() && millis() - start < 2000) {
+    const uint32_t loop_start = micros();
+    App.scheduler.call();
+    measurement.longest_loop_us = std::max(measurement.longest_loop_us, micros() - loop_start);
+    measurement.high_frequency |= HighFrequencyLoopRequester::is_high_frequency();
+    // the other components take up to 2 ms per iteration
+    random = random * 1103515245 + 12345;
+    delayMicroseconds((random >> 16) % 2000);
+    // then the main loop sleeps until the next scheduled item is due
+    delay(std::max<uint32_t>(App.scheduler.next_schedule_in().value_or(App.get_loop_interval()), 1));
+  }
+  measurement.value = sensor.state;
+  return measurement;
+}
+
+// Blocks of up to 1 ms every few loop iterations read only a part of the waveform, within a 1 s sampling phase the
+// RMS is within 5% of the real value.
+static const float TOLERANCE = 0.05f;
+
+TEST(CTClampSensorTest, MeasuresRmsOfFastSource) {
+  // like the ADC of an ESP32
+  SineSampler sampler(1.0f, 20);
+  Measurement measurement = measure(sampler);
+  EXPECT_NEAR(measurement.value, 1.0f / std::sqrt(2.0f), TOLERANCE * 1.0f / std::sqrt(2.0f));
+  EXPECT_LE(measurement.longest_loop_us, 2000u);
+  EXPECT_FALSE(measurement.high_frequency);
+}
+
+TEST(CTClampSensorTest, MeasuresRmsOf60HzCurrent) {
+  SineSampler sampler(1.0f, 20, 60.0f);
+  Measurement measurement = measure(sampler);
+  EXPECT_NEAR(measurement.value, 1.0f / std::sqrt(2.0f), TOLERANCE * 1.0f / std::sqrt(2.0f));
+  EXPECT_LE(measurement.longest_loop_us, 2000u);
+  EXPECT_FALSE(measurement.high_frequency);
+}
+
+TEST(CTClampSensorTest, MeasuresRmsOfSlowSource) {
+  // like an I2C ADC, 400 µs per reading
+  SineSampler sampler(0.5f, 400);
+  Measurement measurement = measure(sampler);
+  EXPECT_NEAR(measurement.value, 0.5f / std::sqrt(2.0f), TOLERANCE * 0.5f / std::sqrt(2.0f));
+  // a few readings per iteration
+  EXPECT_LE(measurement.longest_loop_us, 2000u);
+  EXPECT_FALSE(measurement.high_frequency);
+}
+
+}  // namespace ct_clamp
+}  // namespace esphome
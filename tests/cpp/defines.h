@@ -0,0 +1,11 @@
+#pragma once
+// The defines the C++ unit tests are built with, in place of the ones generated for a configuration.
+#include "esphome/core/macros.h"
+
+#define ESPHOME_BOARD "host"
+#define ESPHOME_VARIANT "host"
+
+#define USE_HTTP_REQUEST_ASYNC
+#define USE_LOGGER_DEFERRED
+#define USE_SENSOR
+#define USE_SOCKET_IMPL_BSD_SOCKETS
@@ -0,0 +1,103 @@
+#include "esphome/components/dht/dht.h"
+#include "esphome/components/host/virtual_clock.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace esphome {
+namespace dht {
+
+// the clock only moves when the driver waits or reads the pin, a busy host can't make the driver miss a bit
+static host::VirtualClock virtual_clock;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// The data line of a DHT11 that measures 45% and 23°C, answering in real time like the sensor.
+class SimulatedDHT11 : public InternalGPIOPin {
+ public:
+  void setup() override {}
+  void pin_mode(gpio::Flags flags) override {
+    if (flags & gpio::FLAG_OUTPUT) {
+      this->low_since_ = micros();
+    } else if (micros() - this->low_since_ >= 18000) {
+      // the start signal was long enough, the sensor answers once the line is released
+      this->released_ = micros();
+      this->answering_ = true;
+    }
+  }
+  bool digital_read() override {
+    // like on the MCU, reading the pin takes time
+    delayMicroseconds(1);
+    return this->answering_ ? this->level_at_(micros() - this->released_) : true;
+  }
+  void digital_write(bool value) override {}
+  std::string dump_summary() const override { return "simulated DHT11"; }
+  void detach_interrupt() const override {}
+  ISRInternalGPIOPin to_isr() const override { return {}; }
+  uint8_t get_pin() const override { return 0; }
+  bool is_inverted() const override { return false; }
+
+ protected:
+  void attach_interrupt(void (*func)(void *), void *arg, gpio::InterruptType type) const override {}
+
+  /// The level of the line `t` µs after the host released it.
+  bool level_at_(uint32_t t) const {
+    // 30 µs pulled up by the host, then the response of the sensor: 80 µs low and 80 µs high
+    if (t < 30)
+      return true;
+    if (t < 190)
+      return t >= 110;
+    t -= 190;
+    // every bit is 50 µs low, followed by 27 µs high for a 0 and 70 µs high for a 1
+    for (uint8_t byte : DATA) {
+      for (int bit = 7; bit >= 0; bit--) {
+        const uint32_t high = (byte >> bit) & 1 ? 70 : 27;
+        if (t < 50 + high)
+          return t >= 50;
+        t -= 50 + high;
+      }
+    }
+    return t >= 50;
+  }
+
+  static constexpr uint8_t DATA[5] = {45, 0, 23, 0, 68};
+  uint32_t low_since_{0};
+  uint32_t released_{0};
+  bool answering_{false};
+};
+
+TEST(DHTTest, DoesntBlockForTheStartSignal) {
+  SimulatedDHT11 pin;
+  sensor::Sensor temperature, humidity;
+  DHT dht;
+  dht.set_pin(&pin);
+  dht.set_dht_model(DHT_MODEL_DHT11);
+  dht.set_temperature_sensor(&temperature);
+  dht.set_humidity_sensor(&humidity);
+
+  uint32_t start = micros();
+  dht.update();
+  const uint32_t update_us = micros() - start;
+
+  // the main loop runs the read once the line was held low for 18 ms
+  uint32_t longest_call_us = 0;
+  start = millis();
+  while (!temperature.has_state() && millis() - start < 100) {
+    const uint32_t call_start = micros();
+    App.scheduler.call();
+    longest_call_us = std::max(longest_call_us, micros() - call_start);
+    delay(1);
+  }
+
+  EXPECT_FLOAT_EQ(temperature.state, 23.0f);
+  EXPECT_FLOAT_EQ(humidity.state, 45.0f);
+  // blocking for the start signal took 18 ms, reading the 40 bits takes about 4 ms
+  EXPECT_EQ(update_us, 0u);
+  EXPECT_LT(longest_call_us, 10000u);
+  EXPECT_FALSE(HighFrequencyLoopRequester::is_high_frequency());
+}
+
+}  // namespace dht
+}  // namespace esphome
@@ -0,0 +1,111 @@
+#include "esphome/components/graph/graph.h"
+#include "esphome/core/hal.h"
+#include "esphome/components/host/virtual_clock.h"
+
+#include <gtest/gtest.h>
+
+namespace esphome {
+namespace graph {
+
+// the clock only moves when the test waits, so the samples fall into the columns the tests expect
+static host::VirtualClock virtual_clock;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static const uint32_t COLUMN_TIME = 100;
+
+/// A history of `length` columns of 100 ms each.
+static void init(HistoryData &history, int length) {
+  history.init(length);
+  history.set_update_time_ms(COLUMN_TIME);
+}
+
+/// Take one sample per column, every sample closes the column of the previous one.
+static void fill_columns(HistoryData &history, int from, int to) {
+  for (int value = from; value < to; value++) {
+    delay(COLUMN_TIME);
+    history.take_sample(value);
+  }
+}
+
+TEST(HistoryDataTest, KeepsSpikesBetweenColumns) {
+  HistoryData history;
+  init(history, 10);
+
+  // nine samples in the first column, the tenth starts the next one
+  for (int i = 0; i < 10; i++) {
+    delay(COLUMN_TIME / 10);
+    history.take_sample(i == 4 ? 50.0f : 1.0f);
+  }
+
+  EXPECT_FLOAT_EQ(history.get_value_max(0), 50.0f);
+  EXPECT_FLOAT_EQ(history.get_value_min(0), 1.0f);
+  EXPECT_NEAR(history.get_value(0), 58.0f / 9.0f, 0.01f);
+}
+
+TEST(HistoryDataTest, UsesLessMemoryThanAFloatPerColumn) {
+  HistoryData history;
+  init(history, 128);
+
+  EXPECT_LE(history.get_memory_usage(), 128 * sizeof(float));
+}
+
+TEST(HistoryDataTest, MergesOlderColumns) {
+  HistoryData history;
+  init(history, 16);
+
+  // the columns hold 0 (before the first sample), 0, 1, ..., 30
+  fill_columns(history, 0, 32);
+
+  // newer half, one column per bucket
+  for (int idx = 0; idx < 8; idx++)
+    EXPECT_FLOAT_EQ(history.get_value(idx), 30 - idx);
+  // older half, four columns per bucket: 19..22 and 15..18
+  for (int idx = 8; idx < 12; idx++) {
+    EXPECT_FLOAT_EQ(history.get_value(idx), 20.5f);
+    EXPECT_FLOAT_EQ(history.get_value_min(idx), 19.0f);
+    EXPECT_FLOAT_EQ(history.get_value_max(idx), 22.0f);
+  }
+  for (int idx = 12; idx < 16; idx++)
+    EXPECT_FLOAT_EQ(history.get_value(idx), 16.5f);
+}
+
+TEST(HistoryDataTest, TracksMinMaxOfHistory) {
+  HistoryData history;
+  init(history, 16);
+
+  fill_columns(history, 0, 32);
+
+  // the columns up to 14 left the history, 31 is the column being filled
+  EXPECT_FLOAT_EQ(history.get_recent_min(), 15.0f);
+  EXPECT_FLOAT_EQ(history.get_recent_max(), 31.0f);
+}
+
+TEST(HistoryDataTest, KeepsPrecisionOfLargeValues) {
+  HistoryData history;
+  init(history, 16);
+
+  // an air pressure in Pa, only the difference to the first value is stored at half precision
+  for (int i = 0; i < 10; i++) {
+    delay(COLUMN_TIME);
+    history.take_sample(101325.0f + i * 0.25f);
+  }
+  EXPECT_NEAR(history.get_value(0), 101325.0f + 8 * 0.25f, 0.01f);
+}
+
+TEST(HistoryDataTest, RescalesForGrowingValues) {
+  HistoryData history;
+  init(history, 16);
+
+  // an energy counter, the values soon leave the range of half precision floats
+  for (int i = 0; i < 20; i++) {
+    delay(COLUMN_TIME);
+    history.take_sample(i * 100000.0f + 1.0f);
+  }
+  for (int idx = 0; idx < 8; idx++) {
+    const float expected = (18 - idx) * 100000.0f + 1.0f;
+    EXPECT_NEAR(history.get_value(idx), expected, expected * 1e-3f);
+  }
+  EXPECT_NEAR(history.get_recent_max(), 1900001.0f, 1900001.0f * 1e-3f);
+}
+
+}  // namespace graph
+}  // namespace esphome
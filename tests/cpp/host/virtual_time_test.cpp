@@ -0,0 +1,59 @@
+#include "esphome/components/host/virtual_clock.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+
+#include <gtest/gtest.h>
+
+namespace esphome {
+namespace host {
+
+static VirtualClock virtual_clock;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+TEST(VirtualTimeTest, LoopJumpsToNextTimer) {
+  Component component;
+  bool fired = false;
+  const uint32_t start = millis();
+  uint32_t fired_at = 0;
+  App.scheduler.set_timeout(&component, "jump", 5000, [&]() {
+    fired = true;
+    fired_at = millis();
+  });
+
+  int loops = 0;
+  while (!fired && loops < 100) {
+    App.loop();
+    loops++;
+  }
+
+  EXPECT_TRUE(fired);
+  EXPECT_EQ(fired_at - start, 5000u);
+  // one loop waits for the timer, the next one runs it
+  EXPECT_LE(loops, 3);
+}
+
+TEST(VirtualTimeTest, HighFrequencyLoopSeesEveryMillisecond) {
+  Component component;
+  bool fired = false;
+  App.scheduler.set_timeout(&component, "later", 5000, [&fired]() { fired = true; });
+  HighFrequencyLoopRequester high_freq;
+  high_freq.start();
+
+  for (int i = 0; i < 10; i++) {
+    const uint32_t before = millis();
+    App.loop();
+    EXPECT_EQ(millis() - before, 1u);
+  }
+
+  high_freq.stop();
+  while (!fired)
+    App.loop();
+}
+
+TEST(VirtualTimeTest, EpochFollowsTheClock) {
+  arch_set_epoch(1700000000);
+  delay(90000);
+  EXPECT_EQ(arch_get_epoch(), 1700000090);
+}
+
+}  // namespace host
+}  // namespace esphome
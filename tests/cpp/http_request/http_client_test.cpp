@@ -0,0 +1,184 @@
+#include "esphome/components/http_request/http_client.h"
+#include "esphome/core/hal.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace http_request {
+
+/// Answers the requests of the client from the same thread, every path has a canned response.
+class FakeServer {
+ public:
+  FakeServer() {
+    this->fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::bind(this->fd_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+    socklen_t len = sizeof(addr);
+    ::getsockname(this->fd_, reinterpret_cast<sockaddr *>(&addr), &len);
+    this->port_ = ntohs(addr.sin_port);
+    ::listen(this->fd_, 4);
+    ::fcntl(this->fd_, F_SETFL, O_NONBLOCK);
+  }
+  ~FakeServer() {
+    for (auto &client : this->clients_)
+      ::close(client.fd);
+    ::close(this->fd_);
+  }
+
+  std::string url(const std::string &path) const { return "http://127.0.0.1:" + std::to_string(this->port_) + path; }
+  void respond(const std::string &path, const std::string &response) { this->responses_[path] = response; }
+  const std::vector<std::string> &get_paths() const { return this->paths_; }
+
+  void poll() {
+    int fd = ::accept(this->fd_, nullptr, nullptr);
+    if (fd >= 0) {
+      ::fcntl(fd, F_SETFL, O_NONBLOCK);
+      this->clients_.push_back({fd, ""});
+    }
+    for (auto &client : this->clients_) {
+      char buf[512];
+      ssize_t n = ::read(client.fd, buf, sizeof(buf));
+      if (n > 0)
+        client.received.append(buf, n);
+      size_t end;
+      while ((end = client.received.find("\r\n\r\n")) != std::string::npos) {
+        // "GET /path HTTP/1.1"
+        size_t start = client.received.find(' ') + 1;
+        std::string path = client.received.substr(start, client.received.find(' ', start) - start);
+        client.received.erase(0, end + 4);
+        this->paths_.push_back(path);
+        const std::string &response = this->responses_[path];
+        ::write(client.fd, response.data(), response.size());
+      }
+    }
+  }
+
+ protected:
+  struct Client {
+    int fd;
+    std::string received;
+  };
+
+  int fd_;
+  uint16_t port_;
+  std::vector<Client> clients_;
+  std::map<std::string, std::string> responses_;
+  std::vector<std::string> paths_;
+};
+
+struct Result {
+  bool done{false};
+  int32_t status_code{0};
+  std::string body;
+};
+
+static Result run(AsyncHttpClient &client, FakeServer &server, const std::string &url) {
+  Result result;
+  AsyncHttpRequest request;
+  request.method = "GET";
+  request.url = url;
+  request.on_data = [&result](const uint8_t *data, size_t len) {
+    result.body.append(reinterpret_cast<const char *>(data), len);
+  };
+  request.on_complete = [&result](int32_t status_code, uint32_t) {
+    result.done = true;
+    result.status_code = status_code;
+  };
+  client.send(std::move(request));
+  uint32_t start = millis();
+  while (!result.done && millis() - start < 3000) {
+    client.loop();
+    server.poll();
+    delay(1);
+  }
+  return result;
+}
+
+TEST(AsyncHttpClientTest, FollowsRedirectWithChunkedBody) {
+  FakeServer server;
+  server.respond("/old", "HTTP/1.1 302 Found\r\n"
+                         "Location: /new\r\n"
+                         "Transfer-Encoding: chunked\r\n"
+                         "\r\n"
+                         "5\r\nmoved\r\n0\r\n\r\n");
+  server.respond("/new", "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok");
+  AsyncHttpClient client;
+  client.set_timeout(1000);
+
+  Result result = run(client, server, server.url("/old"));
+
+  EXPECT_TRUE(result.done);
+  EXPECT_EQ(result.status_code, 200);
+  // the body of the redirect is dropped
+  EXPECT_EQ(result.body, "ok");
+  EXPECT_EQ(server.get_paths(), (std::vector<std::string>{"/old", "/new"}));
+}
+
+TEST(AsyncHttpClientTest, DecodesChunkedBody) {
+  FakeServer server;
+  server.respond("/", "HTTP/1.1 200 OK\r\n"
+                      "Transfer-Encoding: chunked\r\n"
+                      "\r\n"
+                      "3\r\nfoo\r\n4\r\n bar\r\n0\r\n\r\n");
+  AsyncHttpClient client;
+  client.set_timeout(1000);
+
+  Result result = run(client, server, server.url("/"));
+
+  EXPECT_EQ(result.status_code, 200);
+  EXPECT_EQ(result.body, "foo bar");
+  // the connection is kept for the next request
+  EXPECT_EQ(client.idle_connections(), 1u);
+}
+
+TEST(AsyncHttpClientTest, OnlyReportsDataToProcess) {
+  FakeServer server;
+  server.respond("/large", "HTTP/1.1 200 OK\r\nContent-Length: 10000\r\n\r\n" + std::string(10000, 'x'));
+  AsyncHttpClient client;
+  client.set_timeout(1000);
+  Result result;
+  AsyncHttpRequest request;
+  request.method = "GET";
+  request.url = server.url("/large");
+  request.on_data = [&result](const uint8_t *data, size_t len) {
+    result.body.append(reinterpret_cast<const char *>(data), len);
+  };
+  request.on_complete = [&result](int32_t status_code, uint32_t) {
+    result.done = true;
+    result.status_code = status_code;
+  };
+  client.send(std::move(request));
+
+  // connecting and waiting for the response doesn't need the high frequency loop
+  for (int i = 0; i < 10; i++) {
+    EXPECT_FALSE(client.loop());
+    delay(1);
+  }
+  EXPECT_EQ(client.queued(), 1u);
+
+  server.poll();
+  // one loop doesn't read the whole body
+  EXPECT_TRUE(client.loop());
+  uint32_t start = millis();
+  while (!result.done && millis() - start < 3000)
+    client.loop();
+
+  EXPECT_EQ(result.status_code, 200);
+  EXPECT_EQ(result.body.size(), 10000u);
+  EXPECT_FALSE(client.loop());
+}
+
+}  // namespace http_request
+}  // namespace esphome
@@ -0,0 +1,114 @@
+#include "esphome/components/ads1115/ads1115.h"
+#include "esphome/components/i2c/i2c_bus_host.h"
+#include "esphome/components/host/virtual_clock.h"
+#include "esphome/core/hal.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace esphome {
+namespace i2c {
+
+// the bus transfers and the conversion waits advance the clock, so the timings below don't depend on the host
+static host::VirtualClock virtual_clock;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static const size_t SENSORS = 20;
+
+/// 20 single-shot ADS1115 with one sensor each on a simulated 400 kHz bus.
+class ADS1115BusTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    this->bus_.set_frequency(400000);
+    for (size_t i = 0; i < SENSORS; i++) {
+      auto address = static_cast<uint8_t>(0x40 + i);
+      this->bus_.add_device(address);
+      this->adcs_.emplace_back(new ads1115::ADS1115Component());  // NOLINT
+      auto *adc = this->adcs_.back().get();
+      adc->set_i2c_bus(&this->bus_);
+      adc->set_i2c_address(address);
+      adc->set_continuous_mode(false);
+      adc->setup();
+      this->sensors_.emplace_back(new ads1115::ADS1115Sensor(adc));  // NOLINT
+      auto *sensor = this->sensors_.back().get();
+      sensor->set_multiplexer(ads1115::ADS1115_MULTIPLEXER_P0_NG);
+      sensor->set_gain(ads1115::ADS1115_GAIN_4P096);
+      sensor->set_resolution(ads1115::ADS1115_16_BITS);
+      adc->register_sensor(sensor);
+    }
+  }
+
+  bool all_published() const {
+    return std::all_of(this->sensors_.begin(), this->sensors_.end(),
+                       [](const std::unique_ptr<ads1115::ADS1115Sensor> &sensor) { return sensor->has_state(); });
+  }
+
+  HostI2CBus bus_;
+  std::vector<std::unique_ptr<ads1115::ADS1115Component>> adcs_;
+  std::vector<std::unique_ptr<ads1115::ADS1115Sensor>> sensors_;
+};
+
+TEST_F(ADS1115BusTest, BlockingSamplesHoldTheLoop) {
+  const uint32_t start = micros();
+  for (auto &sensor : this->sensors_)
+    EXPECT_FALSE(std::isnan(sensor->sample()));
+  const uint32_t blocked_us = micros() - start;
+
+  // the conversion delay of 2 ms per sensor and the transfers, all in one loop iteration: 48.5 ms
+  EXPECT_GE(blocked_us, SENSORS * 2000u);
+}
+
+TEST_F(ADS1115BusTest, TransactionsShareTheBus) {
+  const uint32_t start = micros();
+  for (auto &sensor : this->sensors_)
+    sensor->update();
+  uint32_t longest_loop_us = 0;
+  while (!this->all_published() && micros() - start < 100000) {
+    const uint32_t loop_start = micros();
+    this->bus_.loop();
+    longest_loop_us = std::max(longest_loop_us, micros() - loop_start);
+    // the rest of a loop iteration
+    delayMicroseconds(100);
+  }
+  const uint32_t total_us = micros() - start;
+
+  ASSERT_TRUE(this->all_published());
+  // every device converts while the bus serves the others, the total is about the time of the transfers: 8.7 ms
+  EXPECT_LT(total_us, SENSORS * 500u);
+  // the longest loop iteration reads the results of all devices, but never waits for a conversion: 6.3 ms
+  EXPECT_LT(longest_loop_us, SENSORS * 400u);
+  EXPECT_FALSE(HighFrequencyLoopRequester::is_high_frequency());
+
+  const auto &statistics = this->bus_.get_statistics();
+  ASSERT_EQ(statistics.size(), SENSORS);
+  for (const auto &stats : statistics) {
+    EXPECT_EQ(stats.errors, 0u);
+    EXPECT_GE(stats.wait_time_us, 2000u);
+  }
+}
+
+TEST_F(ADS1115BusTest, ReportsMissingDevice) {
+  HostI2CBus empty_bus;
+  ads1115::ADS1115Component adc;
+  adc.set_i2c_bus(&empty_bus);
+  adc.set_i2c_address(0x48);
+  adc.set_continuous_mode(false);
+  ads1115::ADS1115Sensor sensor(&adc);
+  adc.register_sensor(&sensor);
+
+  sensor.update();
+  for (int i = 0; i < 10; i++) {
+    empty_bus.loop();
+    delay(1);
+  }
+
+  EXPECT_FALSE(sensor.has_state());
+  EXPECT_TRUE(adc.status_has_warning());
+  ASSERT_EQ(empty_bus.get_statistics().size(), 1u);
+  EXPECT_EQ(empty_bus.get_statistics()[0].errors, 1u);
+}
+
+}  // namespace i2c
+}  // namespace esphome
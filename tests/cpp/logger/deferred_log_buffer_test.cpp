@@ -0,0 +1,78 @@
+#include "esphome/components/logger/deferred_log_buffer.h"
+#include "esphome/core/log.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdarg>
+#include <string>
+
+namespace esphome {
+namespace logger {
+
+static DeferredPushResult push(DeferredLogBuffer &buffer, bool truncate, const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  DeferredPushResult result = buffer.push(ESPHOME_LOG_LEVEL_DEBUG, "test", 1, format, args, truncate);
+  va_end(args);
+  return result;
+}
+
+static std::string pop(DeferredLogBuffer &buffer) {
+  const DeferredLogRecord *record = buffer.front();
+  if (record == nullptr)
+    return "<empty>";
+  char out[512];
+  DeferredLogBuffer::format(*record, out, sizeof(out));
+  buffer.pop();
+  return out;
+}
+
+TEST(DeferredLogBufferTest, FormatsRecordedArguments) {
+  DeferredLogBuffer buffer(4);
+  std::string name = "sensor";
+  EXPECT_EQ(push(buffer, false, "'%s': %.1f %s (%d%%)", name.c_str(), 21.25, "°C", 42), DEFERRED_PUSHED);
+  // the copy of the string is formatted, not the original
+  name = "changed";
+  EXPECT_EQ(pop(buffer), "'sensor': 21.2 °C (42%)");
+  EXPECT_EQ(pop(buffer), "<empty>");
+}
+
+TEST(DeferredLogBufferTest, HonorsStringPrecision) {
+  DeferredLogBuffer buffer(4);
+  // not null terminated, the precision must not be read past
+  const char data[4] = {'a', 'b', 'c', 'd'};
+  EXPECT_EQ(push(buffer, false, "[%.3s] [%.*s] [%.4s]", "abcdef", 2, "xyz", data), DEFERRED_PUSHED);
+  EXPECT_EQ(pop(buffer), "[abc] [xy] [abcd]");
+}
+
+TEST(DeferredLogBufferTest, LongMessageIsNotTruncated) {
+  DeferredLogBuffer buffer(4);
+  std::string text(300, 'x');
+  EXPECT_EQ(push(buffer, false, "%s", text.c_str()), DEFERRED_TOO_LONG);
+  EXPECT_EQ(pop(buffer), "<empty>");
+
+  // a long precision only copies what is used
+  EXPECT_EQ(push(buffer, false, "%.20s", text.c_str()), DEFERRED_PUSHED);
+  EXPECT_EQ(pop(buffer), std::string(20, 'x'));
+}
+
+TEST(DeferredLogBufferTest, LongMessageIsTruncatedOnRequest) {
+  DeferredLogBuffer buffer(4);
+  std::string text(300, 'x');
+  EXPECT_EQ(push(buffer, true, "%s", text.c_str()), DEFERRED_PUSHED);
+  EXPECT_EQ(pop(buffer), std::string(DEFERRED_LOG_PAYLOAD_SIZE - 1, 'x'));
+}
+
+TEST(DeferredLogBufferTest, ReportsFullRing) {
+  DeferredLogBuffer buffer(2);
+  EXPECT_EQ(push(buffer, false, "%d", 1), DEFERRED_PUSHED);
+  EXPECT_EQ(push(buffer, false, "%d", 2), DEFERRED_PUSHED);
+  EXPECT_EQ(push(buffer, false, "%d", 3), DEFERRED_FULL);
+  EXPECT_EQ(pop(buffer), "1");
+  EXPECT_EQ(push(buffer, false, "%d", 3), DEFERRED_PUSHED);
+  EXPECT_EQ(pop(buffer), "2");
+  EXPECT_EQ(pop(buffer), "3");
+}
+
+}  // namespace logger
+}  // namespace esphome
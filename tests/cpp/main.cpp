@@ -0,0 +1,10 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+// The host platform provides main(), the tests run in place of the configured components.
+void setup() {
+  testing::InitGoogleTest();
+  exit(RUN_ALL_TESTS());
+}
+void loop() {}
@@ -0,0 +1,112 @@
+#include "esphome/components/nextion/nextion.h"
+#include "esphome/components/uart/uart_component.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace nextion {
+
+/// A UART that records the commands written to it.
+class RecordingUART : public uart::UARTComponent {
+ public:
+  void write_array(const uint8_t *data, size_t len) override {
+    for (size_t i = 0; i < len; i++) {
+      if (data[i] == 0xFF) {
+        // the end of a command is marked with three 0xFF
+        if (!this->current_.empty())
+          this->commands.push_back(this->current_);
+        this->current_.clear();
+      } else {
+        this->current_ += static_cast<char>(data[i]);
+      }
+    }
+  }
+  bool peek_byte(uint8_t *data) override { return false; }
+  bool read_array(uint8_t *data, size_t len) override { return false; }
+  int available() override { return 0; }
+  void flush() override {}
+
+  std::vector<std::string> commands;
+
+ protected:
+  void check_logger_conflict() override {}
+
+  std::string current_;
+};
+
+/// A display that is set up and is acknowledged by the test.
+class TestNextion : public Nextion {
+ public:
+  TestNextion(RecordingUART *uart) {
+    this->set_uart_parent(uart);
+    this->is_setup_ = true;
+  }
+
+  /// Acknowledge the oldest command in flight, like a response of the display does.
+  void acknowledge() {
+    this->release_queue_entry_(this->nextion_queue_.front());
+    this->nextion_queue_.pop_front();
+    this->send_pending_commands_();
+  }
+};
+
+TEST(NextionPendingCommandsTest, ReplacesWaitingAssignment) {
+  RecordingUART uart;
+  TestNextion display(&uart);
+  display.set_max_commands_in_flight(1);
+
+  display.set_component_text("t1", "busy");
+  display.set_component_text("t0", "a");
+  display.set_component_text("t0", "b");
+  EXPECT_EQ(display.pending_queue_size(), 1u);
+  EXPECT_EQ(display.get_superseded_commands(), 1u);
+
+  display.acknowledge();
+  EXPECT_EQ(uart.commands, (std::vector<std::string>{"t1.txt=\"busy\"", "t0.txt=\"b\""}));
+}
+
+TEST(NextionPendingCommandsTest, KeepsAssignmentsBehindPageChange) {
+  RecordingUART uart;
+  TestNextion display(&uart);
+  display.set_max_commands_in_flight(1);
+
+  display.set_component_text("t1", "busy");
+  display.set_component_text("t0", "a");
+  display.goto_page(1);
+  display.set_component_text("t0", "b");
+  // the second assignment is meant for the page that is shown after the page change
+  EXPECT_EQ(display.pending_queue_size(), 3u);
+  EXPECT_EQ(display.get_superseded_commands(), 0u);
+
+  display.acknowledge();
+  display.acknowledge();
+  display.acknowledge();
+  EXPECT_EQ(uart.commands,
+            (std::vector<std::string>{"t1.txt=\"busy\"", "t0.txt=\"a\"", "page 1", "t0.txt=\"b\""}));
+}
+
+TEST(NextionPendingCommandsTest, ReplacesAssignmentAfterPageChange) {
+  RecordingUART uart;
+  TestNextion display(&uart);
+  display.set_max_commands_in_flight(1);
+
+  display.set_component_text("t1", "busy");
+  display.set_component_text("t0", "a");
+  display.goto_page(1);
+  display.set_component_text("t0", "b");
+  display.set_component_text("t0", "c");
+  EXPECT_EQ(display.pending_queue_size(), 3u);
+  EXPECT_EQ(display.get_superseded_commands(), 1u);
+
+  display.acknowledge();
+  display.acknowledge();
+  display.acknowledge();
+  EXPECT_EQ(uart.commands,
+            (std::vector<std::string>{"t1.txt=\"busy\"", "t0.txt=\"a\"", "page 1", "t0.txt=\"c\""}));
+}
+
+}  // namespace nextion
+}  // namespace esphome
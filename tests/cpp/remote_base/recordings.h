@@ -0,0 +1,181 @@
+#pragma once
+
+#include "esphome/components/remote_base/remote_base.h"
+
+#include <vector>
+
+namespace esphome {
+namespace remote_base {
+
+/// A received frame as the raw dumper logs it, without the idle space that ends it.
+struct Recording {
+  const char *protocol;
+  RawTimings timings;
+};
+
+/** One frame of every protocol in remote_base.
+ *
+ * The frames are what the encoders send after passing a receiver: IR marks are 40 µs longer and spaces 40 µs shorter
+ * like at the output of a demodulating receiver, RF pulses 20 µs, and every timing is off by up to 10 µs more.
+ * Repeated packets that are closer together than the idle time of 10 ms stay in the frame.
+ */
+static const std::vector<Recording> RECORDINGS = {
+    {"AEHA",  // address=0x2002, data=0x80.3D.00.00.BD
+     {3444, -1670, 467, -383, 464, -394, 464, -1232, 465, -390, 459, -377, 469, -392, 458, -388, 467, -379, 455, -387,
+      464, -388, 469, -387, 471, -386, 470, -385, 475, -385, 457, -1239, 467, -387, 461, -1239, 466, -389, 474, -394,
+      472, -390, 466, -394, 460, -391, 470, -379, 464, -384, 468, -380, 455, -383, 465, -1238, 459, -1245, 472, -1236,
+      467, -1242, 461, -379, 474, -1227, 464, -376, 465, -388, 463, -387, 458, -393, 455, -382, 474, -387, 463, -375,
+      467, -394, 470, -382, 475, -385, 469, -384, 468, -378, 472, -392, 470, -378, 471, -384, 458, -384, 475, -1238,
+      465, -379, 475, -1236, 456, -1238, 460, -1243, 458, -1237, 457, -393, 463, -1234, 473}},
+    {"ByronSX",  // address=0x45, command=0x0C
+     {347, -310, 688, -647, 348, -321, 680, -310, 696, -318, 683, -656, 357, -323, 695, -640, 353, -645, 363, -656, 361,
+      -323, 680, -322, 684}},
+    {"CanalSat",  // device=0x25, address=0x00, command=0x10
+     {291, -453, 544, -454, 290, -207, 531, -453, 535, -453, 294, -218, 289, -212, 291, -218, 280, -204, 285, -211, 282,
+      -219, 297, -206, 295, -214, 284, -211, 542, -468, 295, -219, 281, -203, 289, -212, 280, -202, 282}},
+    {"CanalSatLD",  // device=0x10, address=0x01, command=0x2C
+     {365, -600, 354, -285, 682, -608, 366, -288, 366, -283, 365, -282, 369, -274, 366, -272, 351, -289, 350, -284, 356,
+      -280, 670, -604, 370, -279, 358, -278, 670, -592, 687, -271, 353, -597, 367, -285, 363, -275, 351}},
+    {"Coolix",  // 0xB2BFD0
+     {4524, -4441, 601, -1650, 603, -519, 601, -1648, 605, -1631, 599, -523, 595, -514, 600, -1648, 604, -515, 605,
+      -530, 605, -1644, 604, -511, 605, -511, 600, -1633, 602, -1635, 595, -518, 597, -1646, 600, -1640, 605, -511, 590,
+      -1638, 599, -1639, 601, -1642, 598, -1636, 595, -1649, 594, -1636, 608, -517, 595, -1640, 595, -511, 598, -511,
+      606, -522, 609, -511, 605, -528, 604, -512, 604, -1637, 606, -1647, 592, -518, 607, -1634, 600, -511, 593, -515,
+      592, -525, 606, -511, 590, -525, 604, -523, 595, -1636, 590, -526, 592, -1643, 598, -1643, 602, -1650, 592, -1644,
+      601, -5553, 4520, -4433, 602, -1643, 605, -512, 608, -1641, 600, -1633, 610, -530, 607, -524, 593, -1639, 608,
+      -516, 606, -514, 597, -1644, 596, -527, 605, -529, 593, -1643, 599, -1634, 610, -528, 594, -1646, 602, -1649, 601,
+      -517, 599, -1642, 595, -1636, 591, -1644, 591, -1646, 592, -1647, 592, -1638, 610, -512, 591, -1648, 592, -518,
+      590, -523, 605, -510, 591, -517, 598, -511, 602, -523, 598, -1635, 605, -1639, 596, -512, 592, -1646, 605, -520,
+      592, -528, 603, -524, 606, -523, 591, -521, 601, -517, 601, -1634, 603, -511, 598, -1638, 603, -1650, 592, -1642,
+      594, -1641, 605}},
+    {"Dish",  // address=1, command=0x11
+     {436, -6064, 448, -2763, 433, -1656, 434, -2759, 439, -2765, 440, -2761, 442, -1657, 431, -2766, 434, -2754, 450,
+      -2770, 431, -2755, 431, -2755, 450, -2755, 443, -2756, 443, -2766, 439, -2758, 447, -2753, 432, -2766, 446, -6059,
+      447, -2764, 437, -1661, 431, -2769, 448, -2750, 443, -2751, 434, -1655, 431, -2761, 444, -2766, 434, -2752, 431,
+      -2753, 436, -2753, 433, -2763, 441, -2769, 434, -2753, 447, -2768, 443, -2763, 448, -2755, 448, -6069, 449, -2758,
+      448, -1660, 433, -2757, 432, -2753, 448, -2768, 433, -1654, 440, -2751, 437, -2758, 442, -2750, 435, -2753, 432,
+      -2766, 450, -2763, 430, -2770, 433, -2767, 443, -2767, 449, -2761, 437, -2750, 430, -6064, 440, -2767, 449, -1653,
+      435, -2756, 432, -2756, 437, -2764, 435, -1663, 436, -2753, 445, -2758, 437, -2753, 431, -2754, 441, -2759, 449,
+      -2758, 435, -2750, 437, -2764, 431, -2751, 434, -2752, 438, -2750, 432}},
+    {"Drayton",  // address=0x1234, channel=0x05, command=0x01, three packets
+     {512, -473, 520, -482, 513, -488, 516, -472, 512, -490, 522, -489, 1016, -1475, 516, -477, 510, -486, 1029, -982,
+      519, -477, 1028, -989, 512, -478, 515, -477, 1017, -483, 514, -979, 1018, -972, 520, -480, 514, -471, 525, -484,
+      518, -484, 524, -487, 510, -472, 522, -471, 1029, -972, 522, -470, 1029, -982, 1023, -489, 519, -483, 519, -483,
+      530, -476, 524, -486, 529, -477, 517, -485, 1012, -1489, 515, -483, 530, -475, 1019, -984, 511, -489, 1016, -989,
+      527, -475, 512, -490, 1020, -477, 528, -990, 1012, -985, 510, -474, 517, -479, 512, -470, 513, -488, 516, -473,
+      513, -477, 522, -485, 1013, -989, 529, -488, 1024, -970, 1026, -486, 517, -476, 527, -482, 526, -472, 514, -486,
+      516, -484, 522, -474, 1014, -1470, 529, -471, 513, -479, 1010, -973, 517, -474, 1014, -976, 518, -470, 527, -480,
+      1029, -489, 530, -972, 1029, -990, 514, -484, 529, -482, 521, -471, 527, -484, 515, -483, 515, -488, 513, -484,
+      1021, -979, 513, -477, 1028, -972, 1030}},
+    {"Haier",  // A6 12 00 00 40 20 00 80 00 00 00 00 05
+     {3143, -3058, 3133, -4365, 578, -1609, 590, -530, 584, -1609, 586, -534, 574, -546, 573, -1604, 580, -1606, 581,
+      -547, 582, -542, 571, -540, 584, -538, 583, -1611, 580, -533, 570, -544, 587, -1618, 579, -548, 588, -549, 573,
+      -536, 581, -530, 574, -533, 580, -531, 589, -542, 579, -540, 590, -548, 571, -536, 590, -533, 580, -530, 581,
+      -544, 587, -539, 578, -544, 574, -530, 588, -544, 590, -537, 574, -1611, 577, -545, 581, -531, 586, -541, 570,
+      -539, 582, -535, 588, -536, 580, -531, 586, -543, 585, -1615, 575, -532, 587, -539, 577, -541, 587, -534, 583,
+      -550, 577, -534, 580, -542, 583, -540, 589, -549, 589, -550, 585, -531, 577, -549, 574, -543, 584, -1608, 573,
+      -535, 582, -537, 574, -536, 577, -550, 574, -537, 576, -530, 574, -535, 586, -540, 580, -539, 588, -547, 574,
+      -536, 581, -541, 589, -533, 573, -548, 579, -547, 590, -531, 581, -548, 577, -532, 571, -542, 575, -531, 583,
+      -537, 573, -534, 590, -548, 589, -543, 576, -548, 586, -540, 574, -545, 583, -548, 576, -536, 571, -543, 588,
+      -542, 580, -548, 575, -550, 576, -531, 577, -540, 571, -538, 584, -541, 583, -539, 571, -538, 586, -537, 587,
+      -541, 573, -534, 584, -536, 584, -543, 584, -1608, 576, -531, 583, -1616, 571, -1612, 571, -536, 576, -533, 589,
+      -1618, 588, -1616, 578, -1603, 572, -542, 573, -1604, 572}},
+    {"JVC",  // data=0xC5E8
+     {8434, -4160, 557, -1680, 564, -1695, 563, -495, 569, -492, 561, -489, 564, -1676, 574, -483, 568, -1694, 570,
+      -1679, 575, -1686, 569, -1676, 568, -494, 563, -1689, 568, -483, 564, -476, 567, -495, 569}},
+    {"Keeloq",  // address=0x0ABCDEF, command=0x2, encrypted=0x12345678
+     {409, -359, 398, -363, 395, -360, 390, -359, 407, -358, 395, -369, 406, -369, 395, -366, 397, -351, 402, -357, 409,
+      -360, 410, -3788, 785, -354, 774, -362, 773, -359, 394, -747, 405, -733, 408, -741, 402, -736, 789, -351, 780,
+      -363, 408, -749, 393, -739, 779, -356, 394, -744, 779, -362, 392, -740, 777, -353, 779, -354, 789, -364, 391,
+      -738, 788, -360, 395, -740, 405, -739, 780, -353, 779, -360, 788, -354, 400, -737, 779, -368, 789, -370, 397,
+      -745, 772, -360, 784, -358, 786, -350, 410, -744, 409, -736, 395, -731, 408, -732, 774, -364, 401, -745, 391,
+      -733, 409, -735, 395, -744, 775, -351, 409, -742, 395, -743, 781, -354, 780, -361, 400, -748, 407, -740, 395,
+      -734, 396, -739, 777, -365, 398, -749, 770, -368, 408, -746, 770, -350, 405, -739, 781, -362, 785, -368, 778,
+      -364, 776, -367, 783, -369, 408, -730, 775, -359, 770, -369, 781, -360, 408}},
+    {"LG",  // data=0x20DF10EF, nbits=32
+     {8041, -3966, 645, -507, 642, -509, 635, -1561, 641, -506, 648, -520, 639, -500, 638, -510, 647, -512, 644, -1558,
+      650, -1552, 632, -500, 630, -1551, 643, -1568, 635, -1567, 631, -1551, 650, -1562, 643, -508, 647, -510, 640,
+      -507, 648, -1552, 634, -519, 636, -503, 643, -511, 640, -505, 635, -1568, 631, -1555, 647, -1560, 633, -505, 630,
+      -1551, 649, -1550, 644, -1558, 640, -1559, 643}},
+    {"MagiQuest",  // wand_id=0x2A4B1C3D, magnitude=0x0123
+     {331, -827, 333, -825, 318, -814, 337, -832, 608, -532, 332, -830, 622, -538, 323, -826, 623, -529, 335, -816, 335,
+      -825, 608, -526, 325, -820, 329, -832, 615, -535, 329, -829, 611, -531, 613, -542, 326, -830, 331, -815, 336,
+      -823, 607, -529, 612, -535, 606, -533, 328, -831, 326, -819, 328, -820, 331, -822, 608, -541, 623, -531, 625,
+      -526, 616, -545, 320, -815, 607, -545, 318, -828, 327, -829, 326, -817, 318, -824, 336, -821, 326, -816, 328,
+      -824, 623, -542, 324, -814, 333, -822, 623, -544, 318, -831, 322, -833, 335, -833, 610, -543, 620, -535, 334}},
+    {"Midea",  // A1 82 48 FF FF 54
+     {4524, -4436, 610, -1631, 591, -513, 602, -1632, 593, -514, 593, -529, 609, -515, 596, -516, 596, -1635, 605,
+      -1645, 591, -519, 590, -513, 597, -530, 608, -510, 593, -513, 601, -1645, 595, -527, 600, -516, 591, -1631, 590,
+      -529, 591, -514, 594, -1641, 604, -529, 594, -524, 590, -522, 600, -1633, 599, -1630, 592, -1638, 607, -1637, 590,
+      -1641, 590, -1648, 602, -1640, 604, -1641, 610, -1640, 604, -1641, 591, -1645, 596, -1634, 591, -1639, 605, -1650,
+      591, -1631, 591, -1649, 601, -514, 608, -1643, 597, -528, 590, -1647, 598, -514, 598, -1645, 595, -529, 607, -529,
+      592, -5563, 4523, -4443, 607, -514, 601, -1639, 591, -512, 598, -1646, 600, -1638, 590, -1640, 607, -1636, 597,
+      -525, 591, -518, 607, -1648, 592, -1646, 597, -1642, 603, -1633, 596, -1646, 596, -520, 602, -1650, 594, -1638,
+      610, -523, 606, -1631, 604, -1636, 601, -518, 595, -1643, 607, -1636, 607, -1634, 590, -511, 593, -527, 602, -526,
+      605, -524, 594, -516, 606, -521, 603, -519, 608, -523, 601, -526, 610, -526, 594, -512, 609, -525, 605, -525, 604,
+      -521, 590, -512, 598, -518, 599, -1633, 590, -528, 599, -1649, 591, -515, 602, -1646, 602, -524, 596, -1632, 590,
+      -1633, 598}},
+    {"NEC",  // address=0xFB04, command=0xF708
+     {9043, -4462, 602, -513, 595, -513, 601, -1650, 610, -522, 601, -523, 607, -528, 592, -527, 601, -530, 603, -1658,
+      593, -1649, 605, -528, 592, -1654, 597, -1644, 604, -1646, 590, -1647, 592, -1650, 600, -515, 595, -529, 598,
+      -528, 590, -1647, 599, -526, 608, -511, 597, -522, 605, -510, 597, -1653, 602, -1658, 594, -1660, 603, -510, 592,
+      -1646, 598, -1655, 591, -1652, 604, -1649, 595}},
+    {"Nexa",  // device=0x1234567, group=0, state=1, channel=2
+     {266, -2486, 261, -227, 278, -1233, 262, -1237, 267, -231, 280, -222, 268, -1225, 274, -238, 261, -1224, 261,
+      -1225, 273, -238, 270, -235, 275, -1222, 260, -223, 273, -1240, 280, -233, 265, -1224, 261, -1225, 270, -221, 265,
+      -1233, 277, -235, 277, -239, 263, -1221, 264, -1236, 277, -235, 274, -237, 273, -1230, 272, -234, 266, -1228, 279,
+      -229, 262, -1233, 266, -1238, 264, -230, 266, -233, 268, -1234, 270, -1239, 263, -234, 279, -221, 276, -1220, 277,
+      -1239, 261, -230, 267, -1238, 279, -221, 278, -233, 271, -1231, 261, -225, 261, -1238, 280, -1222, 268, -228, 273,
+      -1236, 280, -232, 280, -1229, 272, -238, 260, -232, 279, -1239, 271, -1220, 273, -223, 264, -237, 271, -1227, 276,
+      -221, 269, -1237, 262, -1235, 273, -224, 269, -230, 277, -1223, 279}},
+    {"Panasonic",  // address=0x4004, command=0x0100BCBD
+     {3533, -1713, 549, -358, 534, -1212, 534, -359, 534, -353, 549, -358, 548, -357, 547, -368, 541, -352, 552, -365,
+      552, -354, 552, -365, 545, -358, 539, -351, 552, -1214, 544, -355, 546, -363, 538, -361, 546, -363, 549, -361,
+      551, -368, 537, -364, 533, -364, 540, -358, 538, -1201, 539, -359, 542, -350, 550, -364, 540, -356, 547, -365,
+      550, -352, 549, -362, 546, -352, 550, -1214, 537, -370, 542, -1195, 532, -1207, 543, -1212, 550, -1198, 544, -368,
+      541, -366, 546, -1204, 552, -356, 544, -1214, 547, -1194, 545, -1195, 548, -1196, 542, -365, 536, -1211, 532}},
+    {"Pioneer",  // rc_code_1=0xA556
+     {9030, -4451, 600, -1648, 602, -528, 591, -1648, 591, -519, 593, -522, 591, -1656, 604, -515, 600, -1659, 595,
+      -515, 595, -1659, 608, -518, 603, -1654, 599, -1642, 606, -510, 600, -1660, 597, -511, 598, -524, 608, -1647, 602,
+      -1640, 603, -515, 597, -1641, 608, -529, 592, -1651, 606, -525, 592, -1652, 600, -517, 595, -523, 592, -1656, 599,
+      -524, 599, -1655, 601, -519, 597, -1655, 602}},
+    {"RC5",  // address=0x05, command=0x35
+     {-851, 919, -850, 1824, -859, 937, -843, 934, -1738, 1818, -1746, 922, -853, 926, -859, 1812, -1738, 1822, -1737,
+      939}},
+    {"RC6",  // mode=0, address=0x00, command=0x0C
+     {2708, -839, 481, -858, 480, -412, 484, -404, 486, -855, 936, -404, 486, -395, 485, -401, 490, -396, 493, -403,
+      490, -402, 478, -407, 489, -407, 481, -406, 486, -412, 487, -406, 491, -409, 926, -402, 479, -844, 484, -405,
+      474}},
+    {"RCSwitch",  // protocol 1, 24 bits 0x545415, two packets
+     {372, -1023, 1066, -339, 365, -1034, 1065, -329, 374, -1028, 1065, -326, 365, -1034, 364, -1024, 365, -1027, 1060,
+      -336, 362, -1034, 1075, -331, 374, -1021, 1068, -337, 375, -1026, 367, -1030, 363, -1030, 370, -1035, 371, -1030,
+      1074, -331, 365, -1033, 1060, -325, 367, -1038, 1066, -339, 362}},
+    {"Samsung",  // data=0xE0E040BF, nbits=32
+     {4543, -4463, 602, -1653, 600, -1646, 592, -1643, 602, -520, 608, -530, 598, -510, 606, -511, 606, -517, 603,
+      -1640, 609, -1659, 601, -1657, 590, -514, 597, -516, 591, -511, 593, -512, 600, -524, 608, -521, 606, -1650, 592,
+      -514, 610, -518, 605, -519, 610, -519, 602, -519, 593, -522, 597, -1640, 608, -526, 599, -1641, 597, -1658, 590,
+      -1643, 594, -1659, 606, -1654, 600, -1654, 601}},
+    {"Samsung36",  // address=0x0400, command=0x0E00F
+     {4542, -4469, 534, -453, 549, -466, 549, -458, 538, -459, 547, -456, 530, -1454, 539, -462, 535, -455, 537, -457,
+      539, -470, 547, -454, 544, -451, 531, -465, 534, -451, 533, -462, 548, -463, 540, -4451, 547, -451, 539, -457,
+      541, -462, 532, -455, 530, -1468, 533, -1463, 544, -1459, 531, -453, 549, -466, 542, -455, 535, -452, 549, -451,
+      547, -454, 547, -459, 543, -454, 542, -464, 544, -1456, 533, -1463, 545, -1462, 539, -1462, 549}},
+    {"Sony",  // data=0xA90, nbits=12
+     {2448, -561, 1245, -565, 642, -555, 1238, -560, 630, -568, 1236, -554, 644, -565, 642, -550, 1249, -569, 643, -568,
+      645, -561, 645, -558, 641}},
+    {"ToshibaAC",  // rc_code_1=0xB24DBF4040BF
+     {4547, -4468, 606, -1644, 606, -519, 595, -1655, 601, -1657, 594, -527, 603, -519, 595, -1659, 605, -518, 605,
+      -519, 592, -1641, 607, -512, 592, -530, 607, -1655, 602, -1643, 599, -530, 609, -1644, 591, -1656, 598, -528, 610,
+      -1657, 607, -1654, 594, -1641, 606, -1660, 600, -1651, 594, -1649, 592, -518, 603, -1656, 592, -515, 592, -522,
+      595, -525, 604, -510, 604, -526, 595, -529, 607, -513, 596, -1640, 590, -521, 595, -530, 594, -530, 591, -511,
+      595, -519, 597, -526, 594, -1657, 590, -517, 596, -1656, 591, -1643, 606, -1660, 602, -1660, 598, -1653, 601,
+      -1655, 594, -4451, 4545, -4465, 610, -1660, 601, -526, 609, -1640, 606, -1641, 605, -515, 592, -524, 596, -1658,
+      601, -524, 605, -514, 605, -1659, 604, -516, 598, -519, 598, -1641, 596, -1645, 609, -519, 604, -1640, 607, -1655,
+      599, -528, 593, -1643, 602, -1646, 603, -1650, 604, -1648, 609, -1656, 606, -1644, 594, -513, 603, -1654, 593,
+      -521, 598, -524, 607, -518, 608, -514, 594, -525, 608, -521, 591, -526, 603, -1648, 594, -519, 603, -526, 598,
+      -525, 599, -522, 609, -528, 597, -530, 602, -1653, 605, -522, 592, -1650, 602, -1658, 603, -1647, 607, -1642, 605,
+      -1641, 592, -1650, 593}},
+};
+
+}  // namespace remote_base
+}  // namespace esphome
@@ -0,0 +1,194 @@
+#include "recordings.h"
+#include "esphome/components/remote_base/aeha_protocol.h"
+#include "esphome/components/remote_base/byronsx_protocol.h"
+#include "esphome/components/remote_base/canalsat_protocol.h"
+#include "esphome/components/remote_base/coolix_protocol.h"
+#include "esphome/components/remote_base/dish_protocol.h"
+#include "esphome/components/remote_base/drayton_protocol.h"
+#include "esphome/components/remote_base/haier_protocol.h"
+#include "esphome/components/remote_base/jvc_protocol.h"
+#include "esphome/components/remote_base/keeloq_protocol.h"
+#include "esphome/components/remote_base/lg_protocol.h"
+#include "esphome/components/remote_base/magiquest_protocol.h"
+#include "esphome/components/remote_base/midea_protocol.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/nexa_protocol.h"
+#include "esphome/components/remote_base/panasonic_protocol.h"
+#include "esphome/components/remote_base/pioneer_protocol.h"
+#include "esphome/components/remote_base/pronto_protocol.h"
+#include "esphome/components/remote_base/rc5_protocol.h"
+#include "esphome/components/remote_base/rc6_protocol.h"
+#include "esphome/components/remote_base/rc_switch_protocol.h"
+#include "esphome/components/remote_base/samsung36_protocol.h"
+#include "esphome/components/remote_base/samsung_protocol.h"
+#include "esphome/components/remote_base/sony_protocol.h"
+#include "esphome/components/remote_base/toshiba_ac_protocol.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace remote_base {
+
+// the defaults of remote_receiver
+static const uint8_t TOLERANCE = 25;
+static const int32_t IDLE_US = 10000;
+
+/// The decoder of a protocol, reduced to whether it accepts a frame.
+struct Decoder {
+  const char *protocol;
+  std::function<bool(const RawTimings &)> accepts;
+};
+
+template<typename T> static Decoder decoder(const char *protocol) {
+  return {protocol, [](const RawTimings &timings) {
+            RemoteReceiveData src(timings, TOLERANCE);
+            return T().decode(src).has_value();
+          }};
+}
+
+/// The decoders of all protocols, like the dumpers run them on every frame.
+static std::vector<Decoder> all_decoders() {
+  return {
+      decoder<AEHAProtocol>("AEHA"),
+      decoder<ByronSXProtocol>("ByronSX"),
+      decoder<CanalSatProtocol>("CanalSat"),
+      decoder<CanalSatLDProtocol>("CanalSatLD"),
+      decoder<CoolixProtocol>("Coolix"),
+      decoder<DishProtocol>("Dish"),
+      decoder<DraytonProtocol>("Drayton"),
+      decoder<HaierProtocol>("Haier"),
+      decoder<JVCProtocol>("JVC"),
+      decoder<KeeloqProtocol>("Keeloq"),
+      decoder<LGProtocol>("LG"),
+      decoder<MagiQuestProtocol>("MagiQuest"),
+      decoder<MideaProtocol>("Midea"),
+      decoder<NECProtocol>("NEC"),
+      decoder<NexaProtocol>("Nexa"),
+      decoder<PanasonicProtocol>("Panasonic"),
+      decoder<PioneerProtocol>("Pioneer"),
+      decoder<ProntoProtocol>("Pronto"),
+      decoder<RC5Protocol>("RC5"),
+      decoder<RC6Protocol>("RC6"),
+      decoder<RCSwitchBase>("RCSwitch"),
+      decoder<SamsungProtocol>("Samsung"),
+      decoder<Samsung36Protocol>("Samsung36"),
+      decoder<SonyProtocol>("Sony"),
+      decoder<ToshibaAcProtocol>("ToshibaAC"),
+  };
+}
+
+/// The frame as the receiver passes it to the decoders, ended by the idle space.
+static RawTimings received(const RawTimings &timings) {
+  RawTimings frame = timings;
+  frame.push_back(-IDLE_US);
+  return frame;
+}
+
+/** The recordings, and the frames of a device log in REMOTE_RECORDINGS.
+ *
+ * The log is the output of a remote_receiver with `dump: raw`, every "Received Raw:" message and the lines that
+ * continue it are one frame.
+ */
+static std::vector<Recording> all_recordings() {
+  std::vector<Recording> recordings = RECORDINGS;
+  const char *path = getenv("REMOTE_RECORDINGS");
+  if (path == nullptr)
+    return recordings;
+
+  std::ifstream log(path);
+  std::string line;
+  bool in_frame = false;
+  while (std::getline(log, line)) {
+    const size_t raw = line.find("Received Raw: ");
+    const size_t message = line.find("]: ");
+    const char *numbers;
+    if (raw != std::string::npos) {
+      recordings.push_back({"log", {}});
+      numbers = line.c_str() + raw + strlen("Received Raw: ");
+      in_frame = true;
+    } else if (in_frame && message != std::string::npos && line.compare(message + 3, 2, "  ") == 0) {
+      numbers = line.c_str() + message + 3;
+    } else {
+      in_frame = false;
+      continue;
+    }
+    while (true) {
+      char *end;
+      const int32_t value = strtol(numbers, &end, 10);
+      if (end == numbers)
+        break;
+      recordings.back().timings.push_back(value);
+      numbers = end + strspn(end, ", ");
+    }
+  }
+  return recordings;
+}
+
+TEST(RemoteDecodeTest, EveryProtocolHasARecording) {
+  for (const auto &decoder : all_decoders()) {
+    // Pronto turns every frame into its codes
+    if (strcmp(decoder.protocol, "Pronto") == 0)
+      continue;
+    bool found = false;
+    for (const auto &recording : RECORDINGS)
+      found |= strcmp(recording.protocol, decoder.protocol) == 0;
+    EXPECT_TRUE(found) << decoder.protocol;
+  }
+}
+
+TEST(RemoteDecodeTest, EveryRecordingDecodesWithItsProtocol) {
+  const auto decoders = all_decoders();
+  for (const auto &recording : RECORDINGS) {
+    const RawTimings frame = received(recording.timings);
+    for (const auto &decoder : decoders) {
+      if (strcmp(recording.protocol, decoder.protocol) == 0) {
+        EXPECT_TRUE(decoder.accepts(frame)) << recording.protocol;
+      }
+    }
+  }
+}
+
+TEST(RemoteDecodeTest, ReportsDecodeCost) {
+  using Clock = std::chrono::steady_clock;
+  const auto decoders = all_decoders();
+  const auto recordings = all_recordings();
+  std::vector<RawTimings> frames;
+  for (const auto &recording : recordings)
+    frames.push_back(received(recording.timings));
+
+  // the time of one decoder for a frame, over all recordings, and the recordings it accepts
+  double total_ns = 0;
+  for (const auto &decoder : decoders) {
+    std::string accepted;
+    for (size_t i = 0; i < frames.size(); i++) {
+      if (decoder.accepts(frames[i]))
+        accepted += std::string(accepted.empty() ? "" : ", ") + recordings[i].protocol;
+    }
+
+    uint32_t passes = 0;
+    const auto start = Clock::now();
+    auto elapsed = Clock::duration::zero();
+    while (elapsed < std::chrono::milliseconds(20)) {
+      for (const auto &frame : frames)
+        decoder.accepts(frame);
+      passes++;
+      elapsed = Clock::now() - start;
+    }
+    const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / passes / frames.size();
+    total_ns += ns;
+    printf("%-11s %8.0f ns/frame  accepts: %s\n", decoder.protocol, ns, accepted.empty() ? "-" : accepted.c_str());
+  }
+  printf("%-11s %8.0f ns/frame\n", "all", total_ns);
+}
+
+}  // namespace remote_base
+}  // namespace esphome
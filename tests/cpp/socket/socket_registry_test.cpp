@@ -0,0 +1,79 @@
+#include "esphome/components/socket/socket.h"
+#include "esphome/components/socket/socket_registry.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <memory>
+
+namespace esphome {
+namespace socket {
+
+/// A loopback listener and a monitored client connecting to it.
+class SocketRegistryTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    this->listener_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::bind(this->listener_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+    socklen_t len = sizeof(addr);
+    ::getsockname(this->listener_, reinterpret_cast<sockaddr *>(&addr), &len);
+    ::listen(this->listener_, 1);
+
+    this->client_ = socket_loop_monitored(AF_INET, SOCK_STREAM, 0);
+    this->client_->setblocking(false);
+    this->client_->connect(reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+  }
+  void TearDown() override {
+    this->client_.reset();
+    if (this->server_ >= 0)
+      ::close(this->server_);
+    ::close(this->listener_);
+  }
+
+  int listener_;
+  int server_{-1};
+  std::unique_ptr<Socket> client_;
+};
+
+TEST_F(SocketRegistryTest, WakesUpForWriteInterest) {
+  this->client_->set_write_interest(true);
+  global_socket_registry.wait(1000);
+
+  // the connection was established, there is nothing to read yet
+  EXPECT_TRUE(this->client_->writable());
+  EXPECT_FALSE(this->client_->ready());
+}
+
+TEST_F(SocketRegistryTest, OnlyReadInterestByDefault) {
+  global_socket_registry.wait(0);
+  EXPECT_FALSE(this->client_->ready());
+
+  this->server_ = ::accept(this->listener_, nullptr, nullptr);
+  ::write(this->server_, "x", 1);
+  global_socket_registry.wait(1000);
+
+  EXPECT_TRUE(this->client_->ready());
+  // without write interest the socket counts as writable
+  EXPECT_TRUE(this->client_->writable());
+}
+
+TEST_F(SocketRegistryTest, DropsWritableWithTheInterest) {
+  this->client_->set_write_interest(true);
+  global_socket_registry.wait(1000);
+  ASSERT_TRUE(this->client_->writable());
+
+  this->client_->set_write_interest(false);
+  this->client_->set_write_interest(true);
+  // nothing is reported for the new interest until the next wait()
+  EXPECT_FALSE(this->client_->writable());
+}
+
+}  // namespace socket
+}  // namespace esphome